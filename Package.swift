@@ -39,6 +39,12 @@ let occtTarget: Target = useLocalBinary
         checksum: "c15e1a32ef4bbf28157f9d8d413cdf2f9cd065f86b5e8ade1391e562fbe78572"
     )
 
+// Wrapper-pool counters (Shape.wrapperPoolStats) cost an atomic per allocation, so they
+// are opt-in: OCCTSWIFT_POOL_STATS=1 swift test. Left off, every consumer build skips them.
+let poolStatsSettings: [CXXSetting] = ProcessInfo.processInfo.environment["OCCTSWIFT_POOL_STATS"] == "1"
+    ? [.define("OCCT_WRAPPER_POOL_STATS")]
+    : []
+
 let package = Package(
     name: "OCCTSwift",
     platforms: [
@@ -80,8 +86,8 @@ let package = Package(
                 .headerSearchPath("../../Libraries/OCCT.xcframework/xros-arm64-simulator/Headers", .when(platforms: [.visionOS])),
                 .headerSearchPath("../../Libraries/OCCT.xcframework/tvos-arm64/Headers", .when(platforms: [.tvOS])),
                 .headerSearchPath("../../Libraries/OCCT.xcframework/tvos-arm64-simulator/Headers", .when(platforms: [.tvOS])),
-                .define("OCCT_AVAILABLE", to: "1")
-            ],
+                .define("OCCT_AVAILABLE", to: "1"),
+            ] + poolStatsSettings,
             linkerSettings: [
                 .linkedLibrary("c++")
             ]
@@ -64,8 +64,8 @@
 //
 // --- BRepAlgoAPI ---
 // BRepAlgoAPI_Check                   → OCCTShapeBooleanCheck
-// BRepAlgoAPI_Common                  → OCCTShapeIntersect
-// BRepAlgoAPI_Cut                     → OCCTShapeSubtract
+// BRepAlgoAPI_Common                  → OCCTShapeIntersect, OCCTShapeCommonMulti, OCCTShapeCommonMultiTool
+// BRepAlgoAPI_Cut                     → OCCTShapeSubtract, OCCTShapeSubtractMulti
 // BRepAlgoAPI_Defeaturing             → OCCTShapeRemoveFeatures
 // BRepAlgoAPI_Fuse                    → OCCTShapeUnion
 // BRepAlgoAPI_Section                 → OCCTShapeSection, OCCTShapeSliceAtZ, OCCTSectionBuilder*
@@ -630,6 +630,51 @@ OCCTShapeRef OCCTShapeUnionEx(OCCTShapeRef shape1, OCCTShapeRef shape2, double f
 OCCTShapeRef OCCTShapeSubtractEx(OCCTShapeRef shape1, OCCTShapeRef shape2, double fuzzyValue, int32_t glue, double timeoutSeconds);
 OCCTShapeRef OCCTShapeIntersectEx(OCCTShapeRef shape1, OCCTShapeRef shape2, double fuzzyValue, int32_t glue, double timeoutSeconds);
 
+// Multi-tool cut / common: one object against `count` tools in a single BOP pass (run
+// parallel, OBB pre-filter on), instead of one pass per tool over a growing intermediate.
+// CommonMultiTool keeps the part of `object` inside the union of the tools (unlike
+// OCCTShapeCommonMulti, which intersects all its shapes). fuzzyValue, glue and
+// timeoutSeconds as for the Ex variants; NULL on failure, timeout or a NULL tool.
+OCCTShapeRef OCCTShapeSubtractMulti(OCCTShapeRef object, const OCCTShapeRef* tools, int32_t count,
+                                    double fuzzyValue, int32_t glue, double timeoutSeconds);
+OCCTShapeRef OCCTShapeCommonMultiTool(OCCTShapeRef object, const OCCTShapeRef* tools, int32_t count,
+                                      double fuzzyValue, int32_t glue, double timeoutSeconds);
+
+/// Boolean-family operation selector for OCCTShapeBooleanWithOptions.
+typedef enum {
+    OCCTBooleanOpFuse = 0,          ///< BRepAlgoAPI_Fuse: objects ∪ tools
+    OCCTBooleanOpCut = 1,           ///< BRepAlgoAPI_Cut: objects \ tools
+    OCCTBooleanOpCommon = 2,        ///< BRepAlgoAPI_Common: objects ∩ tools
+    OCCTBooleanOpSection = 3,       ///< BRepAlgoAPI_Section: intersection edges/vertices
+    OCCTBooleanOpSplit = 4,         ///< BRepAlgoAPI_Splitter: objects split by tools
+    OCCTBooleanOpGeneralFuse = 5,   ///< BRepAlgoAPI_BuilderAlgo over objects and tools together
+    OCCTBooleanOpCutReversed = 6    ///< BRepAlgoAPI_Cut: tools \ objects
+} OCCTBooleanOp;
+
+/// Options shared by every boolean and splitter. Start from OCCTBooleanOptionsDefault(),
+/// which reproduces OCCT's defaults, and override fields.
+typedef struct {
+    bool runParallel;       ///< Run intersection and building on OCCT's thread pool
+    bool useOBB;            ///< Pre-filter interfering sub-shape pairs with oriented boxes
+    bool nonDestructive;    ///< Never modify the inputs (tolerances etc.); copy instead
+    bool checkInverted;     ///< Check input solids for inversion (OCCT default: on)
+    int32_t glue;           ///< 0 = off, 1 = BOPAlgo_GlueShift, 2 = BOPAlgo_GlueFull
+    double fuzzyValue;      ///< Fuzzy tolerance; <= 0 keeps OCCT's default
+    double timeoutSeconds;  ///< Wall-clock watchdog; <= 0 = unbounded
+} OCCTBooleanOptions;
+
+OCCTBooleanOptions OCCTBooleanOptionsDefault(void);
+
+/// Any boolean / section / splitter with explicit options.
+/// @param objects Argument shapes (at least one)
+/// @param tools Tool shapes (may be empty for general fuse)
+/// @param options NULL = OCCTBooleanOptionsDefault()
+/// @return Result shape, or NULL on failure, timeout or a NULL operand
+OCCTShapeRef _Nullable OCCTShapeBooleanWithOptions(OCCTBooleanOp op,
+                                                   const OCCTShapeRef _Nonnull * _Nullable objects, int32_t objectCount,
+                                                   const OCCTShapeRef _Nonnull * _Nullable tools, int32_t toolCount,
+                                                   const OCCTBooleanOptions* _Nullable options);
+
 // Self-interference check (BOPAlgo_ArgumentAnalyzer), watchdog-bounded by timeoutSeconds
 // (<= 0 = unbounded). Detects the self-intersection that BRepCheck misses and that hangs
 // booleans (#206/#208). Returns 1 = self-intersects, 0 = clean, -1 = indeterminate.
@@ -1069,6 +1114,29 @@ OCCTWireRef OCCTWireOffset(OCCTWireRef wire, double distance, int32_t joinType);
 /// @return Array of wire references, or NULL on failure. Caller must free with OCCTFreeWireArray.
 OCCTWireRef* OCCTShapeSectionWiresAtZ(OCCTShapeRef shape, double z, double tolerance, int32_t* outCount);
 
+/// Get closed wires from sections at many parallel planes in one pass
+///
+/// Plane i passes through origin + offsets[i]·normal. Face bounding boxes are computed
+/// once and projected onto the normal, so each level only sections the faces whose
+/// extent spans it; levels are sectioned concurrently, each with its own BRepAlgoAPI_Section.
+/// @param shape The shape to section
+/// @param origin Point on the plane at offset 0 (3 doubles)
+/// @param normal Plane normal (3 doubles, need not be unit)
+/// @param offsets Signed distances of the planes along the unit normal
+/// @param levelCount Number of planes
+/// @param tolerance Tolerance for connecting edges into wires (use 1e-6 for default)
+/// @param outWireCounts Output: number of wires per level (levelCount entries)
+/// @param outFaces Optional output (levelCount entries): planar faces per level as a compound,
+///                 holes included, or NULL for an empty level. Caller releases each shape.
+/// @param outTotal Output: total number of wires returned
+/// @param parallel Section the levels on OCCT's thread pool
+/// @return All wires, level by level, or NULL if there are none. Caller frees with
+///         OCCTFreeWireArray (or OCCTFreeWireArrayOnly after taking the wires).
+OCCTWireRef* OCCTShapeSectionWiresAtLevels(OCCTShapeRef shape, const double* origin, const double* normal,
+                                           const double* offsets, int32_t levelCount, double tolerance,
+                                           int32_t* outWireCounts, OCCTShapeRef* outFaces,
+                                           int32_t* outTotal, bool parallel);
+
 /// Free an array of wires returned by OCCTShapeSectionWiresAtZ (frees wires AND array)
 /// @param wires Array of wire references
 /// @param count Number of wires in the array
@@ -1267,6 +1335,46 @@ bool OCCTFacesAreAdjacent(OCCTShapeRef shape, OCCTFaceRef face1, OCCTFaceRef fac
 /// @return Dihedral angle in radians (0 to 2*PI), or -1 on error
 double OCCTEdgeGetDihedralAngle(OCCTEdgeRef edge, OCCTFaceRef face1, OCCTFaceRef face2, double parameter);
 
+/// Opaque handle to a whole-shape attributed adjacency graph.
+typedef struct OCCTAAGData* OCCTAAGDataRef;
+
+/// Build the attributed adjacency graph of a shape in one pass.
+///
+/// Nodes are the shape's faces in OCCTShapeGetFaceAtIndex order. An arc joins two
+/// faces that share at least one non-degenerate edge (seams don't make a face its own
+/// neighbour). Each arc carries the convexity and interior dihedral angle of its first
+/// shared edge, measured at the edge midpoint, and the number of shared edges.
+/// @param smoothAngle Normals closer than this (radians) classify as smooth
+/// @param parallel    Classify edges on OCCT's thread pool
+/// @return NULL on failure; release with OCCTAAGDataRelease
+OCCTAAGDataRef _Nullable OCCTShapeBuildAAG(OCCTShapeRef _Nonnull shape, double smoothAngle, bool parallel);
+
+/// Release an adjacency graph.
+void OCCTAAGDataRelease(OCCTAAGDataRef _Nonnull aag);
+
+/// Number of faces (nodes).
+int32_t OCCTAAGDataFaceCount(OCCTAAGDataRef _Nonnull aag);
+
+/// Number of arcs (adjacent face pairs).
+int32_t OCCTAAGDataArcCount(OCCTAAGDataRef _Nonnull aag);
+
+/// Copy the CSR adjacency: the neighbours of face f are outNeighbors[outOffsets[f] ..<
+/// outOffsets[f + 1]] (ascending), joined by arcs outArcs[same range].
+/// @param outOffsets   faceCount + 1 values
+/// @param outNeighbors 2·arcCount values
+/// @param outArcs      2·arcCount values
+void OCCTAAGDataGetAdjacency(OCCTAAGDataRef _Nonnull aag, int32_t* _Nonnull outOffsets,
+                             int32_t* _Nonnull outNeighbors, int32_t* _Nonnull outArcs);
+
+/// Copy the per-arc attributes.
+/// @param outFaces       2·arcCount values: (face1, face2) with face1 < face2
+/// @param outConvexity   arcCount OCCTEdgeConvexity values
+/// @param outAngles      arcCount interior dihedral angles in radians (π = smooth)
+/// @param outSharedEdges arcCount shared-edge counts
+void OCCTAAGDataGetArcs(OCCTAAGDataRef _Nonnull aag, int32_t* _Nonnull outFaces,
+                        int32_t* _Nonnull outConvexity, double* _Nonnull outAngles,
+                        int32_t* _Nonnull outSharedEdges);
+
 
 // MARK: - XDE/XCAF Document Support (v0.6.0)
 
@@ -1478,6 +1586,41 @@ OCCTShapeRef OCCTShapeFilletEdges(OCCTShapeRef shape, const int32_t* edgeIndices
 OCCTShapeRef OCCTShapeFilletEdgesLinear(OCCTShapeRef shape, const int32_t* edgeIndices,
                                          int32_t edgeCount, double startRadius, double endRadius);
 
+// Speculative fillet: the requested edges are split into independent groups (OCCT's
+// tangent-propagated contours, merged where they meet at a vertex), and every
+// (group × radius) trial runs on its own deep copy on OCCT's thread pool. Each group
+// keeps the first radius of the ladder that builds a valid solid; the groups are then
+// filleted together on the input, dropping groups greedily if their blends collide.
+
+/// Per-edge outcome of OCCTShapeFilletEdgesSpeculative.
+typedef enum {
+    OCCTFilletEdgeFilleted = 0,  ///< Filleted at radii[0]
+    OCCTFilletEdgeReduced  = 1,  ///< Filleted at a later radius of the ladder
+    OCCTFilletEdgeFailed   = 2,  ///< No radius of the ladder worked for its group
+    OCCTFilletEdgeInvalid  = 3   ///< Edge index out of range
+} OCCTFilletEdgeStatus;
+
+/// Report for one requested edge.
+typedef struct {
+    int32_t status;   ///< OCCTFilletEdgeStatus
+    int32_t group;    ///< Independent group the edge was solved in, -1 if none
+    int32_t rung;     ///< Index into radii of the applied radius, -1 if not filleted
+    double radius;    ///< Applied radius, 0 if not filleted
+} OCCTFilletEdgeReport;
+
+/// Fillet edges with a per-group radius ladder, trying the ladder speculatively in parallel.
+/// @param shape The shape to fillet
+/// @param edgeIndices Array of edge indices (0-based)
+/// @param edgeCount Number of edges
+/// @param radii Radius ladder in order of preference (all > 0)
+/// @param radiusCount Number of radii
+/// @param outReports Optional, edgeCount entries; filled even when the function returns NULL
+/// @param parallel Run the trials on OCCT's thread pool
+/// @return Shape with every achievable group filleted, or NULL if no group could be filleted
+OCCTShapeRef OCCTShapeFilletEdgesSpeculative(OCCTShapeRef shape, const int32_t* edgeIndices,
+                                             int32_t edgeCount, const double* radii, int32_t radiusCount,
+                                             OCCTFilletEdgeReport* outReports, bool parallel);
+
 /// Add draft angle to faces for mold release
 /// @param shape The shape to draft
 /// @param faceIndices Array of face indices (0-based)
@@ -1582,6 +1725,54 @@ OCCTShapeRef OCCTShapeBuildThreadCutter(double ox, double oy, double oz,
                                         double outerHalf, double apexHalf, double bleed,
                                         double phase, double handed, int32_t nSections);
 
+/// Cache key for a thread cutter: everything that shapes it except its placement.
+/// Frame (origin, axis, radial0) and start phase are applied on lookup.
+typedef struct {
+    int32_t builder;        ///< 0 analytic helicoid (OCCTShapeBuildThreadCutter); others caller-defined
+    int32_t nSections;
+    double pitch, turns, apexSign, helixRadius, cutDepth;
+    double outerHalf, apexHalf, bleed;
+    double taper;           ///< Radius change per unit axial length (0 = parallel)
+    double handed;          ///< -1 left-handed / +1 right
+} OCCTThreadCutterKey;
+
+/// Process-wide thread-cutter cache. Cutters are stored in a canonical frame
+/// (origin 0, axis +Z, radial0 +X, phase 0) and returned as located instances sharing
+/// the cached geometry, placed in (origin, axis, radial0) and rotated by the phase.
+/// Parameters are compared to 1e-9. Thread-safe; oldest entries are evicted first.
+/// @return Placed cutter, or NULL on a miss (counted)
+OCCTShapeRef _Nullable OCCTThreadCutterCacheLookup(const OCCTThreadCutterKey* _Nonnull key,
+                                                   double ox, double oy, double oz,
+                                                   double ax, double ay, double az,
+                                                   double rx, double ry, double rz, double phase);
+
+/// Store a cutter built in the canonical frame and return it placed as for a lookup.
+OCCTShapeRef _Nullable OCCTThreadCutterCacheStore(const OCCTThreadCutterKey* _Nonnull key,
+                                                  OCCTShapeRef _Nonnull canonical,
+                                                  double ox, double oy, double oz,
+                                                  double ax, double ay, double az,
+                                                  double rx, double ry, double rz, double phase);
+
+/// OCCTShapeBuildThreadCutter through the cache.
+/// @param lengthBucket 0 = cache by exact turn count. Otherwise a bucket size in turns:
+///        the cutter for the next whole bucket is cached and trimmed back to `turns`
+///        with a plane normal to the axis, so the groove ends flat instead of in a V cap.
+OCCTShapeRef _Nullable OCCTShapeBuildThreadCutterCached(double ox, double oy, double oz,
+                                                        double ax, double ay, double az,
+                                                        double rx, double ry, double rz,
+                                                        double pitch, double turns, double apexSign,
+                                                        double helixRadius, double cutDepth,
+                                                        double outerHalf, double apexHalf, double bleed,
+                                                        double phase, double handed, int32_t nSections,
+                                                        double lengthBucket);
+
+void OCCTThreadCutterCacheGetStats(int64_t* _Nullable outHits, int64_t* _Nullable outMisses,
+                                   int32_t* _Nullable outEntries);
+/// Drop every entry and reset the counters.
+void OCCTThreadCutterCacheClear(void);
+/// Maximum number of cached cutters (default 256; 0 disables caching).
+void OCCTThreadCutterCacheSetCapacity(int32_t maxEntries);
+
 
 // MARK: - Surfaces & Curves (v0.9.0)
 
@@ -1857,6 +2048,27 @@ OCCTShapeRef OCCTShapeCircularPattern(OCCTShapeRef shape,
                                        double axisDirX, double axisDirY, double axisDirZ,
                                        int32_t count, double angle);
 
+/// How the pattern builders produce their instances.
+typedef enum {
+    OCCTPatternModeCopy = 0,        ///< Deep copy of the geometry per instance
+    OCCTPatternModeInstanced = 1,   ///< Located instances sharing the seed's geometry (O(1) memory)
+    OCCTPatternModeFused = 2        ///< Instanced, then fused in one multi-argument boolean
+} OCCTPatternMode;
+
+/// OCCTShapeLinearPattern with an explicit instance mode.
+/// In fused mode the instances are only intersected when the pattern step makes
+/// neighbouring instances overlap (decided once, from the seed); disjoint instances
+/// come back as the instanced compound.
+OCCTShapeRef OCCTShapeLinearPatternEx(OCCTShapeRef shape,
+                                      double dirX, double dirY, double dirZ,
+                                      double spacing, int32_t count, OCCTPatternMode mode);
+
+/// OCCTShapeCircularPattern with an explicit instance mode (see OCCTShapeLinearPatternEx).
+OCCTShapeRef OCCTShapeCircularPatternEx(OCCTShapeRef shape,
+                                        double axisX, double axisY, double axisZ,
+                                        double axisDirX, double axisDirY, double axisDirZ,
+                                        int32_t count, double angle, OCCTPatternMode mode);
+
 // MARK: - Shape Healing & Analysis (v0.13.0)
 
 /// Shape analysis result structure
@@ -1911,6 +2123,51 @@ OCCTShapeRef OCCTShapeUnifySameDomain(OCCTShapeRef shape,
                                        bool unifyEdges, bool unifyFaces,
                                        bool concatBSplines);
 
+/// Group the faces of a shape by a quantized canonical key of their surface.
+///
+/// Planes, cylinders, cones, spheres and tori are reduced to a canonical form (axis sense
+/// normalised, axis origin moved to its foot from the world origin, …) and quantized in
+/// cells of `linearTolerance` / `angularTolerance`. Faces with equal keys lie on the same
+/// surface up to those tolerances, so same-domain candidates come out of one hash pass
+/// instead of pairwise comparison. Values that straddle a cell edge can land in different
+/// groups: treat groups as candidates, not a proof.
+///
+/// @param outGroups Per face (index order), its group in [0, groupCount), or -1 for faces on
+///                  other surface types. Sized to the face count; NULL to query the count only
+/// @param outGroupCount Number of groups (optional)
+/// @param parallel Compute the keys on OCCT's thread pool
+/// @return Number of faces, or -1 on invalid input
+int32_t OCCTShapeGeometricHashFaces(OCCTShapeRef _Nonnull shape,
+                                    double linearTolerance, double angularTolerance,
+                                    int32_t* _Nullable outGroups, int32_t* _Nullable outGroupCount,
+                                    bool parallel);
+
+/// Group the edges of a shape by a quantized canonical key of their 3D curve (lines and
+/// circles; see OCCTShapeGeometricHashFaces). Degenerated edges and other curve types get -1.
+/// @return Number of edges, or -1 on invalid input
+int32_t OCCTShapeGeometricHashEdges(OCCTShapeRef _Nonnull shape,
+                                    double linearTolerance, double angularTolerance,
+                                    int32_t* _Nullable outGroups, int32_t* _Nullable outGroupCount,
+                                    bool parallel);
+
+/// UnifySameDomain driven by the geometric hash.
+///
+/// Only adjacent faces (and chained edges) whose keys fall within one cell of each other
+/// can be merged, so a hash pass finds the places UnifySameDomain would act on. Top-level
+/// parts of a compound that share no edges are unified one by one, and parts without any
+/// candidate are passed through untouched; a shape with no candidates is returned as is.
+/// Faces and edges on non-analytic geometry always count as candidates.
+///
+/// @param outUnifiedParts Number of parts handed to UnifySameDomain (optional)
+/// @param parallel Compute the keys on OCCT's thread pool
+/// @return Unified shape, or NULL on failure
+OCCTShapeRef _Nullable OCCTShapeUnifySameDomainHashed(OCCTShapeRef _Nonnull shape,
+                                                      bool unifyEdges, bool unifyFaces,
+                                                      bool concatBSplines,
+                                                      double linearTolerance, double angularTolerance,
+                                                      int32_t* _Nullable outUnifiedParts,
+                                                      bool parallel);
+
 /// Remove internal wires (holes) smaller than area threshold
 /// @param shape The shape to clean
 /// @param minArea Minimum area threshold for holes
@@ -4302,6 +4559,37 @@ OCCTShapeRef OCCTShapeCreateLoftAdvanced(const OCCTWireRef* profiles, int32_t pr
                                           double firstVertexX, double firstVertexY, double firstVertexZ,
                                           double lastVertexX, double lastVertexY, double lastVertexZ);
 
+// MARK: - Resampled Loft / Sweep
+//
+// For long section stacks (hundreds of blade or thread sections) ThruSections spends
+// most of its time making sections compatible and approximating them one after another.
+// These variants resample every section at uniform arc length in parallel, align start
+// points and winding, and skin one bicubic B-spline surface through the sampled grid
+// (section curves and the cross-section columns are interpolated in parallel). Corners
+// within a section are rounded to the sample spacing, so use ThruSections when sharp
+// section edges must survive.
+
+/// Loft through resampled sections.
+/// @param profiles Section wires (at least 2; all closed or all open)
+/// @param count Number of profiles
+/// @param solid Close the ends with planar caps (closed, planar sections only)
+/// @param samples Points per section (<= 0 = 64)
+/// @param parallel Resample, align and interpolate on OCCT's thread pool
+/// @return Face (open sections or !solid), solid, or NULL on failure
+OCCTShapeRef _Nullable OCCTShapeCreateLoftResampled(const OCCTWireRef _Nonnull * _Nonnull profiles,
+                                                    int32_t count, bool solid,
+                                                    int32_t samples, bool parallel);
+
+/// Sweep a profile along a spine by lofting through placed copies of it.
+/// The profile is given at the spine start and carried along with a rotation-minimizing
+/// frame; `stations` copies are placed at uniform arc length.
+/// @param stations Number of sections along the spine (>= 2)
+/// @return Face or solid as for OCCTShapeCreateLoftResampled, or NULL on failure
+OCCTShapeRef _Nullable OCCTShapeCreateSweepResampled(OCCTWireRef _Nonnull profile,
+                                                     OCCTWireRef _Nonnull spine,
+                                                     int32_t stations, bool solid,
+                                                     int32_t samples, bool parallel);
+
 
 // MARK: - Offset with Join Type (v0.32.0)
 
@@ -4672,6 +4960,44 @@ OCCTBooleanHistoryRef _Nullable OCCTBooleanSplitWithHistory(OCCTShapeRef _Nonnul
                                                               OCCTShapeRef _Nonnull shape2,
                                                               OCCTShapeRef _Nullable * _Nullable outResult);
 
+/// OCCTShapeBooleanWithOptions with retained history.
+OCCTBooleanHistoryRef _Nullable OCCTBooleanWithOptionsAndHistory(OCCTBooleanOp op,
+                                                                 const OCCTShapeRef _Nonnull * _Nullable objects,
+                                                                 int32_t objectCount,
+                                                                 const OCCTShapeRef _Nonnull * _Nullable tools,
+                                                                 int32_t toolCount,
+                                                                 const OCCTBooleanOptions* _Nullable options,
+                                                                 OCCTShapeRef _Nullable * _Nullable outResult);
+
+/// Boolean session: runs the intersection phase (BOPAlgo_PaveFiller) once on a fixed set
+/// of objects and tools, then builds any number of Fuse / Cut / Common / Section / Split
+/// results from the shared intersection data. Much cheaper than separate one-shot
+/// booleans when several operations are needed on the same operands.
+typedef struct OCCTBooleanSession* OCCTBooleanSessionRef;
+
+/// Intersect the operands once. Options apply to the intersection (parallel, OBB, fuzzy,
+/// glue, non-destructive, timeout) and to every later build.
+/// @return Session, or NULL on failure, timeout or a NULL operand
+OCCTBooleanSessionRef _Nullable OCCTBooleanSessionCreate(const OCCTShapeRef _Nonnull * _Nullable objects,
+                                                         int32_t objectCount,
+                                                         const OCCTShapeRef _Nonnull * _Nullable tools,
+                                                         int32_t toolCount,
+                                                         const OCCTBooleanOptions* _Nullable options);
+void OCCTBooleanSessionRelease(OCCTBooleanSessionRef _Nonnull session);
+
+/// True if the intersection phase reported warnings (e.g. unsupported interferences).
+bool OCCTBooleanSessionHasWarnings(OCCTBooleanSessionRef _Nonnull session);
+
+/// Build one operation from the session's intersection data. Thread-safe (serialised).
+/// @return Result shape, or NULL on failure or timeout
+OCCTShapeRef _Nullable OCCTBooleanSessionResult(OCCTBooleanSessionRef _Nonnull session, OCCTBooleanOp op);
+
+/// As OCCTBooleanSessionResult, returning the build's history. The history keeps the
+/// shared intersection data alive, so it may outlive the session.
+OCCTBooleanHistoryRef _Nullable OCCTBooleanSessionResultWithHistory(OCCTBooleanSessionRef _Nonnull session,
+                                                                    OCCTBooleanOp op,
+                                                                    OCCTShapeRef _Nullable * _Nullable outResult);
+
 /// Modified output sub-shapes for an input sub-shape. Returns count, fills outRefs (if non-null) up to maxCount.
 /// Caller takes ownership of each OCCTShapeRef written.
 int32_t OCCTBooleanHistoryModified(OCCTBooleanHistoryRef _Nonnull history,
@@ -16700,9 +17026,13 @@ OCCTShapeRef _Nullable OCCTBuilderMakeCompound(void);
 OCCTShapeRef _Nullable OCCTBuilderMakeCompSolid(void);
 
 /// Add child shape into parent shape using TopoDS_Builder.
+/// Edits `parent` in place and refreshes its sub-shape index. Other handles that share
+/// its TShape (e.g. one obtained as a sub-shape of another shape, or that other shape)
+/// keep their old index and must be re-fetched before index-based calls.
 bool OCCTBuilderAdd(OCCTShapeRef _Nonnull parent, OCCTShapeRef _Nonnull child);
 
 /// Remove child shape from parent shape using TopoDS_Builder.
+/// In-place edit with the same caveat as OCCTBuilderAdd for other handles.
 bool OCCTBuilderRemove(OCCTShapeRef _Nonnull parent, OCCTShapeRef _Nonnull child);
 
 // --- ShapeAnalysis_ShapeContents expanded ---
@@ -16854,6 +17184,7 @@ OCCTShapeRef _Nullable OCCTThickSolidWithOptions(OCCTShapeRef _Nonnull shape,
 // --- BRepLib utilities ---
 
 /// Orient a closed solid so that its faces' normals point outward.
+/// In-place edit with the same caveat as OCCTBuilderAdd for other handles.
 bool OCCTBRepLibOrientClosedSolid(OCCTShapeRef _Nonnull solid);
 
 /// Build 3D curves for all edges in a shape.
@@ -19949,6 +20280,32 @@ typedef struct {
 /// Deduplicate geometry in the graph.
 OCCTBRepGraphDeduplicateResult OCCTBRepGraphDeduplicate(OCCTBRepGraphRef _Nonnull graph);
 
+/// Group graph faces by a quantized canonical key of their surface (see
+/// OCCTShapeGeometricHashFaces). Removed faces get -1.
+/// @return Number of faces, or -1 on invalid input
+int32_t OCCTBRepGraphHashFaceSurfaces(OCCTBRepGraphRef _Nonnull graph,
+                                      double linearTolerance, double angularTolerance,
+                                      int32_t* _Nullable outGroups, int32_t* _Nullable outGroupCount,
+                                      bool parallel);
+
+/// Group graph edges by a quantized canonical key of their 3D curve. Removed and
+/// curveless edges get -1.
+/// @return Number of edges, or -1 on invalid input
+int32_t OCCTBRepGraphHashEdgeCurves(OCCTBRepGraphRef _Nonnull graph,
+                                    double linearTolerance, double angularTolerance,
+                                    int32_t* _Nullable outGroups, int32_t* _Nullable outGroupCount,
+                                    bool parallel);
+
+/// Deduplicate geometry, skipping BRepGraph_Deduplicate when the geometric hash shows
+/// nothing to merge: every surface and curve is analytic, no two distinct handles have
+/// keys within one cell of each other, and no axis sits at the direction sign threshold.
+/// The skipped result reports each handle as its own canonical one.
+/// @param outSkipped Set to true when the full pass was skipped (optional)
+OCCTBRepGraphDeduplicateResult OCCTBRepGraphDeduplicateHashed(OCCTBRepGraphRef _Nonnull graph,
+                                                              double linearTolerance,
+                                                              double angularTolerance,
+                                                              bool* _Nullable outSkipped);
+
 // --- Node Removal Check ---
 
 /// Check if a node has been soft-removed.
@@ -20852,6 +21209,725 @@ bool OCCTPolyPolygonOnTriSetNodes(OCCTPolyPolygonOnTriRef _Nonnull ref,
 bool OCCTPolyPolygonOnTriSetParameters(OCCTPolyPolygonOnTriRef _Nonnull ref,
                                        const double* _Nonnull params, int count);
 
+// MARK: - Point-Cloud Processing (KD-tree normals, curvature, downsampling, outliers)
+//
+// Batch point-cloud kernels on top of OCCTKDTreeRef. Per-point work (kNN + PCA, kNN
+// distance statistics) runs in parallel on OCCT's thread pool; every output is a
+// caller-owned float / byte buffer indexed like the points the tree was built from.
+
+/// Estimate a unit normal and surface-variation curvature for every point in the tree
+/// by PCA of its k nearest neighbours (the point itself included).
+///
+/// The normal is the eigenvector of the smallest covariance eigenvalue; curvature is
+/// λmin / (λ0 + λ1 + λ2), in [0, 1/3] (0 = locally flat). When `viewpoint` is non-null
+/// (3 doubles) each normal is flipped to face it; otherwise the sign is arbitrary.
+/// Points with fewer than 3 neighbours or a degenerate neighbourhood get a zero normal
+/// and curvature -1.
+/// @param outNormals   3 * count floats (count = number of points in the tree)
+/// @param outCurvature count floats, or NULL to skip curvature
+/// @return Number of points with a valid normal, or -1 on bad arguments
+int32_t OCCTKDTreeEstimateNormals(OCCTKDTreeRef _Nonnull tree, int32_t k,
+                                  const double* _Nullable viewpoint,
+                                  float* _Nonnull outNormals,
+                                  float* _Nullable outCurvature);
+
+/// Statistical outlier removal: computes each point's mean distance to its k nearest
+/// neighbours, then marks as inlier (1) every point whose mean is within
+/// `stdRatio` standard deviations of the global mean; outliers get 0.
+/// @param outInlierMask count bytes
+/// @return Number of inliers, or -1 on bad arguments
+int32_t OCCTKDTreeStatisticalOutliers(OCCTKDTreeRef _Nonnull tree, int32_t k, double stdRatio,
+                                      uint8_t* _Nonnull outInlierMask);
+
+/// Voxel-grid downsampling: bins points into cubes of edge `voxelSize` and writes the
+/// centroid of each occupied voxel. Output order follows the first point that hit each
+/// voxel, so it is deterministic for a given input.
+/// @param coords     3 * count doubles
+/// @param outCoords  3 * count floats (worst case: every point in its own voxel)
+/// @param outVoxelOfPoint count int32s receiving the output index of each input point, or NULL
+/// @return Number of voxels written, or -1 on bad arguments
+int32_t OCCTPointSetVoxelDownsample(const double* _Nonnull coords, int32_t count,
+                                    double voxelSize,
+                                    float* _Nonnull outCoords,
+                                    int32_t* _Nullable outVoxelOfPoint);
+
+// MARK: - Dynamic AABB Tree (broad-phase box queries)
+//
+// Incrementally updatable bounding-volume hierarchy for moving parts (the static
+// Bnd_BoundSortBox above has to be rebuilt whenever a box changes). Each item is a
+// *proxy* with a dense, stable int32 id; the tree stores a "fat" box (tight box grown by
+// `margin`) so small motions don't touch the hierarchy. Queries test the tight boxes.
+// Boxes are 6 doubles: xmin, ymin, zmin, xmax, ymax, zmax.
+
+/// Opaque handle to a dynamic AABB tree.
+typedef struct OCCTAABBTree* OCCTAABBTreeRef;
+
+/// Create an empty tree. `margin` (≥ 0) is added on every side of each stored fat box.
+OCCTAABBTreeRef _Nullable OCCTAABBTreeCreate(double margin);
+
+/// Create a tree from `count` boxes (6 doubles each). Proxy i is box i.
+/// Returns NULL on bad arguments or if any box has min > max.
+OCCTAABBTreeRef _Nullable OCCTAABBTreeCreateFromBoxes(const double* _Nonnull boxes, int32_t count,
+                                                      double margin);
+
+/// Create a tree from the bounding boxes of `count` shapes, computed in parallel
+/// (BRepBndLib::Add; `useTriangulation` reuses existing meshes when present).
+/// Proxy i is shape i. NULL or empty shapes reserve their id but get no proxy, so
+/// queries never return them. Returns NULL on bad arguments.
+OCCTAABBTreeRef _Nullable OCCTAABBTreeCreateFromShapes(const OCCTShapeRef _Nullable * _Nonnull shapes,
+                                                       int32_t count, double margin,
+                                                       bool useTriangulation);
+
+/// Release a tree.
+void OCCTAABBTreeRelease(OCCTAABBTreeRef _Nonnull tree);
+
+/// Insert a box. Returns its proxy id (ids of removed proxies are reused), or -1 on error.
+int32_t OCCTAABBTreeInsert(OCCTAABBTreeRef _Nonnull tree, const double* _Nonnull box);
+
+/// Remove a proxy. Returns false if the id is not live.
+bool OCCTAABBTreeRemove(OCCTAABBTreeRef _Nonnull tree, int32_t proxy);
+
+/// Replace a proxy's tight box. The hierarchy is only touched when the new box leaves
+/// the stored fat box.
+/// @return 1 if the proxy was re-inserted, 0 if its fat box still contains the new box,
+///         -1 if the id is not live or the box is invalid
+int32_t OCCTAABBTreeUpdate(OCCTAABBTreeRef _Nonnull tree, int32_t proxy, const double* _Nonnull box);
+
+/// One past the highest proxy id ever handed out (size for per-proxy arrays).
+int32_t OCCTAABBTreeProxyCapacity(OCCTAABBTreeRef _Nonnull tree);
+
+/// Number of live proxies.
+int32_t OCCTAABBTreeCount(OCCTAABBTreeRef _Nonnull tree);
+
+/// Height of the hierarchy (0 for a single leaf, -1 when empty).
+int32_t OCCTAABBTreeHeight(OCCTAABBTreeRef _Nonnull tree);
+
+/// Copy a live proxy's tight box into outBox (6 doubles). Returns false if not live.
+bool OCCTAABBTreeGetBox(OCCTAABBTreeRef _Nonnull tree, int32_t proxy, double* _Nonnull outBox);
+
+/// Proxies whose tight box overlaps `box`.
+/// @return Total number of hits; only the first `maxResults` are written, so a result
+///         larger than `maxResults` means the buffer was too small.
+int32_t OCCTAABBTreeQueryBox(OCCTAABBTreeRef _Nonnull tree, const double* _Nonnull box,
+                             int32_t* _Nonnull outProxies, int32_t maxResults);
+
+/// Proxies whose tight box is hit by the segment origin + t·dir, t ∈ [0, maxDistance]
+/// (dir need not be normalized; t is in units of |dir|). Hits are sorted by entry
+/// parameter, written to outProxies and (if non-null) outEntryT.
+/// @return Total number of hits (see OCCTAABBTreeQueryBox for truncation)
+int32_t OCCTAABBTreeQueryRay(OCCTAABBTreeRef _Nonnull tree,
+                             double ox, double oy, double oz,
+                             double dx, double dy, double dz,
+                             double maxDistance,
+                             int32_t* _Nonnull outProxies, double* _Nullable outEntryT,
+                             int32_t maxResults);
+
+/// Find every pair of live proxies with overlapping tight boxes (each pair once, a < b),
+/// traversing the tree for each proxy in parallel. The result is cached on the tree in
+/// CSR form; fetch it with OCCTAABBTreeGetPairs.
+/// @return Number of pairs, or -1 on error
+int32_t OCCTAABBTreeComputePairs(OCCTAABBTreeRef _Nonnull tree, bool parallel);
+
+/// Copy the pairs from the last OCCTAABBTreeComputePairs in CSR form: the partners of
+/// proxy a (all > a) are outPartners[outOffsets[a] ..< outOffsets[a+1]].
+/// @param outOffsets  OCCTAABBTreeProxyCapacity() + 1 int32s (capacity at compute time)
+/// @param outPartners pair-count int32s
+/// @return false if no pairs have been computed since the last edit
+bool OCCTAABBTreeGetPairs(OCCTAABBTreeRef _Nonnull tree,
+                          int32_t* _Nonnull outOffsets, int32_t* _Nonnull outPartners);
+
+// MARK: - Assembly Interference & Clearance Engine
+//
+// All-pairs interference / clearance check over N shapes. The engine meshes every shape
+// once (one parallel BRepMesh pass over the whole set) and caches AABBs and OBBs; each
+// Run() then does broad phase (dynamic AABB tree + optional OBB filter), mid phase
+// (BRepExtrema_ShapeProximity on the cached triangulations) and optional exact
+// refinement (BRepExtrema_DistShapeShape), with the per-pair work in parallel.
+
+/// Opaque handle to an interference engine.
+typedef struct OCCTInterferenceEngine* OCCTInterferenceEngineRef;
+
+/// Kind of a reported pair.
+typedef enum {
+    OCCTInterferenceIntersecting = 1,   ///< Boundaries touch or cross (distance ≈ 0)
+    OCCTInterferenceClearance    = 2,   ///< Apart, but closer than the requested clearance
+    OCCTInterferenceContained    = 3    ///< One shape lies entirely inside the other solid
+} OCCTInterferenceKind;
+
+/// One interfering or under-clearance pair (shape1 < shape2, indices into the input array).
+typedef struct {
+    int32_t shape1;
+    int32_t shape2;
+    int32_t kind;             ///< OCCTInterferenceKind
+    int32_t facePairCount;    ///< Overlapping face pairs found by the mid phase
+    double distance;          ///< Min distance (0 for intersecting / contained)
+    double p1[3];             ///< Witness point on shape1
+    double p2[3];             ///< Witness point on shape2
+    bool exact;               ///< true = BRepExtrema_DistShapeShape; false = mesh-node estimate
+} OCCTInterferencePair;
+
+/// Per-phase counters from the last run.
+typedef struct {
+    int32_t broadPhasePairs;  ///< AABB overlaps (boxes grown by clearance)
+    int32_t obbRejected;      ///< Pairs dropped by the OBB test
+    int32_t midPhasePairs;    ///< Pairs with at least one face pair within tolerance
+    int32_t reportedPairs;
+} OCCTInterferenceStats;
+
+/// Create an engine over `count` shapes. Every shape is triangulated with `deflection`
+/// (existing finer meshes are kept) and bounded once. NULL entries are ignored.
+/// Returns NULL on bad arguments.
+OCCTInterferenceEngineRef _Nullable OCCTInterferenceEngineCreate(
+    const OCCTShapeRef _Nullable * _Nonnull shapes, int32_t count, double deflection);
+
+/// Release an engine.
+void OCCTInterferenceEngineRelease(OCCTInterferenceEngineRef _Nonnull engine);
+
+/// Find every pair that intersects, is contained, or is closer than `clearance` (≥ 0).
+/// @param exact    Refine each mid-phase hit with BRepExtrema_DistShapeShape on the
+///                 overlapping faces; otherwise distance/witnesses come from the mesh nodes
+/// @param useOBB   Add an oriented-bounding-box test after the AABB broad phase
+/// @param parallel Run pair tasks on OCCT's thread pool
+/// @return Number of reported pairs, or -1 on error. Results are kept on the engine.
+int32_t OCCTInterferenceEngineRun(OCCTInterferenceEngineRef _Nonnull engine, double clearance,
+                                  bool exact, bool useOBB, bool parallel);
+
+/// Copy up to maxPairs results of the last run (sorted by shape1, shape2).
+/// @return Number of pairs written
+int32_t OCCTInterferenceEngineGetPairs(OCCTInterferenceEngineRef _Nonnull engine,
+                                       OCCTInterferencePair* _Nonnull outPairs, int32_t maxPairs);
+
+/// Counters from the last run.
+OCCTInterferenceStats OCCTInterferenceEngineGetStats(OCCTInterferenceEngineRef _Nonnull engine);
+
+// MARK: - Cached Solid Classifier (batch point-in-solid)
+//
+// OCCTShapeClassifyPoint builds a BRepClass3d_SolidExplorer (face bounding-box tree,
+// face intersectors) per call. The classifier handle keeps a small pool of explorers
+// built once for the shape, one per worker, and reuses them across calls and batches.
+// With a mesh deflection it also builds a ray-parity index over the closed triangulation;
+// points the mesh can't decide (near the surface, ray through a mesh edge) fall back to
+// the exact classifier, so the batch result matches the exact one.
+
+/// Opaque handle to a cached solid classifier.
+typedef struct OCCTSolidClassifier* OCCTSolidClassifierRef;
+
+/// Create a classifier for `shape` (normally a solid).
+/// @param tolerance      Boundary (ON) tolerance
+/// @param meshDeflection > 0 triangulates the shape (existing finer meshes are kept) and
+///                       enables the ray-parity fast path if the mesh is closed; 0 disables it
+/// @return NULL on bad arguments or failure
+OCCTSolidClassifierRef _Nullable OCCTSolidClassifierCreate(OCCTShapeRef _Nonnull shape,
+                                                           double tolerance, double meshDeflection);
+
+/// Release a classifier.
+void OCCTSolidClassifierRelease(OCCTSolidClassifierRef _Nonnull classifier);
+
+/// Whether the ray-parity fast path is available (closed triangulation was built).
+bool OCCTSolidClassifierHasMeshPath(OCCTSolidClassifierRef _Nonnull classifier);
+
+/// Classify one point with the exact classifier. Safe to call from several threads.
+/// @return 0=IN, 1=OUT, 2=ON, 3=UNKNOWN
+OCCTTopAbsState OCCTSolidClassifierClassify(OCCTSolidClassifierRef _Nonnull classifier,
+                                            double px, double py, double pz);
+
+/// Classify `count` points (xyz triples) into outStates (one OCCTTopAbsState each).
+/// @param useMesh  Try the ray-parity fast path first (ignored without a mesh path)
+/// @param parallel Split the points over OCCT's thread pool
+/// @return Number of points decided by the fast path, or -1 on error
+int32_t OCCTSolidClassifierClassifyPoints(OCCTSolidClassifierRef _Nonnull classifier,
+                                          const double* _Nonnull coords, int32_t count,
+                                          OCCTTopAbsState* _Nonnull outStates,
+                                          bool useMesh, bool parallel);
+
+// MARK: - Voxelization & Signed Distance Field
+//
+// Dense voxel grid of a solid at a chosen resolution. Face triangulations are rasterised
+// into per-slice distance buckets in parallel, the outside is flood-filled from the
+// padded border, and only the thin shell of voxels touching the mesh is classified with
+// the exact (cached) solid classifier. Each voxel also gets a narrow-band signed distance
+// to the mesh (negative inside, clamped to ±max(bandWidth, √3/2)·voxelSize).
+//
+// Voxel (i, j, k) has centre origin + (i + ½, j + ½, k + ½)·voxelSize and linear index
+// i + nx·(j + ny·k).
+
+/// Opaque handle to a voxel grid.
+typedef struct OCCTVoxelGrid* OCCTVoxelGridRef;
+
+/// Voxelize a solid.
+/// @param voxelSize  Edge length of a voxel (> 0)
+/// @param padding    Empty voxels added around the shape's box on every side (≥ 1 is enforced)
+/// @param bandWidth  Narrow-band half-width in voxels for the SDF (values beyond are clamped)
+/// @param deflection Mesh deflection; ≤ 0 uses voxelSize / 4 (capped at voxelSize / 2)
+/// @param parallel   Rasterise slices and classify shell voxels on OCCT's thread pool
+/// @return NULL on bad arguments, a missing triangulation, or more than 2^27 voxels
+OCCTVoxelGridRef _Nullable OCCTVoxelGridCreate(OCCTShapeRef _Nonnull shape, double voxelSize,
+                                               int32_t padding, double bandWidth,
+                                               double deflection, bool parallel);
+
+/// Release a voxel grid.
+void OCCTVoxelGridRelease(OCCTVoxelGridRef _Nonnull grid);
+
+/// Grid dimensions, origin (min corner, 3 doubles) and voxel size.
+void OCCTVoxelGridGetInfo(OCCTVoxelGridRef _Nonnull grid,
+                          int32_t* _Nonnull nx, int32_t* _Nonnull ny, int32_t* _Nonnull nz,
+                          double* _Nonnull origin, double* _Nonnull voxelSize);
+
+/// Number of occupied (inside or on-boundary) voxels.
+int64_t OCCTVoxelGridOccupiedCount(OCCTVoxelGridRef _Nonnull grid);
+
+/// Whether voxel (i, j, k) is occupied (false out of range).
+bool OCCTVoxelGridIsOccupied(OCCTVoxelGridRef _Nonnull grid, int32_t i, int32_t j, int32_t k);
+
+/// Copy the bit-packed occupancy: bit (index & 7) of byte (index >> 3), LSB first.
+/// @param outBits  Buffer of at least (nx·ny·nz + 7) / 8 bytes, or NULL to query the size
+/// @return Number of bytes in the packed grid
+int64_t OCCTVoxelGridGetOccupancy(OCCTVoxelGridRef _Nonnull grid, uint8_t* _Nullable outBits);
+
+/// Copy the signed distance field (nx·ny·nz floats, negative inside).
+void OCCTVoxelGridGetSDF(OCCTVoxelGridRef _Nonnull grid, float* _Nonnull outValues);
+
+// MARK: - Batched Point Projection
+//
+// Closest point on a shape for many query points. The shape is meshed once and its face
+// triangles go into a BVH; per point the BVH picks the faces whose mesh can still hold the
+// closest point, then each candidate is solved exactly with an Extrema_GenExtPS that every
+// worker initialises once per face and reuses. If the surface minimum lies outside the
+// trimmed face, the face's boundary edges are used instead.
+
+/// Opaque handle to a reusable point projector.
+typedef struct OCCTShapeProjector* OCCTShapeProjectorRef;
+
+/// Projection of one query point.
+typedef struct {
+    double distance;    ///< -1 if not found
+    int32_t face;       ///< Face index (index-map order), -1 if not found
+    int32_t status;     ///< 0 = inside the face, 1 = on its boundary, -1 = not found
+    double u, v;        ///< Surface parameters of the foot point
+    double x, y, z;     ///< Foot point
+} OCCTPointProjection;
+
+/// Mesh the shape and build the projector.
+/// @param deflection Linear deflection for the candidate mesh (≤ 0: 0.5% of the bbox diagonal)
+/// @return NULL if the shape has no faces or meshing fails
+OCCTShapeProjectorRef _Nullable OCCTShapeProjectorCreate(OCCTShapeRef _Nonnull shape, double deflection);
+
+void OCCTShapeProjectorRelease(OCCTShapeProjectorRef _Nonnull projector);
+
+/// Number of faces of the projected shape.
+int32_t OCCTShapeProjectorFaceCount(OCCTShapeProjectorRef _Nonnull projector);
+
+/// Project `count` points (xyz triples).
+/// @param maxDistance Points farther than this get status -1 (≤ 0: unlimited)
+/// @param outResults `count` entries
+/// @return Number of points projected, or -1 on error
+int32_t OCCTShapeProjectorProject(OCCTShapeProjectorRef _Nonnull projector,
+                                  const double* _Nonnull coords, int32_t count,
+                                  double maxDistance,
+                                  OCCTPointProjection* _Nonnull outResults, bool parallel);
+
+// MARK: - Reusable Shape-Shape Distance
+//
+// Minimum distance between two fixed shapes under many relative placements (motion
+// planning, clearance sweeps). Both shapes are meshed and bounded once. Each query
+// places shape 2 with a rigid transform, runs a dual triangle-BVH traversal to get the
+// mesh distance per face pair, and only calls BRepExtrema_DistShapeShape on face pairs
+// whose mesh distance can still beat the best exact distance found. "Closer than?"
+// queries stop as soon as the mesh bound decides the answer.
+//
+// Transforms are row-major 3×4 (as OCCTShapeLocated) and apply to shape 2 in shape 1's
+// frame; NULL means identity. Only faces take part, so wire/vertex-only shapes are rejected.
+
+/// Opaque handle to a distance engine.
+typedef struct OCCTDistanceEngine* OCCTDistanceEngineRef;
+
+/// Result of one distance query; points are in shape 1's frame.
+typedef struct {
+    double distance;              ///< -1 on failure
+    int32_t face1, face2;         ///< Supporting face indices (index-map order)
+    double x1, y1, z1;            ///< Closest point on shape 1
+    double x2, y2, z2;            ///< Closest point on placed shape 2
+} OCCTDistanceResult;
+
+/// Counters accumulated over the engine's lifetime.
+typedef struct {
+    int64_t queries;
+    int64_t decidedByMesh;        ///< Threshold queries answered without exact extrema
+    int64_t exactFacePairs;       ///< Face pairs sent to BRepExtrema_DistShapeShape
+} OCCTDistanceEngineStats;
+
+/// Mesh and bound both shapes.
+/// @param deflection Mesh deflection (≤ 0: 0.5% of each shape's bbox diagonal)
+/// @return NULL if either shape has no faces
+OCCTDistanceEngineRef _Nullable OCCTDistanceEngineCreate(OCCTShapeRef _Nonnull shape1,
+                                                         OCCTShapeRef _Nonnull shape2,
+                                                         double deflection);
+
+void OCCTDistanceEngineRelease(OCCTDistanceEngineRef _Nonnull engine);
+
+/// Exact minimum distance with shape 2 placed by `matrix12`.
+/// @return false if the transform is not rigid or extrema failed
+bool OCCTDistanceEngineCompute(OCCTDistanceEngineRef _Nonnull engine, const double* _Nullable matrix12,
+                               OCCTDistanceResult* _Nonnull outResult);
+
+/// Whether the placed shapes are closer than `threshold` (> 0).
+/// @return 1 = closer, 0 = not closer, -1 = error
+int32_t OCCTDistanceEngineIsCloserThan(OCCTDistanceEngineRef _Nonnull engine,
+                                       const double* _Nullable matrix12, double threshold);
+
+/// Distances for `count` placements (12 doubles each), optionally in parallel.
+/// @param outDistances `count` entries, -1 where a query failed
+/// @return Number of successful queries, or -1 on bad arguments
+int32_t OCCTDistanceEngineComputeBatch(OCCTDistanceEngineRef _Nonnull engine,
+                                       const double* _Nonnull matrices, int32_t count,
+                                       double* _Nonnull outDistances, bool parallel);
+
+OCCTDistanceEngineStats OCCTDistanceEngineGetStats(OCCTDistanceEngineRef _Nonnull engine);
+
+// MARK: - Preview Mesh Boolean
+//
+// Approximate booleans on triangles for interactive feedback (dragging a tool over a
+// part), with the exact B-Rep boolean left for the final placement. Both solids are
+// meshed once, and each mesh gets a ray-parity grid and a triangle BVH. Each query places
+// the tool with a rigid transform and classifies every triangle of each mesh against
+// the other. Triangles outside the other mesh's box are culled without a test.
+// Triangles that cross the other surface are split (1 → 4) a few times, and each piece
+// is classified at its centroid. The result is a triangle soup, not a
+// watertight mesh, and its boundary is only as accurate as the refinement allows.
+//
+// Transforms are row-major 3×4 (as OCCTShapeLocated) and place the tool in the object's
+// frame; NULL means identity. In the result, faceIndices below the object's face count
+// are object faces (index-map order); tool face j appears as objectFaceCount + j.
+
+/// Opaque handle to a preview boolean engine.
+typedef struct OCCTPreviewBoolean* OCCTPreviewBooleanRef;
+
+/// Counters accumulated over the engine's lifetime.
+typedef struct {
+    int64_t queries;
+    int64_t trianglesCulled;      ///< Decided by the box test alone
+    int64_t trianglesClassified;  ///< Classified whole at their centroid
+    int64_t trianglesSplit;       ///< Crossed the other surface and were refined
+} OCCTPreviewBooleanStats;
+
+/// Mesh and index both solids.
+/// @param deflection Mesh deflection (≤ 0: 0.5% of each shape's bbox diagonal)
+/// @return NULL unless both shapes mesh into closed triangle sets
+OCCTPreviewBooleanRef _Nullable OCCTPreviewBooleanCreate(OCCTShapeRef _Nonnull object,
+                                                         OCCTShapeRef _Nonnull tool,
+                                                         double deflection);
+
+void OCCTPreviewBooleanRelease(OCCTPreviewBooleanRef _Nonnull engine);
+
+/// Number of faces of the object; tool face indices in results start here.
+int32_t OCCTPreviewBooleanObjectFaceCount(OCCTPreviewBooleanRef _Nonnull engine);
+
+/// Approximate `object op tool` with the tool placed by `matrix12`.
+/// @param op OCCTBooleanOpFuse, OCCTBooleanOpCommon, OCCTBooleanOpCut or OCCTBooleanOpCutReversed
+/// @param refinement Split levels for triangles crossing the other surface (0–4)
+/// @param parallel Classify triangles on OCCT's thread pool
+/// @return Mesh in the object's frame, or NULL if the op is unsupported or the transform is not rigid
+OCCTMeshRef _Nullable OCCTPreviewBooleanCompute(OCCTPreviewBooleanRef _Nonnull engine, OCCTBooleanOp op,
+                                                const double* _Nullable matrix12, int32_t refinement,
+                                                bool parallel);
+
+OCCTPreviewBooleanStats OCCTPreviewBooleanGetStats(OCCTPreviewBooleanRef _Nonnull engine);
+
+// MARK: - Sub-Shape Index Cache
+//
+// Index-based calls (sub-shape i of a type, edge/face adjacency, fillet/chamfer by edge
+// index, …) share one lazily built set of TopExp index maps per OCCTShapeRef instead of
+// rebuilding a map per call. The cache is dropped when the handle is released or mutated
+// in place (OCCTShapeSetOrientation, OCCTShapeSetLocation).
+
+/// Bytes currently held by all shapes' index caches (estimate).
+int64_t OCCTShapeIndexCacheBytes(void);
+
+/// Bytes held by one shape's index cache (estimate; 0 if nothing is cached).
+int64_t OCCTShapeIndexCacheBytesForShape(OCCTShapeRef _Nonnull shape);
+
+/// Free one shape's index cache; it is rebuilt on the next index-based call.
+void OCCTShapeIndexCacheDrop(OCCTShapeRef _Nonnull shape);
+
+// MARK: - Bulk Topology Export
+//
+// Whole-shape topology as flat integer tables in one call, instead of one bridge call and
+// one heap wrapper per face/wire/edge/vertex. Indices are 0-based positions in the shape's
+// IndexedMaps (the same indices as OCCTShapeGetFaceAtIndex and the other index-based
+// calls). One-to-many relations use CSR: the entries of item i are
+// values[offsets[i] ..< offsets[i + 1]].
+
+/// Opaque handle to an exported topology table set.
+typedef struct OCCTTopologyTables* OCCTTopologyTablesRef;
+
+/// Integer tables held by OCCTTopologyTablesRef.
+typedef enum {
+    OCCTTopologyTableFaceWireOffsets = 0,      ///< faceCount + 1
+    OCCTTopologyTableFaceWires,                ///< wire indices, outer wire first
+    OCCTTopologyTableWireEdgeOffsets,          ///< wireCount + 1
+    OCCTTopologyTableWireEdges,                ///< edge indices in stored order
+    OCCTTopologyTableWireEdgeOrientations,     ///< TopAbs_Orientation per WireEdges entry
+    OCCTTopologyTableEdgeVertices,             ///< 2·edgeCount: first, last (-1 if none)
+    OCCTTopologyTableEdgeFaceOffsets,          ///< edgeCount + 1
+    OCCTTopologyTableEdgeFaces,                ///< face indices
+    OCCTTopologyTableVertexEdgeOffsets,        ///< vertexCount + 1
+    OCCTTopologyTableVertexEdges,              ///< edge indices
+    OCCTTopologyTableCount
+} OCCTTopologyTable;
+
+/// Export a shape's face/wire/edge/vertex topology.
+/// @return NULL on failure; release with OCCTTopologyTablesRelease
+OCCTTopologyTablesRef _Nullable OCCTShapeExportTopology(OCCTShapeRef _Nonnull shape);
+
+/// Release exported tables.
+void OCCTTopologyTablesRelease(OCCTTopologyTablesRef _Nonnull topo);
+
+/// Number of faces, wires, edges and vertices (each output may be NULL).
+void OCCTTopologyTablesGetCounts(OCCTTopologyTablesRef _Nonnull topo,
+                                 int32_t* _Nullable outFaces, int32_t* _Nullable outWires,
+                                 int32_t* _Nullable outEdges, int32_t* _Nullable outVertices);
+
+/// Copy one table.
+/// @param outValues Buffer of at least the returned length, or NULL to query it
+/// @return Table length, or -1 for an unknown table
+int32_t OCCTTopologyTablesGet(OCCTTopologyTablesRef _Nonnull topo, OCCTTopologyTable table,
+                              int32_t* _Nullable outValues);
+
+/// Copy vertex coordinates (3·vertexCount doubles, xyz interleaved).
+void OCCTTopologyTablesGetVertexCoords(OCCTTopologyTablesRef _Nonnull topo, double* _Nonnull outCoords);
+
+// MARK: - Wrapper Pooling
+//
+// OCCTShapeRef, OCCTFaceRef, OCCTEdgeRef and OCCTWireRef wrappers are recycled through
+// per-thread free lists instead of a malloc/free per handle. Releasing is unchanged
+// (the usual *Release calls); the array forms below free a whole batch in one call.
+
+/// Release every non-NULL shape in an array (the array itself is not freed).
+void OCCTShapeReleaseArray(OCCTShapeRef _Nullable * _Nonnull shapes, int32_t count);
+
+/// Release every non-NULL edge in an array (the array itself is not freed).
+void OCCTEdgeReleaseArray(OCCTEdgeRef _Nullable * _Nonnull edges, int32_t count);
+
+/// Release every non-NULL wire in an array (the array itself is not freed).
+void OCCTWireReleaseArray(OCCTWireRef _Nullable * _Nonnull wires, int32_t count);
+
+/// Return the calling thread's cached wrapper blocks to the heap.
+void OCCTWrapperPoolTrim(void);
+
+/// Wrapper allocation counters since process start. Only counted in builds with
+/// OCCT_WRAPPER_POOL_STATS defined (OCCTSWIFT_POOL_STATS=1); otherwise returns false and leaves the
+/// outputs untouched.
+/// @param outAllocations Wrapper allocations
+/// @param outPoolHits    Allocations served from a free list
+/// @param outReleases    Wrapper releases
+bool OCCTWrapperPoolGetStats(int64_t* _Nullable outAllocations, int64_t* _Nullable outPoolHits,
+                             int64_t* _Nullable outReleases);
+
+// MARK: - Parallel Per-Face / Per-Edge Queries
+//
+// Run selected built-in query kernels over every face (or edge) of a shape in one call,
+// on OCCT's thread pool. Results land in typed records, one per sub-shape, in the same
+// 0-based order as OCCTShapeGetFaceAtIndex / the edge index map. Each worker builds its
+// own adaptors, so faces sharing a BSpline surface never share an evaluation cache.
+
+/// Face query kernels (bit mask).
+typedef enum {
+    OCCTFaceQuerySurfaceType = 1 << 0,  ///< surfaceType (OCCTFaceGetSurfaceType codes)
+    OCCTFaceQueryUVBounds    = 1 << 1,  ///< uMin…vMax (BRepTools::UVBounds)
+    OCCTFaceQueryArea        = 1 << 2,  ///< area
+    OCCTFaceQueryNormal      = 1 << 3,  ///< point + oriented normal at the UV-box centre
+    OCCTFaceQueryCurvature   = 1 << 4,  ///< min/max principal curvature over a 5×5 UV grid
+    OCCTFaceQueryAxis        = 1 << 5,  ///< primary axis (OCCTFaceGetPrimaryAxis kinds)
+    OCCTFaceQueryTolerance   = 1 << 6,  ///< BRep tolerance
+    OCCTFaceQueryAll         = 0x7F
+} OCCTFaceQuery;
+
+/// Per-face query result. Fields of kernels not requested, or that failed, are zero,
+/// except surfaceType, which is then 10 ("other"). Check `valid` before reading a field.
+typedef struct {
+    uint32_t valid;                 ///< OCCTFaceQuery bits that produced a value
+    int32_t surfaceType;
+    double uMin, uMax, vMin, vMax;
+    double area;
+    double px, py, pz;              ///< surface point at the UV-box centre
+    double nx, ny, nz;              ///< unit normal there, face orientation applied
+    double minCurvature, maxCurvature;
+    int32_t axisKind;               ///< 0 = none, 1 cylinder … 6 extrusion
+    double ox, oy, oz;              ///< axis origin
+    double dx, dy, dz;              ///< axis direction
+    double tolerance;
+} OCCTFaceQueryResult;
+
+/// Run face query kernels over all faces of a shape.
+/// @param queries       OCCTFaceQuery bits
+/// @param areaTolerance Relative tolerance for the area integration
+/// @param outResults    faceCount records, or NULL to query the count
+/// @param parallel      Spread faces over OCCT's thread pool
+/// @return Face count, or -1 on failure
+int32_t OCCTShapeQueryFaces(OCCTShapeRef _Nonnull shape, uint32_t queries, double areaTolerance,
+                            OCCTFaceQueryResult* _Nullable outResults, bool parallel);
+
+/// Edge query kernels (bit mask).
+typedef enum {
+    OCCTEdgeQueryCurveType = 1 << 0,   ///< curveType (OCCTEdgeGetCurveType codes)
+    OCCTEdgeQueryRange     = 1 << 1,   ///< first/last parameter
+    OCCTEdgeQueryLength    = 1 << 2,   ///< arc length
+    OCCTEdgeQueryPoints    = 1 << 3,   ///< start, end, midpoint and unit tangent at the midpoint
+    OCCTEdgeQueryTolerance = 1 << 4,   ///< BRep tolerance
+    OCCTEdgeQueryAll       = 0x1F
+} OCCTEdgeQuery;
+
+/// Per-edge query result. Degenerated edges only report tolerance. Fields of kernels
+/// not requested, or that failed, are zero, except curveType, which is then 8 ("other");
+/// isDegenerated is always set.
+typedef struct {
+    uint32_t valid;                 ///< OCCTEdgeQuery bits that produced a value
+    int32_t curveType;
+    bool isDegenerated;
+    double first, last;
+    double length;
+    double sx, sy, sz;              ///< start point
+    double ex, ey, ez;              ///< end point
+    double mx, my, mz;              ///< midpoint (parameter-wise)
+    double tx, ty, tz;              ///< unit tangent at the midpoint
+    double tolerance;
+} OCCTEdgeQueryResult;
+
+/// Run edge query kernels over all edges of a shape.
+/// @param queries    OCCTEdgeQuery bits
+/// @param outResults edgeCount records, or NULL to query the count
+/// @param parallel   Spread edges over OCCT's thread pool
+/// @return Edge count, or -1 on failure
+int32_t OCCTShapeQueryEdges(OCCTShapeRef _Nonnull shape, uint32_t queries,
+                            OCCTEdgeQueryResult* _Nullable outResults, bool parallel);
+
+// MARK: - Batch Bounding Volumes
+//
+// AABB, optimal AABB and OBB for many shapes in one parallel call (nesting, packing,
+// broad phases). Existing triangulations are used when `useTriangulation` is set.
+
+/// Bounding volumes to compute (bitmask).
+typedef enum {
+    OCCTBoundingVolumeAABB        = 1 << 0,   ///< BRepBndLib::Add
+    OCCTBoundingVolumeOptimalAABB = 1 << 1,   ///< BRepBndLib::AddOptimal (tight, slower)
+    OCCTBoundingVolumeOBB         = 1 << 2,
+    OCCTBoundingVolumeAll         = 0x7
+} OCCTBoundingVolume;
+
+/// How OBBs are computed.
+typedef enum {
+    OCCTOBBModePCA     = 0,   ///< BRepBndLib::AddOBB, non-optimal (PCA)
+    OCCTOBBModeOptimal = 1,   ///< BRepBndLib::AddOBB with the optimal search
+    /// Optimal search over the convex-hull extremes of the mesh nodes only, extents
+    /// refit over all nodes. Falls back to PCA for shapes without a mesh.
+    OCCTOBBModeHull    = 2
+} OCCTOBBMode;
+
+/// Bounding volumes of one shape.
+typedef struct {
+    uint32_t valid;                         ///< OCCTBoundingVolume bits that were computed
+    double aabbMin[3], aabbMax[3];
+    double optimalMin[3], optimalMax[3];
+    OCCTOrientedBoundingBox obb;
+} OCCTBoundingVolumes;
+
+/// Compute bounding volumes for `count` shapes (NULL entries get valid = 0).
+/// @param volumes OCCTBoundingVolume bits
+/// @param out `count` entries
+/// @return Number of shapes with at least one volume, or -1 on bad arguments
+int32_t OCCTShapesComputeBoundingVolumes(const OCCTShapeRef _Nullable * _Nonnull shapes, int32_t count,
+                                         uint32_t volumes, OCCTOBBMode obbMode, bool useTriangulation,
+                                         OCCTBoundingVolumes* _Nonnull out, bool parallel);
+
+// MARK: - Persistent Naming Index
+//
+// Stable IDs for the sub-shapes of a shape that evolves through modelling operations.
+// After each operation, fold its history into the index: modified sub-shapes keep their
+// ID, a split maps one ID to several sub-shapes, a deletion leaves the ID with none, and
+// new sub-shapes get fresh IDs that remember the ID they were generated from. IDs are
+// dense integers starting at 1 (0 = none) and resolve to 0-based sub-shape indices of
+// the current shape (TopExp::MapShapes order, as OCCTShapeGetSubShapeByTypeIndex) by
+// hash lookup.
+//
+// Kinds are TopAbs_ShapeEnum values (4 = face, 6 = edge, 7 = vertex, …).
+
+/// Opaque handle to a naming index.
+typedef struct OCCTNamingIndex* OCCTNamingIndexRef;
+
+/// Assign IDs to every tracked sub-shape of `shape`.
+/// @param kindMask Bit (1 << kind) per tracked kind; 0 = faces, edges and vertices
+OCCTNamingIndexRef _Nullable OCCTNamingIndexCreate(OCCTShapeRef _Nonnull shape, uint32_t kindMask);
+
+void OCCTNamingIndexRelease(OCCTNamingIndexRef _Nonnull index);
+
+/// Advance the index over an operation with a retained builder (boolean / fillet /
+/// chamfer / shell / defeature *WithHistory). `result` becomes the current shape.
+bool OCCTNamingIndexApplyBuilderHistory(OCCTNamingIndexRef _Nonnull index,
+                                        OCCTBooleanHistoryRef _Nonnull history,
+                                        OCCTShapeRef _Nonnull result);
+
+/// Advance the index over a BRepTools_History. `result` becomes the current shape.
+bool OCCTNamingIndexApplyHistory(OCCTNamingIndexRef _Nonnull index, OCCTHistoryRef history,
+                                 OCCTShapeRef _Nonnull result);
+
+/// Number of IDs issued so far (IDs are 1 … count).
+int64_t OCCTNamingIndexIDCount(OCCTNamingIndexRef _Nonnull index);
+
+/// The current shape (caller owns).
+OCCTShapeRef _Nullable OCCTNamingIndexCurrentShape(OCCTNamingIndexRef _Nonnull index);
+
+/// Kind of an ID, or -1 if unknown.
+int32_t OCCTNamingIndexKindOf(OCCTNamingIndexRef _Nonnull index, int64_t id);
+
+/// ID that `id` was generated from, or 0.
+int64_t OCCTNamingIndexParentOf(OCCTNamingIndexRef _Nonnull index, int64_t id);
+
+/// Current sub-shape indices of an ID (several after a split, none once deleted).
+/// @param outIndices Up to maxCount indices, or NULL to query the count
+/// @return Number of current sub-shapes, or -1 if the ID is unknown
+int32_t OCCTNamingIndexResolve(OCCTNamingIndexRef _Nonnull index, int64_t id,
+                               int32_t* _Nullable outIndices, int32_t maxCount);
+
+/// Batch resolve: first current sub-shape index per ID (-1 if deleted or unknown).
+/// @return Number of IDs resolved
+int32_t OCCTNamingIndexResolveFirst(OCCTNamingIndexRef _Nonnull index, const int64_t* _Nonnull ids,
+                                    int32_t count, int32_t* _Nonnull outIndices);
+
+/// ID of current sub-shape `subIndex` of `kind`, or 0.
+int64_t OCCTNamingIndexIDOf(OCCTNamingIndexRef _Nonnull index, int32_t kind, int32_t subIndex);
+
+/// IDs of all current sub-shapes of `kind`, in index order.
+/// @param outIDs Buffer for the IDs, or NULL to query the count
+/// @return Number of sub-shapes of that kind, or -1 on error
+int32_t OCCTNamingIndexIDsOfKind(OCCTNamingIndexRef _Nonnull index, int32_t kind, int64_t* _Nullable outIDs);
+
+// MARK: - Feature Tool Bodies
+
+/// Kind of tool body built by OCCTFeatureToolsBuild.
+typedef enum {
+    OCCTFeatureToolExtrusion = 0,   ///< OCCTShapeCreateExtrusion(profile, direction, extent)
+    OCCTFeatureToolRevolution = 1,  ///< OCCTShapeCreateRevolution(profile, origin, direction, extent)
+    OCCTFeatureToolCylinder = 2     ///< OCCTShapeCreateCylinderOriented(origin, direction, radius, extent)
+} OCCTFeatureToolKind;
+
+/// One feature tool body.
+typedef struct {
+    OCCTFeatureToolKind kind;
+    OCCTWireRef _Nullable profile;  ///< Extrusion / revolution profile
+    double origin[3];               ///< Revolution axis point; cylinder base centre
+    double direction[3];            ///< Extrusion direction; revolution / cylinder axis
+    double extent;                  ///< Extrusion length; revolution angle (radians); cylinder height
+    double radius;                  ///< Cylinder radius
+} OCCTFeatureTool;
+
+/// Build independent feature tool bodies in one call, spread over OCCT's thread pool.
+/// A profile wire listed more than once is copied for every reuse, so no two threads
+/// touch the same topology.
+/// @param outShapes `count` slots; failed tools are left NULL. Caller owns the results.
+/// @return Number of tools built
+int32_t OCCTFeatureToolsBuild(const OCCTFeatureTool* _Nonnull tools, int32_t count,
+                              OCCTShapeRef _Nullable * _Nonnull outShapes, bool parallel);
+
 #ifdef __cplusplus
 }
 #endif
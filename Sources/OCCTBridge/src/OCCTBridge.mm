@@ -432,3 +432,292 @@ bool occtHasSelfIntersectingWire(const TopoDS_Shape& s) {
     return false;
 }
 
+
+// MARK: - Geometric hashing
+
+#include <cmath>
+#include <Geom_Circle.hxx>
+#include <Geom_ConicalSurface.hxx>
+#include <Geom_CylindricalSurface.hxx>
+#include <Geom_Line.hxx>
+#include <Geom_Plane.hxx>
+#include <Geom_RectangularTrimmedSurface.hxx>
+#include <Geom_SphericalSurface.hxx>
+#include <Geom_ToroidalSurface.hxx>
+#include <Geom_TrimmedCurve.hxx>
+
+// Appends quantized components to a key: lengths in cells of linTol, direction
+// components in cells of angTol (a component difference ≈ the angle between them).
+namespace {
+struct GHKeyBuilder {
+    OCCTGeomKey key;
+    int n = 0;
+    double lin, ang;
+
+    GHKeyBuilder(int32_t kind, double linTol, double angTol) : lin(linTol), ang(angTol) { key.kind = kind; }
+
+    void length(double v) { key.q[n++] = (int64_t)std::llround(v / lin); }
+    void angle(double v) { key.q[n++] = (int64_t)std::llround(v / ang); }
+    void point(const gp_XYZ& p) { length(p.X()); length(p.Y()); length(p.Z()); }
+
+    // An axis is only defined up to sign: flip it so the first component clear of zero
+    // is positive. 0.3 keeps the choice away from axis-aligned noise and from the
+    // 0.5 / 0.707 components of common design angles; some component is always ≥ 1/√3.
+    gp_XYZ direction(const gp_Dir& d) {
+        gp_XYZ v = d.XYZ();
+        for (int i = 1; i <= 3; i++) {
+            if (std::abs(v.Coord(i)) > 0.3) {
+                if (v.Coord(i) < 0) v.Reverse();
+                break;
+            }
+        }
+        angle(v.X()); angle(v.Y()); angle(v.Z());
+        return v;
+    }
+
+    // Foot of the perpendicular from the world origin onto the line (loc, dir).
+    static gp_XYZ foot(const gp_XYZ& loc, const gp_XYZ& dir) { return loc - dir * loc.Dot(dir); }
+};
+} // namespace
+
+OCCTGeomKey occtSurfaceKey(const Handle(Geom_Surface)& surface, double linTol, double angTol) {
+    Handle(Geom_Surface) s = surface;
+    while (auto t = Handle(Geom_RectangularTrimmedSurface)::DownCast(s)) s = t->BasisSurface();
+    if (s.IsNull() || linTol <= 0 || angTol <= 0) return OCCTGeomKey();
+
+    if (auto p = Handle(Geom_Plane)::DownCast(s)) {
+        GHKeyBuilder k(1, linTol, angTol);
+        const gp_Pln pln = p->Pln();
+        const gp_XYZ n = k.direction(pln.Axis().Direction());
+        k.length(n.Dot(pln.Location().XYZ()));
+        return k.key;
+    }
+    if (auto c = Handle(Geom_CylindricalSurface)::DownCast(s)) {
+        GHKeyBuilder k(2, linTol, angTol);
+        const gp_Ax1 ax = c->Axis();
+        const gp_XYZ d = k.direction(ax.Direction());
+        k.point(GHKeyBuilder::foot(ax.Location().XYZ(), d));
+        k.length(c->Radius());
+        return k.key;
+    }
+    if (auto c = Handle(Geom_ConicalSurface)::DownCast(s)) {
+        // Cones extend through the apex in both directions, so (apex, axis, |angle|) fixes
+        // the surface regardless of the reference radius and axis sense.
+        GHKeyBuilder k(3, linTol, angTol);
+        k.point(c->Apex().XYZ());
+        k.direction(c->Axis().Direction());
+        k.angle(std::abs(c->SemiAngle()));
+        return k.key;
+    }
+    if (auto sp = Handle(Geom_SphericalSurface)::DownCast(s)) {
+        GHKeyBuilder k(4, linTol, angTol);
+        k.point(sp->Location().XYZ());
+        k.length(sp->Radius());
+        return k.key;
+    }
+    if (auto t = Handle(Geom_ToroidalSurface)::DownCast(s)) {
+        GHKeyBuilder k(5, linTol, angTol);
+        k.point(t->Location().XYZ());
+        k.direction(t->Axis().Direction());
+        k.length(t->MajorRadius());
+        k.length(t->MinorRadius());
+        return k.key;
+    }
+    return OCCTGeomKey();
+}
+
+OCCTGeomKey occtCurveKey(const Handle(Geom_Curve)& curve, double linTol, double angTol) {
+    Handle(Geom_Curve) c = curve;
+    while (auto t = Handle(Geom_TrimmedCurve)::DownCast(c)) c = t->BasisCurve();
+    if (c.IsNull() || linTol <= 0 || angTol <= 0) return OCCTGeomKey();
+
+    if (auto l = Handle(Geom_Line)::DownCast(c)) {
+        GHKeyBuilder k(11, linTol, angTol);
+        const gp_Ax1 ax = l->Position();
+        const gp_XYZ d = k.direction(ax.Direction());
+        k.point(GHKeyBuilder::foot(ax.Location().XYZ(), d));
+        return k.key;
+    }
+    if (auto ci = Handle(Geom_Circle)::DownCast(c)) {
+        GHKeyBuilder k(12, linTol, angTol);
+        k.point(ci->Location().XYZ());
+        k.direction(ci->Axis().Direction());
+        k.length(ci->Radius());
+        return k.key;
+    }
+    return OCCTGeomKey();
+}
+
+bool occtGeomKeySignAmbiguous(const OCCTGeomKey& key, double angTol) {
+    int slot;
+    switch (key.kind) {
+        case 1: case 2: case 11: slot = 0; break;   // axis first
+        case 3: case 5: case 12: slot = 3; break;   // axis after the centre / apex
+        default: return false;                       // spheres have no axis
+    }
+    // Only the first two components can decide the sign; if both are clearly below
+    // 0.3 the third is above 0.9.
+    for (int i = 0; i < 2; i++) {
+        if (std::abs(std::abs((double)key.q[slot + i] * angTol) - 0.3) <= 2.0 * angTol) return true;
+    }
+    return false;
+}
+
+
+// MARK: - OCCTShape sub-shape index cache
+
+#include <memory>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+
+// Index-based entry points (face i, edge j, …) used to run TopExp::MapShapes on every
+// call, so walking all faces from Swift was O(N²). The maps are now built once per
+// OCCTShape and reused until the shape is mutated in place or released.
+struct OCCTShapeIndex {
+    std::mutex mutex;
+    std::unique_ptr<TopTools_IndexedMapOfShape> maps[TopAbs_SHAPE];
+    std::unique_ptr<TopTools_IndexedDataMapOfShapeListOfShape> edgeFaces;
+    std::unique_ptr<TopTools_IndexedDataMapOfShapeListOfShape> vertexEdges;
+    int64_t bytes = 0;
+};
+
+std::atomic<int64_t>& occtShapeIndexBytes() {
+    static std::atomic<int64_t> bytes{0};
+    return bytes;
+}
+
+// Rough per-entry cost: the TopoDS_Shape key (TShape + Location handles, orientation),
+// the node links and the two bucket arrays of an NCollection indexed map.
+static const int64_t kIndexMapEntryBytes = 72;
+static const int64_t kAncestorListEntryBytes = 40;
+
+static void accountIndex(OCCTShapeIndex& index, int64_t bytes) {
+    index.bytes += bytes;
+    occtShapeIndexBytes() += bytes;
+}
+
+static int64_t ancestorMapBytes(const TopTools_IndexedDataMapOfShapeListOfShape& map) {
+    int64_t bytes = (int64_t)map.Extent() * kIndexMapEntryBytes;
+    for (int i = 1; i <= map.Extent(); i++) bytes += (int64_t)map(i).Extent() * kAncestorListEntryBytes;
+    return bytes;
+}
+
+OCCTShapeIndex& OCCTShape::ensureIndex() const {
+    OCCTShapeIndex* index = index_.load(std::memory_order_acquire);
+    if (index) return *index;
+    OCCTShapeIndex* fresh = new OCCTShapeIndex();
+    if (index_.compare_exchange_strong(index, fresh, std::memory_order_acq_rel)) return *fresh;
+    delete fresh;  // another thread won the race; `index` now holds its pointer
+    return *index;
+}
+
+const TopTools_IndexedMapOfShape& OCCTShape::subShapes(TopAbs_ShapeEnum type) const {
+    if (type < TopAbs_COMPOUND || type >= TopAbs_SHAPE) {
+        // Out-of-range type from the C API: behave like MapShapes on an unknown type.
+        static const TopTools_IndexedMapOfShape empty;
+        return empty;
+    }
+    OCCTShapeIndex& index = ensureIndex();
+    std::lock_guard<std::mutex> lock(index.mutex);
+    auto& slot = index.maps[type];
+    if (!slot) {
+        std::unique_ptr<TopTools_IndexedMapOfShape> map(new TopTools_IndexedMapOfShape());
+        TopExp::MapShapes(shape, type, *map);
+        accountIndex(index, (int64_t)map->Extent() * kIndexMapEntryBytes);
+        slot = std::move(map);
+    }
+    return *slot;
+}
+
+const TopTools_IndexedDataMapOfShapeListOfShape& OCCTShape::edgeFaces() const {
+    OCCTShapeIndex& index = ensureIndex();
+    std::lock_guard<std::mutex> lock(index.mutex);
+    if (!index.edgeFaces) {
+        std::unique_ptr<TopTools_IndexedDataMapOfShapeListOfShape> map(new TopTools_IndexedDataMapOfShapeListOfShape());
+        TopExp::MapShapesAndUniqueAncestors(shape, TopAbs_EDGE, TopAbs_FACE, *map);
+        accountIndex(index, ancestorMapBytes(*map));
+        index.edgeFaces = std::move(map);
+    }
+    return *index.edgeFaces;
+}
+
+const TopTools_IndexedDataMapOfShapeListOfShape& OCCTShape::vertexEdges() const {
+    OCCTShapeIndex& index = ensureIndex();
+    std::lock_guard<std::mutex> lock(index.mutex);
+    if (!index.vertexEdges) {
+        std::unique_ptr<TopTools_IndexedDataMapOfShapeListOfShape> map(new TopTools_IndexedDataMapOfShapeListOfShape());
+        TopExp::MapShapesAndUniqueAncestors(shape, TopAbs_VERTEX, TopAbs_EDGE, *map);
+        accountIndex(index, ancestorMapBytes(*map));
+        index.vertexEdges = std::move(map);
+    }
+    return *index.vertexEdges;
+}
+
+void OCCTShape::invalidateIndex() const {
+    OCCTShapeIndex* index = index_.exchange(nullptr, std::memory_order_acq_rel);
+    if (!index) return;
+    occtShapeIndexBytes() -= index->bytes;
+    delete index;
+}
+
+int64_t OCCTShape::indexBytes() const {
+    OCCTShapeIndex* index = index_.load(std::memory_order_acquire);
+    if (!index) return 0;
+    std::lock_guard<std::mutex> lock(index->mutex);
+    return index->bytes;
+}
+
+int64_t OCCTShapeIndexCacheBytes(void) {
+    return occtShapeIndexBytes().load();
+}
+
+int64_t OCCTShapeIndexCacheBytesForShape(OCCTShapeRef shape) {
+    return shape ? shape->indexBytes() : 0;
+}
+
+void OCCTShapeIndexCacheDrop(OCCTShapeRef shape) {
+    if (shape) shape->invalidateIndex();
+}
+
+// MARK: - Wrapper pooling
+
+#ifdef OCCT_WRAPPER_POOL_STATS
+OCCTPoolStats& occtPoolStats() {
+    static OCCTPoolStats stats;
+    return stats;
+}
+#endif
+
+bool OCCTWrapperPoolGetStats(int64_t* outAllocations, int64_t* outPoolHits, int64_t* outReleases) {
+#ifdef OCCT_WRAPPER_POOL_STATS
+    OCCTPoolStats& stats = occtPoolStats();
+    if (outAllocations) *outAllocations = stats.allocations.load(std::memory_order_relaxed);
+    if (outPoolHits) *outPoolHits = stats.poolHits.load(std::memory_order_relaxed);
+    if (outReleases) *outReleases = stats.releases.load(std::memory_order_relaxed);
+    return true;
+#else
+    (void)outAllocations; (void)outPoolHits; (void)outReleases;
+    return false;
+#endif
+}
+
+void OCCTWrapperPoolTrim(void) {
+    occtPoolFlush<sizeof(OCCTShape)>();
+    occtPoolFlush<sizeof(OCCTFace)>();
+    occtPoolFlush<sizeof(OCCTEdge)>();
+    occtPoolFlush<sizeof(OCCTWire)>();
+}
+
+void OCCTShapeReleaseArray(OCCTShapeRef* shapes, int32_t count) {
+    if (!shapes) return;
+    for (int32_t i = 0; i < count; i++) delete shapes[i];
+}
+
+void OCCTEdgeReleaseArray(OCCTEdgeRef* edges, int32_t count) {
+    if (!edges) return;
+    for (int32_t i = 0; i < count; i++) delete edges[i];
+}
+
+void OCCTWireReleaseArray(OCCTWireRef* wires, int32_t count) {
+    if (!wires) return;
+    for (int32_t i = 0; i < count; i++) delete wires[i];
+}
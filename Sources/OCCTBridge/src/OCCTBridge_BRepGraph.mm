@@ -20,6 +20,7 @@
 // OCCTBridge_Internal.h, this block is just the BRepGraph-block extras.
 
 #include <set>
+#include <unordered_set>
 #include <vector>
 #include <TopAbs_Orientation.hxx>
 #include <TopLoc_Location.hxx>
@@ -1215,6 +1216,160 @@ void OCCTBRepGraphFaceSameDomainIndices(OCCTBRepGraphRef g, int32_t faceIndex, i
     try { int i = 0; for (int32_t f : bgSameDomainFaces(g, faceIndex)) out[i++] = f; } catch (...) {}
 }
 
+// --- Geometric hashing ---
+
+// Face surfaces and edge 3D curves in index order; null for removed nodes and curveless
+// edges. Collected serially so the keying pass below touches only Geom objects.
+static void bgCollectGeometry(OCCTBRepGraphRef g, std::vector<occ::handle<Geom_Surface>>& surfaces,
+                              std::vector<occ::handle<Geom_Curve>>& curves) {
+    const auto& gen = g->graph.Topo().Gen();
+    const uint32_t nf = g->graph.Topo().Faces().Nb();
+    surfaces.assign(nf, occ::handle<Geom_Surface>());
+    for (uint32_t f = 0; f < nf; ++f) {
+        if (gen.IsRemoved(BRepGraph_NodeId(BRepGraph_NodeId::Kind::Face, (int)f))) continue;
+        surfaces[f] = BRepGraph_Tool::Face::Surface(g->graph, BRepGraph_FaceId(f));
+    }
+    const uint32_t ne = g->graph.Topo().Edges().Nb();
+    curves.assign(ne, occ::handle<Geom_Curve>());
+    for (uint32_t e = 0; e < ne; ++e) {
+        if (gen.IsRemoved(BRepGraph_NodeId(BRepGraph_NodeId::Kind::Edge, (int)e))) continue;
+        if (!BRepGraph_Tool::Edge::HasCurve(g->graph, BRepGraph_EdgeId(e))) continue;
+        curves[e] = BRepGraph_Tool::Edge::Curve(g->graph, BRepGraph_EdgeId(e));
+    }
+}
+
+template <typename Geom, typename KeyFn>
+static std::vector<OCCTGeomKey> bgGeomKeys(const std::vector<occ::handle<Geom>>& geom, const KeyFn& keyOf,
+                                           double linTol, double angTol, bool parallel) {
+    std::vector<OCCTGeomKey> keys(geom.size());
+    occtParallelChunks((int32_t)geom.size(), [&](int32_t begin, int32_t end) {
+        for (int32_t i = begin; i < end; i++) {
+            try { keys[i] = keyOf(geom[i], linTol, angTol); } catch (...) { keys[i] = OCCTGeomKey(); }
+        }
+    }, parallel);
+    return keys;
+}
+
+// Key holding the first `len` components of `k`, tagged so prefixes of different
+// lengths never collide.
+static OCCTGeomKey bgKeyPrefix(const OCCTGeomKey& k, int len) {
+    OCCTGeomKey p;
+    p.kind = k.kind * 16 + len;
+    std::copy(k.q, k.q + len, p.q);
+    return p;
+}
+
+// Whether some key within one cell per component of `self` (occtGeomKeysNear) belongs
+// to another handle. Walks the 3^8 neighbour cells depth-first and prunes on prefixes no
+// handle has, so an isolated key costs a few lookups per component.
+static bool bgNearKeyExists(OCCTGeomKey& probe, const OCCTGeomKey& self, int depth,
+                            const std::unordered_set<OCCTGeomKey, OCCTGeomKeyHasher>& prefixes,
+                            const std::unordered_map<OCCTGeomKey, int32_t, OCCTGeomKeyHasher>& counts) {
+    if (depth == 8) {
+        const auto it = counts.find(probe);
+        return it != counts.end() && (!(probe == self) || it->second > 1);
+    }
+    const int64_t base = probe.q[depth];
+    bool found = false;
+    for (int64_t d = -1; d <= 1 && !found; d++) {
+        probe.q[depth] = base + d;
+        found = prefixes.count(bgKeyPrefix(probe, depth + 1)) &&
+                bgNearKeyExists(probe, self, depth + 1, prefixes, counts);
+    }
+    probe.q[depth] = base;
+    return found;
+}
+
+// Whether two distinct handles may be duplicates: some handle has no key, an axis sits
+// on the sign-normalization threshold, or two keys are within one cell of each other
+// (equal keys alone miss pairs that straddle a cell edge). `distinct` receives the
+// number of distinct non-null handles.
+template <typename Geom>
+static bool bgMayHaveDuplicates(const std::vector<occ::handle<Geom>>& geom,
+                                const std::vector<OCCTGeomKey>& keys, double angTol, int32_t& distinct) {
+    std::set<const Geom*> seen;
+    std::vector<const OCCTGeomKey*> unique;
+    bool may = false;
+    for (size_t i = 0; i < geom.size(); i++) {
+        const Geom* h = geom[i].get();
+        if (!h || !seen.insert(h).second) continue;
+        if (keys[i].kind == 0 || occtGeomKeySignAmbiguous(keys[i], angTol)) may = true;
+        else unique.push_back(&keys[i]);
+    }
+    distinct = (int32_t)seen.size();
+    if (may) return true;
+
+    std::unordered_map<OCCTGeomKey, int32_t, OCCTGeomKeyHasher> counts;
+    std::unordered_set<OCCTGeomKey, OCCTGeomKeyHasher> prefixes;
+    for (const OCCTGeomKey* k : unique) {
+        counts[*k]++;
+        for (int len = 1; len <= 8; len++) prefixes.insert(bgKeyPrefix(*k, len));
+    }
+    for (const OCCTGeomKey* k : unique) {
+        OCCTGeomKey probe = *k;
+        if (bgNearKeyExists(probe, *k, 0, prefixes, counts)) return true;
+    }
+    return false;
+}
+
+int32_t OCCTBRepGraphHashFaceSurfaces(OCCTBRepGraphRef g, double linearTolerance, double angularTolerance,
+                                      int32_t* outGroups, int32_t* outGroupCount, bool parallel) {
+    if (!g || linearTolerance <= 0 || angularTolerance <= 0) return -1;
+    try {
+        std::vector<occ::handle<Geom_Surface>> surfaces;
+        std::vector<occ::handle<Geom_Curve>> curves;
+        bgCollectGeometry(g, surfaces, curves);
+        if (!outGroups) return (int32_t)surfaces.size();
+        const int32_t groups = occtGroupGeomKeys(
+            bgGeomKeys(surfaces, occtSurfaceKey, linearTolerance, angularTolerance, parallel), outGroups);
+        if (outGroupCount) *outGroupCount = groups;
+        return (int32_t)surfaces.size();
+    } catch (...) { return -1; }
+}
+
+int32_t OCCTBRepGraphHashEdgeCurves(OCCTBRepGraphRef g, double linearTolerance, double angularTolerance,
+                                    int32_t* outGroups, int32_t* outGroupCount, bool parallel) {
+    if (!g || linearTolerance <= 0 || angularTolerance <= 0) return -1;
+    try {
+        std::vector<occ::handle<Geom_Surface>> surfaces;
+        std::vector<occ::handle<Geom_Curve>> curves;
+        bgCollectGeometry(g, surfaces, curves);
+        if (!outGroups) return (int32_t)curves.size();
+        const int32_t groups = occtGroupGeomKeys(
+            bgGeomKeys(curves, occtCurveKey, linearTolerance, angularTolerance, parallel), outGroups);
+        if (outGroupCount) *outGroupCount = groups;
+        return (int32_t)curves.size();
+    } catch (...) { return -1; }
+}
+
+OCCTBRepGraphDeduplicateResult OCCTBRepGraphDeduplicateHashed(OCCTBRepGraphRef g,
+                                                              double linearTolerance, double angularTolerance,
+                                                              bool* outSkipped) {
+    OCCTBRepGraphDeduplicateResult r = {0, 0, 0, 0};
+    if (outSkipped) *outSkipped = false;
+    if (!g || linearTolerance <= 0 || angularTolerance <= 0) return r;
+    try {
+        std::vector<occ::handle<Geom_Surface>> surfaces;
+        std::vector<occ::handle<Geom_Curve>> curves;
+        bgCollectGeometry(g, surfaces, curves);
+        int32_t nbSurfaces = 0, nbCurves = 0;
+        const bool maySurfaces = bgMayHaveDuplicates(
+            surfaces, bgGeomKeys(surfaces, occtSurfaceKey, linearTolerance, angularTolerance, true),
+            angularTolerance, nbSurfaces);
+        const bool mayCurves = bgMayHaveDuplicates(
+            curves, bgGeomKeys(curves, occtCurveKey, linearTolerance, angularTolerance, true),
+            angularTolerance, nbCurves);
+        if (!maySurfaces && !mayCurves) {
+            // Every handle is already its own canonical representative.
+            r.canonicalSurfaces = nbSurfaces;
+            r.canonicalCurves = nbCurves;
+            if (outSkipped) *outSkipped = true;
+            return r;
+        }
+    } catch (...) {}
+    return OCCTBRepGraphDeduplicate(g);
+}
+
 // --- Copy and Transform ---
 
 OCCTBRepGraphRef OCCTBRepGraphCopy(OCCTBRepGraphRef g, bool copyGeom) {
@@ -3125,6 +3280,209 @@ double OCCTEdgeGetDihedralAngle(OCCTEdgeRef edge, OCCTFaceRef face1, OCCTFaceRef
     }
 }
 
+// MARK: - Native AAG builder
+
+// Whole-shape attributed adjacency graph. Face/edge indices are those of the
+// shape's cached index maps, so face i here is OCCTShapeGetFaceAtIndex(i).
+struct OCCTAAGData {
+    int32_t faceCount = 0;
+    std::vector<int32_t> offsets;        // faceCount + 1
+    std::vector<int32_t> neighbors;      // 2 per arc, ascending per face
+    std::vector<int32_t> neighborArcs;   // arc index of each neighbors[] entry
+    std::vector<int32_t> arcFaces;       // (face1, face2), face1 < face2
+    std::vector<int32_t> arcConvexity;   // OCCTEdgeConvexity of the first shared edge
+    std::vector<double>  arcAngle;       // interior dihedral angle of that edge
+    std::vector<int32_t> arcSharedEdges;
+};
+
+// One (edge, face1, face2) incidence; face1 < face2.
+struct AAGEdgeTask {
+    int32_t edge;
+    int32_t face1;
+    int32_t face2;
+    TopAbs_Orientation orientation1;   // orientation of the edge inside face1
+    TopAbs_Orientation orientation2;
+    int32_t convexity;
+    double angle;
+};
+
+// Unit outward normal of `face` at parameter `t` of `edge` (oriented as in the face).
+static bool aagFaceNormal(const TopoDS_Edge& edge, const TopoDS_Face& face, double t, gp_Vec& n) {
+    Standard_Real f, l;
+    Handle(Geom2d_Curve) pcurve = BRep_Tool::CurveOnSurface(edge, face, f, l);
+    if (pcurve.IsNull()) return false;
+    gp_Pnt2d uv = pcurve->Value(t);
+    BRepAdaptor_Surface surf(face, Standard_False);
+    gp_Pnt p;
+    gp_Vec du, dv;
+    surf.D1(uv.X(), uv.Y(), p, du, dv);
+    n = du.Crossed(dv);
+    if (n.Magnitude() < 1e-10) return false;
+    n.Normalize();
+    if (face.Orientation() == TopAbs_REVERSED) n.Reverse();
+    return true;
+}
+
+// Classify one shared edge at its midpoint. Walking the edge in its face1
+// orientation keeps face1's material on the left, so n1 ^ tangent points into
+// face1; the edge is convex when face2's normal points away from that side.
+// The interior angle is π for smooth, π - θ for convex, π + θ for concave,
+// with θ the angle between the two face normals.
+static void aagClassify(const TopoDS_Edge& edge, const TopoDS_Face& face1, const TopoDS_Face& face2,
+                        double smoothAngle, AAGEdgeTask& task) {
+    task.convexity = OCCTEdgeConvexitySmooth;
+    task.angle = M_PI;
+    BRepAdaptor_Curve curve(edge);
+    const double t = 0.5 * (curve.FirstParameter() + curve.LastParameter());
+    gp_Pnt p;
+    gp_Vec tangent;
+    curve.D1(t, p, tangent);
+    if (tangent.Magnitude() < 1e-10) return;
+    tangent.Normalize();
+    if (task.orientation1 == TopAbs_REVERSED) tangent.Reverse();
+
+    gp_Vec n1, n2;
+    if (!aagFaceNormal(TopoDS::Edge(edge.Oriented(task.orientation1)), face1, t, n1)) return;
+    if (!aagFaceNormal(TopoDS::Edge(edge.Oriented(task.orientation2)), face2, t, n2)) return;
+
+    const double theta = std::atan2(n1.Crossed(n2).Magnitude(), n1.Dot(n2));
+    if (theta < smoothAngle) return;
+    const double side = n1.Crossed(tangent).Dot(n2);
+    if (side < 0) {
+        task.convexity = OCCTEdgeConvexityConvex;
+        task.angle = M_PI - theta;
+    } else {
+        task.convexity = OCCTEdgeConvexityConcave;
+        task.angle = M_PI + theta;
+    }
+}
+
+OCCTAAGDataRef OCCTShapeBuildAAG(OCCTShapeRef shape, double smoothAngle, bool parallel) {
+    if (!shape) return nullptr;
+    try {
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
+        const int32_t nbFaces = faceMap.Extent();
+        const int32_t nbEdges = edgeMap.Extent();
+        smoothAngle = std::max(0.0, smoothAngle);
+
+        // Edge → (face, orientation) in one pass over the face/edge incidences:
+        // the same walk TopExp::MapShapesAndAncestors(EDGE, FACE) does, but
+        // keeping how each face uses the edge. Seam uses collapse to one entry.
+        struct Use { int32_t face; TopAbs_Orientation orientation; };
+        std::vector<std::vector<Use>> uses(nbEdges);
+        for (int32_t f = 1; f <= nbFaces; f++) {
+            for (TopExp_Explorer ex(faceMap(f), TopAbs_EDGE); ex.More(); ex.Next()) {
+                const TopoDS_Edge& e = TopoDS::Edge(ex.Current());
+                const int32_t ei = edgeMap.FindIndex(e);
+                if (ei == 0 || BRep_Tool::Degenerated(e)) continue;
+                std::vector<Use>& list = uses[ei - 1];
+                if (!list.empty() && list.back().face == f - 1) continue;
+                list.push_back({f - 1, e.Orientation()});
+            }
+        }
+
+        std::vector<AAGEdgeTask> tasks;
+        for (int32_t e = 0; e < nbEdges; e++) {
+            const std::vector<Use>& list = uses[e];
+            for (size_t i = 0; i < list.size(); i++) {
+                for (size_t j = i + 1; j < list.size(); j++) {
+                    const Use& a = list[i].face < list[j].face ? list[i] : list[j];
+                    const Use& b = list[i].face < list[j].face ? list[j] : list[i];
+                    if (a.face == b.face) continue;
+                    tasks.push_back({e, a.face, b.face, a.orientation, b.orientation,
+                                     OCCTEdgeConvexitySmooth, M_PI});
+                }
+            }
+        }
+
+        occtParallelChunks((int32_t)tasks.size(), [&](int32_t begin, int32_t end) {
+            for (int32_t k = begin; k < end; k++) {
+                AAGEdgeTask& task = tasks[k];
+                try {
+                    aagClassify(TopoDS::Edge(edgeMap(task.edge + 1)),
+                                TopoDS::Face(faceMap(task.face1 + 1)),
+                                TopoDS::Face(faceMap(task.face2 + 1)), smoothAngle, task);
+                } catch (...) {
+                    task.convexity = OCCTEdgeConvexitySmooth;
+                    task.angle = M_PI;
+                }
+            }
+        }, parallel);
+
+        // Group by face pair; within a pair the lowest edge index comes first.
+        std::stable_sort(tasks.begin(), tasks.end(), [](const AAGEdgeTask& a, const AAGEdgeTask& b) {
+            return a.face1 != b.face1 ? a.face1 < b.face1 : a.face2 < b.face2;
+        });
+
+        auto* aag = new OCCTAAGData();
+        aag->faceCount = nbFaces;
+        for (size_t k = 0; k < tasks.size(); k++) {
+            const AAGEdgeTask& task = tasks[k];
+            if (k > 0 && tasks[k - 1].face1 == task.face1 && tasks[k - 1].face2 == task.face2) {
+                aag->arcSharedEdges.back()++;
+                continue;
+            }
+            aag->arcFaces.push_back(task.face1);
+            aag->arcFaces.push_back(task.face2);
+            aag->arcConvexity.push_back(task.convexity);
+            aag->arcAngle.push_back(task.angle);
+            aag->arcSharedEdges.push_back(1);
+        }
+
+        // CSR. Arcs are sorted by (face1, face2), so filling in arc order leaves
+        // every face's neighbour list ascending.
+        const int32_t nbArcs = (int32_t)aag->arcConvexity.size();
+        aag->offsets.assign(nbFaces + 1, 0);
+        for (int32_t a = 0; a < nbArcs; a++) {
+            aag->offsets[aag->arcFaces[2 * a] + 1]++;
+            aag->offsets[aag->arcFaces[2 * a + 1] + 1]++;
+        }
+        for (int32_t f = 0; f < nbFaces; f++) aag->offsets[f + 1] += aag->offsets[f];
+        aag->neighbors.resize(2 * nbArcs);
+        aag->neighborArcs.resize(2 * nbArcs);
+        std::vector<int32_t> cursor(aag->offsets.begin(), aag->offsets.end() - 1);
+        for (int32_t a = 0; a < nbArcs; a++) {
+            const int32_t f1 = aag->arcFaces[2 * a], f2 = aag->arcFaces[2 * a + 1];
+            aag->neighbors[cursor[f1]] = f2;
+            aag->neighborArcs[cursor[f1]++] = a;
+            aag->neighbors[cursor[f2]] = f1;
+            aag->neighborArcs[cursor[f2]++] = a;
+        }
+        return aag;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTAAGDataRelease(OCCTAAGDataRef aag) {
+    delete aag;
+}
+
+int32_t OCCTAAGDataFaceCount(OCCTAAGDataRef aag) {
+    return aag ? aag->faceCount : 0;
+}
+
+int32_t OCCTAAGDataArcCount(OCCTAAGDataRef aag) {
+    return aag ? (int32_t)aag->arcConvexity.size() : 0;
+}
+
+void OCCTAAGDataGetAdjacency(OCCTAAGDataRef aag, int32_t* outOffsets, int32_t* outNeighbors, int32_t* outArcs) {
+    if (!aag || !outOffsets || !outNeighbors || !outArcs) return;
+    std::copy(aag->offsets.begin(), aag->offsets.end(), outOffsets);
+    std::copy(aag->neighbors.begin(), aag->neighbors.end(), outNeighbors);
+    std::copy(aag->neighborArcs.begin(), aag->neighborArcs.end(), outArcs);
+}
+
+void OCCTAAGDataGetArcs(OCCTAAGDataRef aag, int32_t* outFaces, int32_t* outConvexity,
+                        double* outAngles, int32_t* outSharedEdges) {
+    if (!aag || !outFaces || !outConvexity || !outAngles || !outSharedEdges) return;
+    std::copy(aag->arcFaces.begin(), aag->arcFaces.end(), outFaces);
+    std::copy(aag->arcConvexity.begin(), aag->arcConvexity.end(), outConvexity);
+    std::copy(aag->arcAngle.begin(), aag->arcAngle.end(), outAngles);
+    std::copy(aag->arcSharedEdges.begin(), aag->arcSharedEdges.end(), outSharedEdges);
+}
+
 // MARK: - Durable identity (BRepGraph::UIDsView) — OCCT 8.0.0p1
 
 #include <BRepGraph_UID.hxx>
@@ -428,8 +428,7 @@ OCCTShapeRef OCCTShapeFilletVariable(OCCTShapeRef shape, int32_t edgeIndex,
 
     try {
         // Get the edge at the specified index
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
 
         if (edgeIndex >= edgeMap.Extent()) return nullptr;
 
@@ -663,8 +662,7 @@ OCCTShapeRef OCCTShapeBlendEdges(OCCTShapeRef shape,
 
     try {
         // Get all edges from shape
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
 
         // Create fillet maker
         BRepFilletAPI_MakeFillet fillet(shape->shape);
@@ -2706,8 +2704,7 @@ OCCTShapeRef _Nullable OCCTShapeUpgradeFixSmallCurves(OCCTShapeRef shape, double
     try {
         // Use ShapeFix_Wireframe which internally uses FixSmallCurves logic
         // to fix small edges across the entire shape
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         if (faceMap.Extent() == 0) return nullptr;
 
         BRep_Builder bb;
@@ -2737,8 +2734,7 @@ OCCTShapeRef _Nullable OCCTShapeUpgradeFixSmallCurves(OCCTShapeRef shape, double
 OCCTShapeRef _Nullable OCCTShapeUpgradeFixSmallBezierCurves(OCCTShapeRef shape, double tolerance) {
     if (!shape) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         if (faceMap.Extent() == 0) return nullptr;
 
         for (int i = 1; i <= faceMap.Extent(); i++) {
@@ -4524,3 +4520,175 @@ OCCTShapeRef OCCTShapeHeal(OCCTShapeRef shape) {
     }
 }
 
+
+// MARK: - Geometric Hashing & Hashed UnifySameDomain
+
+#include <BRep_Builder.hxx>
+#include <TopoDS_Iterator.hxx>
+
+// Surface key of every face / curve key of every edge, in index order.
+static std::vector<OCCTGeomKey> ghFaceKeys(const TopTools_IndexedMapOfShape& faces,
+                                           double linTol, double angTol, bool parallel) {
+    std::vector<OCCTGeomKey> keys(faces.Extent());
+    occtParallelChunks(faces.Extent(), [&](int32_t begin, int32_t end) {
+        for (int32_t i = begin; i < end; i++) {
+            try {
+                keys[i] = occtSurfaceKey(BRep_Tool::Surface(TopoDS::Face(faces(i + 1))), linTol, angTol);
+            } catch (...) {
+                keys[i] = OCCTGeomKey();
+            }
+        }
+    }, parallel);
+    return keys;
+}
+
+static std::vector<OCCTGeomKey> ghEdgeKeys(const TopTools_IndexedMapOfShape& edges,
+                                           double linTol, double angTol, bool parallel) {
+    std::vector<OCCTGeomKey> keys(edges.Extent());
+    occtParallelChunks(edges.Extent(), [&](int32_t begin, int32_t end) {
+        for (int32_t i = begin; i < end; i++) {
+            try {
+                const TopoDS_Edge& edge = TopoDS::Edge(edges(i + 1));
+                if (BRep_Tool::Degenerated(edge)) continue;
+                double first, last;
+                keys[i] = occtCurveKey(BRep_Tool::Curve(edge, first, last), linTol, angTol);
+            } catch (...) {
+                keys[i] = OCCTGeomKey();
+            }
+        }
+    }, parallel);
+    return keys;
+}
+
+int32_t OCCTShapeGeometricHashFaces(OCCTShapeRef shape, double linearTolerance, double angularTolerance,
+                                    int32_t* outGroups, int32_t* outGroupCount, bool parallel) {
+    if (!shape || linearTolerance <= 0 || angularTolerance <= 0) return -1;
+    try {
+        const TopTools_IndexedMapOfShape& faces = shape->subShapes(TopAbs_FACE);
+        if (!outGroups) return faces.Extent();
+        const int32_t groups = occtGroupGeomKeys(ghFaceKeys(faces, linearTolerance, angularTolerance, parallel), outGroups);
+        if (outGroupCount) *outGroupCount = groups;
+        return faces.Extent();
+    } catch (...) {
+        return -1;
+    }
+}
+
+int32_t OCCTShapeGeometricHashEdges(OCCTShapeRef shape, double linearTolerance, double angularTolerance,
+                                    int32_t* outGroups, int32_t* outGroupCount, bool parallel) {
+    if (!shape || linearTolerance <= 0 || angularTolerance <= 0) return -1;
+    try {
+        const TopTools_IndexedMapOfShape& edges = shape->subShapes(TopAbs_EDGE);
+        if (!outGroups) return edges.Extent();
+        const int32_t groups = occtGroupGeomKeys(ghEdgeKeys(edges, linearTolerance, angularTolerance, parallel), outGroups);
+        if (outGroupCount) *outGroupCount = groups;
+        return edges.Extent();
+    } catch (...) {
+        return -1;
+    }
+}
+
+// Flags (per edge index) where UnifySameDomain might do something: an edge between two
+// faces whose surface keys are within one cell, or both edges at a vertex joining exactly
+// two edges whose curve keys are. Unkeyed (non-analytic) geometry is always flagged, since
+// UnifySameDomain has its own rules for it, and so are axes on the sign threshold.
+static bool ghMayMatch(const OCCTGeomKey& a, const OCCTGeomKey& b, double angTol) {
+    return a.kind == 0 || b.kind == 0 || occtGeomKeysNear(a, b) ||
+           (a.kind == b.kind && (occtGeomKeySignAmbiguous(a, angTol) || occtGeomKeySignAmbiguous(b, angTol)));
+}
+
+static std::vector<char> ghUnifyCandidates(const OCCTShape& shape, bool unifyEdges, bool unifyFaces,
+                                           double linTol, double angTol, bool parallel) {
+    const TopTools_IndexedMapOfShape& edges = shape.subShapes(TopAbs_EDGE);
+    std::vector<char> hot(edges.Extent(), 0);
+    if (unifyFaces) {
+        const TopTools_IndexedMapOfShape& faces = shape.subShapes(TopAbs_FACE);
+        const std::vector<OCCTGeomKey> keys = ghFaceKeys(faces, linTol, angTol, parallel);
+        const TopTools_IndexedDataMapOfShapeListOfShape& edgeFaces = shape.edgeFaces();
+        for (int i = 1; i <= edgeFaces.Extent(); i++) {
+            const TopTools_ListOfShape& adj = edgeFaces(i);
+            if (adj.Extent() != 2) continue;
+            const int32_t fa = faces.FindIndex(adj.First()) - 1, fb = faces.FindIndex(adj.Last()) - 1;
+            const int32_t e = edges.FindIndex(edgeFaces.FindKey(i)) - 1;
+            if (fa < 0 || fb < 0 || e < 0) continue;
+            if (ghMayMatch(keys[fa], keys[fb], angTol)) hot[e] = 1;
+        }
+    }
+    if (unifyEdges) {
+        const std::vector<OCCTGeomKey> keys = ghEdgeKeys(edges, linTol, angTol, parallel);
+        const TopTools_IndexedDataMapOfShapeListOfShape& vertexEdges = shape.vertexEdges();
+        for (int i = 1; i <= vertexEdges.Extent(); i++) {
+            const TopTools_ListOfShape& adj = vertexEdges(i);
+            if (adj.Extent() != 2) continue;
+            const int32_t ea = edges.FindIndex(adj.First()) - 1, eb = edges.FindIndex(adj.Last()) - 1;
+            if (ea < 0 || eb < 0) continue;
+            if (BRep_Tool::Degenerated(TopoDS::Edge(adj.First())) || BRep_Tool::Degenerated(TopoDS::Edge(adj.Last()))) continue;
+            if (ghMayMatch(keys[ea], keys[eb], angTol)) hot[ea] = hot[eb] = 1;
+        }
+    }
+    return hot;
+}
+
+OCCTShapeRef OCCTShapeUnifySameDomainHashed(OCCTShapeRef shape,
+                                             bool unifyEdges, bool unifyFaces, bool concatBSplines,
+                                             double linearTolerance, double angularTolerance,
+                                             int32_t* outUnifiedParts, bool parallel) {
+    if (!shape || linearTolerance <= 0 || angularTolerance <= 0) return nullptr;
+    try {
+        const std::vector<char> hot = ghUnifyCandidates(*shape, unifyEdges, unifyFaces,
+                                                        linearTolerance, angularTolerance, parallel);
+        const TopTools_IndexedMapOfShape& edges = shape->subShapes(TopAbs_EDGE);
+        auto unify = [&](const TopoDS_Shape& s) {
+            ShapeUpgrade_UnifySameDomain unifier(s, unifyEdges, unifyFaces, concatBSplines);
+            // The merge itself runs at the caller's tolerances, not just the pre-filter.
+            unifier.SetLinearTolerance(linearTolerance);
+            unifier.SetAngularTolerance(angularTolerance);
+            unifier.Build();
+            return unifier.Shape();
+        };
+
+        // Top-level parts of a compound go through UnifySameDomain one by one, and only
+        // those with a flagged edge. Parts that share edges (or a lone shape) are one unit.
+        std::vector<TopoDS_Shape> parts;
+        if (shape->shape.ShapeType() == TopAbs_COMPOUND) {
+            for (TopoDS_Iterator it(shape->shape); it.More(); it.Next()) parts.push_back(it.Value());
+        }
+        std::vector<char> partHot(parts.size(), 0);
+        std::vector<int32_t> owner(edges.Extent(), -1);
+        bool asOne = parts.size() < 2;
+        for (size_t p = 0; p < parts.size() && !asOne; p++) {
+            for (TopExp_Explorer ex(parts[p], TopAbs_EDGE); ex.More(); ex.Next()) {
+                const int32_t e = edges.FindIndex(ex.Current()) - 1;
+                if (e < 0) continue;
+                if (owner[e] >= 0 && owner[e] != (int32_t)p) { asOne = true; break; }
+                owner[e] = (int32_t)p;
+                if (hot[e]) partHot[p] = 1;
+            }
+        }
+
+        int32_t unified = 0;
+        TopoDS_Shape result;
+        if (asOne) {
+            const bool any = std::find(hot.begin(), hot.end(), 1) != hot.end();
+            result = any ? unify(shape->shape) : shape->shape;
+            unified = any ? 1 : 0;
+        } else {
+            BRep_Builder builder;
+            TopoDS_Compound compound;
+            builder.MakeCompound(compound);
+            for (size_t p = 0; p < parts.size(); p++) {
+                if (!partHot[p]) { builder.Add(compound, parts[p]); continue; }
+                const TopoDS_Shape part = unify(parts[p]);
+                if (part.IsNull()) return nullptr;
+                builder.Add(compound, part);
+                unified++;
+            }
+            result = compound;
+        }
+        if (result.IsNull()) return nullptr;
+        if (outUnifiedParts) *outUnifiedParts = unified;
+        return new OCCTShape(result);
+    } catch (...) {
+        return nullptr;
+    }
+}
@@ -19,7 +19,13 @@
 #ifndef OCCTBridge_Internal_h
 #define OCCTBridge_Internal_h
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 // === Foundation OCCT headers ===
@@ -29,10 +35,14 @@
 // header is intentionally not the kitchen sink.
 
 #include <Standard.hxx>
+#include <OSD_Parallel.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Wire.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
+#include <TopAbs_ShapeEnum.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <Geom_Curve.hxx>
 #include <Geom2d_Curve.hxx>
 #include <Geom_Surface.hxx>
@@ -47,13 +57,150 @@
 #include <XCAFDoc_VisMaterialTool.hxx>
 #include <TDF_Label.hxx>
 
+// === Wrapper pooling ===
+//
+// Bridge getters hand every face/edge/wire/shape to Swift as its own heap
+// wrapper, and Swift frees them one at a time from deinit. The wrappers below
+// route their operator new/delete through per-thread free lists, one per size
+// class (OCCTFace, OCCTEdge and OCCTWire share one), so steady-state traffic
+// recycles blocks instead of hitting malloc. A block freed on another thread
+// simply joins that thread's list; each list keeps at most kOCCTPoolMaxFree
+// blocks and returns the rest to the heap. Lists are drained at thread exit.
+//
+// Building with OCCT_WRAPPER_POOL_STATS (opt-in via OCCTSWIFT_POOL_STATS=1, see
+// Package.swift) counts allocations for OCCTWrapperPoolGetStats.
+
+constexpr int32_t kOCCTPoolMaxFree = 4096;
+
+struct OCCTPoolFreeList {
+    void* head = nullptr;
+    int32_t count = 0;
+    bool closed = false;   // thread is exiting; free straight to the heap
+};
+
+#ifdef OCCT_WRAPPER_POOL_STATS
+struct OCCTPoolStats {
+    std::atomic<int64_t> allocations{0};
+    std::atomic<int64_t> poolHits{0};
+    std::atomic<int64_t> releases{0};
+};
+OCCTPoolStats& occtPoolStats();   // definition lives in OCCTBridge.mm
+#endif
+
+template <std::size_t Size>
+inline OCCTPoolFreeList& occtPoolFreeList() {
+    // Trivially destructible, so it stays usable while other thread_locals
+    // are being torn down; OCCTPoolDrain empties it and marks it closed.
+    static thread_local OCCTPoolFreeList list;
+    return list;
+}
+
+// Return the calling thread's cached blocks of one size class to the heap.
+template <std::size_t Size>
+inline void occtPoolFlush() {
+    OCCTPoolFreeList& list = occtPoolFreeList<Size>();
+    while (list.head) {
+        void* next = *static_cast<void**>(list.head);
+        ::operator delete(list.head);
+        list.head = next;
+    }
+    list.count = 0;
+}
+
+template <std::size_t Size>
+struct OCCTPoolDrain {
+    ~OCCTPoolDrain() {
+        occtPoolFreeList<Size>().closed = true;
+        occtPoolFlush<Size>();
+    }
+};
+
+template <std::size_t Size>
+inline void* occtPoolAllocate() {
+    static_assert(Size >= sizeof(void*), "pooled block must hold a free-list link");
+#ifdef OCCT_WRAPPER_POOL_STATS
+    occtPoolStats().allocations.fetch_add(1, std::memory_order_relaxed);
+#endif
+    OCCTPoolFreeList& list = occtPoolFreeList<Size>();
+    if (void* block = list.head) {
+        list.head = *static_cast<void**>(block);
+        list.count--;
+#ifdef OCCT_WRAPPER_POOL_STATS
+        occtPoolStats().poolHits.fetch_add(1, std::memory_order_relaxed);
+#endif
+        return block;
+    }
+    return ::operator new(Size);
+}
+
+template <std::size_t Size>
+inline void occtPoolRelease(void* block) {
+    if (!block) return;
+#ifdef OCCT_WRAPPER_POOL_STATS
+    occtPoolStats().releases.fetch_add(1, std::memory_order_relaxed);
+#endif
+    OCCTPoolFreeList& list = occtPoolFreeList<Size>();
+    if (list.closed || list.count >= kOCCTPoolMaxFree) {
+        ::operator delete(block);
+        return;
+    }
+    if (!list.head) {
+        // First block parked on this thread: register the exit-time drain.
+        static thread_local OCCTPoolDrain<Size> drain;
+        (void)drain;
+    }
+    *static_cast<void**>(block) = list.head;
+    list.head = block;
+    list.count++;
+}
+
+// Give a wrapper struct pooled operator new/delete.
+#define OCCT_POOLED_WRAPPER(Type) \
+    static void* operator new(std::size_t) { return occtPoolAllocate<sizeof(Type)>(); } \
+    static void operator delete(void* p) { occtPoolRelease<sizeof(Type)>(p); }
+
 // === Foundation struct definitions ===
 
+// Lazily built sub-shape index maps of one OCCTShape (layout in OCCTBridge.mm).
+struct OCCTShapeIndex;
+
 struct OCCTShape {
     TopoDS_Shape shape;
 
     OCCTShape() {}
     OCCTShape(const TopoDS_Shape& s) : shape(s) {}
+    OCCTShape(const OCCTShape& other) : shape(other.shape) {}
+    OCCTShape& operator=(const OCCTShape& other) {
+        shape = other.shape;
+        invalidateIndex();
+        return *this;
+    }
+    ~OCCTShape() { invalidateIndex(); }
+
+    // Memoized index maps for the index-based bridge calls. Built on first use
+    // (thread-safe), then immutable: the 1-based map index is the public 0-based
+    // sub-shape index + 1, exactly as a fresh TopExp::MapShapes would give.
+    // References stay valid until invalidateIndex().
+    const TopTools_IndexedMapOfShape& subShapes(TopAbs_ShapeEnum type) const;
+    // TopExp::MapShapesAndUniqueAncestors(shape, EDGE, FACE) / (VERTEX, EDGE).
+    const TopTools_IndexedDataMapOfShapeListOfShape& edgeFaces() const;
+    const TopTools_IndexedDataMapOfShapeListOfShape& vertexEdges() const;
+
+    // Drop the cached maps. Call after mutating `shape` in place (orientation,
+    // location, reassignment of a live handle). Must not race with readers —
+    // the same rule as for mutating `shape` itself. The cache is per handle: other
+    // OCCTShapes wrapping the same TShape are not reached, which the public docs of
+    // in-place edits (OCCTBuilderAdd, ...) spell out.
+    void invalidateIndex() const;
+
+    // Bytes currently held by this shape's cache (estimate).
+    int64_t indexBytes() const;
+
+    OCCT_POOLED_WRAPPER(OCCTShape)
+
+private:
+    mutable std::atomic<OCCTShapeIndex*> index_{nullptr};
+    OCCTShapeIndex& ensureIndex() const;
 };
 
 struct OCCTWire {
@@ -61,6 +208,8 @@ struct OCCTWire {
 
     OCCTWire() {}
     OCCTWire(const TopoDS_Wire& w) : wire(w) {}
+
+    OCCT_POOLED_WRAPPER(OCCTWire)
 };
 
 struct OCCTEdge {
@@ -68,6 +217,8 @@ struct OCCTEdge {
 
     OCCTEdge() {}
     OCCTEdge(const TopoDS_Edge& e) : edge(e) {}
+
+    OCCT_POOLED_WRAPPER(OCCTEdge)
 };
 
 struct OCCTFace {
@@ -75,6 +226,8 @@ struct OCCTFace {
 
     OCCTFace() {}
     OCCTFace(const TopoDS_Face& f) : face(f) {}
+
+    OCCT_POOLED_WRAPPER(OCCTFace)
 };
 
 struct OCCTMesh {
@@ -177,6 +330,12 @@ struct Poly_PolygonOnTriangulationOpaque {
 std::recursive_mutex& occtGlobalMutex();
 std::mutex& igesMutex();
 
+// === Sub-shape index cache accounting ===
+//
+// Running total of the bytes held by all OCCTShape index caches (estimate).
+// Definition lives in OCCTBridge.mm next to the OCCTShape index methods.
+std::atomic<int64_t>& occtShapeIndexBytes();
+
 // === OCCT signal handling ===
 //
 // Installs OCCT's signal handlers (OSD::SetSignal) once, so that OS signals
@@ -197,4 +356,90 @@ void occtEnsureSignals();
 // BRepCheck topology pass, no meshing. Definition lives in OCCTBridge.mm. See issue #263.
 bool occtHasSelfIntersectingWire(const TopoDS_Shape& s);
 
+// === Geometric hashing ===
+//
+// Canonical, quantized key of an analytic surface (plane, cylinder, cone, sphere,
+// torus) or curve (line, circle). Geometry that coincides up to the tolerances
+// used to build the keys gets equal keys, so same-domain candidates fall out of
+// one hash-map pass instead of pairwise comparison. Trimmed wrappers are looked
+// through; anything else (B-splines, offsets, …) gets kind == 0 ("no key").
+//
+// Quantization cells have hard edges: two values within tolerance can straddle a
+// cell boundary and differ by one in that component. Equal keys are therefore a
+// candidate test, and occtGeomKeysNear() is the conservative one (every component
+// within one cell). Definitions live in OCCTBridge.mm.
+struct OCCTGeomKey {
+    int32_t kind = 0;     // 0 = no key; otherwise one per canonical form
+    int64_t q[8] = {};
+
+    bool operator==(const OCCTGeomKey& o) const {
+        return kind == o.kind && std::equal(q, q + 8, o.q);
+    }
+};
+
+struct OCCTGeomKeyHasher {
+    size_t operator()(const OCCTGeomKey& k) const noexcept {
+        uint64_t h = 1469598103934665603ull ^ (uint64_t)k.kind;
+        for (int64_t v : k.q) h = (h ^ (uint64_t)v) * 1099511628211ull;
+        return (size_t)h;
+    }
+};
+
+inline bool occtGeomKeysNear(const OCCTGeomKey& a, const OCCTGeomKey& b) {
+    if (a.kind == 0 || a.kind != b.kind) return false;
+    for (int i = 0; i < 8; i++) {
+        const int64_t d = a.q[i] - b.q[i];
+        if (d < -1 || d > 1) return false;
+    }
+    return true;
+}
+
+OCCTGeomKey occtSurfaceKey(const Handle(Geom_Surface)& surface, double linTol, double angTol);
+OCCTGeomKey occtCurveKey(const Handle(Geom_Curve)& curve, double linTol, double angTol);
+
+// True when the key's axis had a leading component within two cells of the 0.3
+// sign-normalization threshold: a neighbour within tolerance may have been flipped
+// the other way, so its key is not near this one.
+bool occtGeomKeySignAmbiguous(const OCCTGeomKey& key, double angTol);
+
+// Dense group ids in first-occurrence order (-1 for elements without a key); returns
+// the number of groups.
+inline int32_t occtGroupGeomKeys(const std::vector<OCCTGeomKey>& keys, int32_t* outGroups) {
+    std::unordered_map<OCCTGeomKey, int32_t, OCCTGeomKeyHasher> ids;
+    ids.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        if (keys[i].kind == 0) { outGroups[i] = -1; continue; }
+        outGroups[i] = ids.emplace(keys[i], (int32_t)ids.size()).first->second;
+    }
+    return (int32_t)ids.size();
+}
+
+// === Parallel range helper ===
+//
+// Splits [0, count) into contiguous chunks and runs `chunk(begin, end)` for
+// each on OCCT's thread pool (OSD_Parallel → OSD_ThreadPool). A chunk is the
+// unit of per-worker state: build any adaptor / classifier / extrema object
+// at the top of the chunk body and reuse it for every index in the range, so
+// no two threads ever touch the same BSpline cache (docs/thread-safety.md).
+//
+// The chunk body must not throw — wrap OCCT calls in try/catch and record the
+// failure in the caller's per-index output. Chunks write disjoint slices of
+// the output, so no locking is needed. `parallel == false` runs one chunk on
+// the calling thread (same results, handy for A/B timing).
+template <typename ChunkFn>
+inline void occtParallelChunks(int32_t count, const ChunkFn& chunk, bool parallel = true) {
+    if (count <= 0) return;
+    int32_t nbChunks = 1;
+    if (parallel) {
+        // A few chunks per core so an expensive tail (e.g. one slow face) doesn't idle the pool.
+        const int32_t nbCores = std::max(1, OSD_Parallel::NbLogicalProcessors());
+        nbChunks = std::min<int32_t>(count, nbCores * 4);
+    }
+    OSD_Parallel::For(0, nbChunks, [&](int c) {
+        const int32_t begin = (int32_t)((int64_t)count * c / nbChunks);
+        const int32_t end   = (int32_t)((int64_t)count * (c + 1) / nbChunks);
+        chunk(begin, end);
+    }, nbChunks == 1);
+}
+
 #endif /* OCCTBridge_Internal_h */
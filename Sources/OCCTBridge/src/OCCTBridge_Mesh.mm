@@ -306,8 +306,7 @@ int32_t OCCTShapeGetEdgePolyline(OCCTShapeRef shape, int32_t edgeIndex, double d
 
     try {
         // Use IndexedMap to match OCCTShapeGetTotalEdgeCount ordering
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
 
         if (edgeIndex >= edgeMap.Extent()) return -1;
 
@@ -1484,8 +1483,7 @@ OCCTShapeRef OCCTShapeReadSTL(const char* filePath) {
 // MARK: - Poly_Connect Mesh Adjacency (v0.102.0)
 
 static Handle(Poly_Triangulation) _getFaceTriangulation(OCCTShapeRef shape, int32_t faceIndex) {
-    NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> faceMap;
-    TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+    const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
     if (faceIndex < 1 || faceIndex > faceMap.Extent()) return nullptr;
     TopoDS_Face face = TopoDS::Face(faceMap(faceIndex));
     TopLoc_Location loc;
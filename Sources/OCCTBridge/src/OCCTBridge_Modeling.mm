@@ -324,8 +324,7 @@ OCCTShapeRef OCCTShapeFilletEdges(OCCTShapeRef shape, const int32_t* edgeIndices
         BRepFilletAPI_MakeFillet fillet(shape->shape);
 
         // Build edge index map for lookup
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
 
         for (int32_t i = 0; i < edgeCount; i++) {
             int32_t idx = edgeIndices[i];
@@ -353,8 +352,7 @@ OCCTShapeRef OCCTShapeFilletEdgesLinear(OCCTShapeRef shape, const int32_t* edgeI
         BRepFilletAPI_MakeFillet fillet(shape->shape);
 
         // Build edge index map for lookup
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
 
         for (int32_t i = 0; i < edgeCount; i++) {
             int32_t idx = edgeIndices[i];
@@ -377,6 +375,186 @@ OCCTShapeRef OCCTShapeFilletEdgesLinear(OCCTShapeRef shape, const int32_t* edgeI
     }
 }
 
+// MARK: - Speculative Fillet
+
+#include <BRepBuilderAPI_Copy.hxx>
+#include <numeric>
+
+namespace {
+
+int32_t filletGroupRoot(std::vector<int32_t>& parent, int32_t i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+// Fillet (edge, radius) pairs on `base`. Null unless the build succeeds and the result
+// passes BRepCheck -- a "done" fillet can still leave self-intersecting blends.
+TopoDS_Shape filletTrial(const TopoDS_Shape& base,
+                         const std::vector<std::pair<TopoDS_Edge, double>>& edges) {
+    try {
+        BRepFilletAPI_MakeFillet fillet(base);
+        for (const auto& [edge, radius] : edges) {
+            // Add() propagates along tangent edges; a second edge of the same chain is already in.
+            if (fillet.Contour(edge) == 0) fillet.Add(radius, edge);
+        }
+        fillet.Build();
+        if (!fillet.IsDone()) return TopoDS_Shape();
+        TopoDS_Shape result = fillet.Shape();
+        if (result.IsNull() || !BRepCheck_Analyzer(result).IsValid()) return TopoDS_Shape();
+        return result;
+    } catch (...) {
+        return TopoDS_Shape();
+    }
+}
+
+} // namespace
+
+OCCTShapeRef OCCTShapeFilletEdgesSpeculative(OCCTShapeRef shape, const int32_t* edgeIndices,
+                                             int32_t edgeCount, const double* radii, int32_t radiusCount,
+                                             OCCTFilletEdgeReport* outReports, bool parallel) {
+    if (outReports && edgeIndices) {
+        for (int32_t i = 0; i < edgeCount; i++) outReports[i] = {OCCTFilletEdgeInvalid, -1, -1, 0.0};
+    }
+    if (!shape || !edgeIndices || edgeCount <= 0 || !radii || radiusCount <= 0) return nullptr;
+    for (int32_t k = 0; k < radiusCount; k++) {
+        if (!(radii[k] > 0)) return nullptr;
+    }
+
+    try {
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
+        const TopTools_IndexedMapOfShape& vertexMap = shape->subShapes(TopAbs_VERTEX);
+
+        // Let OCCT form the contours (tangent chains) without building anything.
+        BRepFilletAPI_MakeFillet probe(shape->shape);
+        std::vector<int32_t> contourOf(edgeCount, 0);
+        for (int32_t i = 0; i < edgeCount; i++) {
+            const int32_t idx = edgeIndices[i];
+            if (idx < 0 || idx >= edgeMap.Extent()) continue;
+            const TopoDS_Edge& edge = TopoDS::Edge(edgeMap(idx + 1));
+            try {
+                if (probe.Contour(edge) == 0) probe.Add(edge);
+                contourOf[i] = probe.Contour(edge);
+            } catch (const Standard_Failure&) {
+                // Not filletable at all (free edge, seam); reported as failed.
+            }
+        }
+
+        // Contours meeting at a vertex share a corner blend, so they are solved together.
+        const int32_t nbContours = probe.NbContours();
+        std::vector<int32_t> parent(nbContours + 1);
+        std::iota(parent.begin(), parent.end(), 0);
+        std::unordered_map<int32_t, int32_t> vertexOwner;
+        for (int32_t ic = 1; ic <= nbContours; ic++) {
+            for (int32_t j = 1; j <= probe.NbEdges(ic); j++) {
+                for (TopExp_Explorer ex(probe.Edge(ic, j), TopAbs_VERTEX); ex.More(); ex.Next()) {
+                    const int32_t vi = vertexMap.FindIndex(ex.Current());
+                    auto [it, inserted] = vertexOwner.emplace(vi, ic);
+                    if (!inserted) {
+                        parent[filletGroupRoot(parent, ic)] = filletGroupRoot(parent, it->second);
+                    }
+                }
+            }
+        }
+
+        std::vector<int32_t> groupOf(edgeCount, -1);
+        std::vector<std::vector<int32_t>> groups;
+        std::unordered_map<int32_t, int32_t> rootGroup;
+        for (int32_t i = 0; i < edgeCount; i++) {
+            if (contourOf[i] == 0) continue;
+            const int32_t root = filletGroupRoot(parent, contourOf[i]);
+            auto [it, inserted] = rootGroup.emplace(root, (int32_t)groups.size());
+            if (inserted) groups.emplace_back();
+            groupOf[i] = it->second;
+            groups[it->second].push_back(i);
+        }
+        const int32_t nbGroups = (int32_t)groups.size();
+
+        // Index of the best radius that worked per group; radiusCount = none yet.
+        std::vector<std::atomic<int32_t>> bestRung(nbGroups);
+        for (auto& b : bestRung) b.store(radiusCount);
+
+        // Trials are laid out group-major, so a chunk usually walks one group's ladder in
+        // order and skips the smaller radii once a larger one has worked.
+        occtParallelChunks(nbGroups * radiusCount, [&](int32_t begin, int32_t end) {
+            for (int32_t t = begin; t < end; t++) {
+                const int32_t g = t / radiusCount, k = t % radiusCount;
+                if (bestRung[g].load() < k) continue;
+                try {
+                    // The fillet builder updates pcurves and tolerances on the shape it is
+                    // given, so concurrent trials each get their own deep copy.
+                    BRepBuilderAPI_Copy copier(shape->shape, Standard_True);
+                    std::vector<std::pair<TopoDS_Edge, double>> edges;
+                    edges.reserve(groups[g].size());
+                    for (int32_t i : groups[g]) {
+                        edges.emplace_back(TopoDS::Edge(copier.ModifiedShape(edgeMap(edgeIndices[i] + 1))), radii[k]);
+                    }
+                    if (filletTrial(copier.Shape(), edges).IsNull()) continue;
+                    int32_t current = bestRung[g].load();
+                    while (k < current && !bestRung[g].compare_exchange_weak(current, k)) {}
+                } catch (...) {
+                    // Failed trial: bestRung stays put. Nothing may escape the chunk, since
+                    // OSD_Parallel does not carry exceptions back to the caller.
+                }
+            }
+        }, parallel);
+
+        auto edgesOf = [&](const std::vector<int32_t>& gs) {
+            std::vector<std::pair<TopoDS_Edge, double>> edges;
+            for (int32_t g : gs) {
+                for (int32_t i : groups[g]) {
+                    edges.emplace_back(TopoDS::Edge(edgeMap(edgeIndices[i] + 1)), radii[bestRung[g].load()]);
+                }
+            }
+            return edges;
+        };
+
+        std::vector<int32_t> accepted;
+        for (int32_t g = 0; g < nbGroups; g++) {
+            if (bestRung[g].load() < radiusCount) accepted.push_back(g);
+        }
+        TopoDS_Shape result;
+        if (!accepted.empty()) result = filletTrial(shape->shape, edgesOf(accepted));
+        if (result.IsNull() && accepted.size() > 1) {
+            // Groups don't share vertices, but their blends can still run into each other.
+            std::vector<int32_t> kept;
+            for (int32_t g : accepted) {
+                kept.push_back(g);
+                TopoDS_Shape attempt = filletTrial(shape->shape, edgesOf(kept));
+                if (attempt.IsNull()) kept.pop_back();
+                else result = attempt;
+            }
+            accepted.swap(kept);
+        }
+        if (result.IsNull()) accepted.clear();
+
+        if (outReports) {
+            std::vector<char> applied(nbGroups, 0);
+            for (int32_t g : accepted) applied[g] = 1;
+            for (int32_t i = 0; i < edgeCount; i++) {
+                const int32_t idx = edgeIndices[i];
+                if (idx < 0 || idx >= edgeMap.Extent()) continue;
+                OCCTFilletEdgeReport& r = outReports[i];
+                r.group = groupOf[i];
+                if (r.group >= 0 && applied[r.group]) {
+                    r.rung = bestRung[r.group].load();
+                    r.radius = radii[r.rung];
+                    r.status = r.rung == 0 ? OCCTFilletEdgeFilleted : OCCTFilletEdgeReduced;
+                } else {
+                    r.status = OCCTFilletEdgeFailed;
+                }
+            }
+        }
+
+        if (result.IsNull()) return nullptr;
+        return new OCCTShape(result);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
 OCCTShapeRef OCCTShapeDraft(OCCTShapeRef shape, const int32_t* faceIndices, int32_t faceCount,
                             double dirX, double dirY, double dirZ, double angle,
                             double planeX, double planeY, double planeZ,
@@ -395,8 +573,7 @@ OCCTShapeRef OCCTShapeDraft(OCCTShapeRef shape, const int32_t* faceIndices, int3
         BRepOffsetAPI_DraftAngle draft(shape->shape);
 
         // Build face index map
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
 
         for (int32_t i = 0; i < faceCount; i++) {
             int32_t idx = faceIndices[i];
@@ -423,8 +600,7 @@ OCCTShapeRef OCCTShapeRemoveFeatures(OCCTShapeRef shape, const int32_t* faceIndi
         defeature.SetShape(shape->shape);
 
         // Build face index map
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
 
         for (int32_t i = 0; i < faceCount; i++) {
             int32_t idx = faceIndices[i];
@@ -692,6 +868,199 @@ OCCTShapeRef OCCTShapeBuildThreadCutter(double ox, double oy, double oz,
     }
 }
 
+// Thread-cutter cache: cutters are built once in a canonical frame (origin 0, axis +Z,
+// radial0 +X, phase 0) and handed out as located instances of the same TShape. A
+// cutter's phase is a rotation about its axis, so every start of a multi-start thread
+// shares one entry too.
+#include <deque>
+#include <BRepAlgoAPI_Common.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <gp_Ax3.hxx>
+#include <TopLoc_Location.hxx>
+
+namespace {
+
+struct ThreadCutterKeyData {
+    int32_t builder;
+    int32_t nSections;
+    int64_t q[10];
+
+    bool operator==(const ThreadCutterKeyData& o) const {
+        return builder == o.builder && nSections == o.nSections && std::equal(q, q + 10, o.q);
+    }
+};
+
+struct ThreadCutterKeyHasher {
+    size_t operator()(const ThreadCutterKeyData& k) const {
+        uint64_t h = 1469598103934665603ull;
+        auto mix = [&h](uint64_t v) { h ^= v; h *= 1099511628211ull; };
+        mix((uint64_t)k.builder);
+        mix((uint64_t)k.nSections);
+        for (int64_t v : k.q) mix((uint64_t)v);
+        return (size_t)h;
+    }
+};
+
+// Nanometre quantisation: parameters that agree to 1e-9 build the same cutter.
+ThreadCutterKeyData tcQuantize(const OCCTThreadCutterKey& k) {
+    ThreadCutterKeyData d;
+    d.builder = k.builder;
+    d.nSections = k.nSections;
+    const double v[10] = { k.pitch, k.turns, k.apexSign, k.helixRadius, k.cutDepth,
+                           k.outerHalf, k.apexHalf, k.bleed, k.taper, k.handed };
+    for (int i = 0; i < 10; ++i) d.q[i] = (int64_t)std::llround(v[i] * 1e9);
+    return d;
+}
+
+struct ThreadCutterCache {
+    std::mutex mutex;
+    std::unordered_map<ThreadCutterKeyData, TopoDS_Shape, ThreadCutterKeyHasher> entries;
+    std::deque<ThreadCutterKeyData> order;   // insertion order, oldest first
+    size_t capacity = 256;
+    std::atomic<int64_t> hits{0};
+    std::atomic<int64_t> misses{0};
+
+    bool find(const ThreadCutterKeyData& key, TopoDS_Shape& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key);
+        if (it == entries.end()) return false;
+        out = it->second;
+        return true;
+    }
+
+    void insert(const ThreadCutterKeyData& key, const TopoDS_Shape& shape) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (capacity == 0) return;
+        if (entries.emplace(key, shape).second) order.push_back(key);
+        while (entries.size() > capacity) {
+            entries.erase(order.front());
+            order.pop_front();
+        }
+    }
+};
+
+ThreadCutterCache& tcCache() {
+    static ThreadCutterCache cache;
+    return cache;
+}
+
+// Canonical frame → the caller's axis frame, with the start phase as a rotation about the axis.
+TopLoc_Location tcPlacement(double ox, double oy, double oz, double ax, double ay, double az,
+                            double rx, double ry, double rz, double phase, double handed) {
+    const gp_Dir A(ax, ay, az);
+    const gp_Vec R0(rx, ry, rz), T0 = gp_Vec(A).Crossed(R0);
+    const double theta = handed * phase;
+    const gp_Vec R = R0 * std::cos(theta) + T0 * std::sin(theta);
+    gp_Trsf trsf;
+    trsf.SetTransformation(gp_Ax3(gp_Pnt(ox, oy, oz), A, gp_Dir(R)), gp_Ax3());
+    return TopLoc_Location(trsf);
+}
+
+} // namespace
+
+OCCTShapeRef OCCTThreadCutterCacheLookup(const OCCTThreadCutterKey* key,
+                                         double ox, double oy, double oz,
+                                         double ax, double ay, double az,
+                                         double rx, double ry, double rz, double phase) {
+    if (!key) return nullptr;
+    try {
+        TopoDS_Shape canonical;
+        if (!tcCache().find(tcQuantize(*key), canonical)) {
+            tcCache().misses++;
+            return nullptr;
+        }
+        tcCache().hits++;
+        return new OCCTShape(canonical.Moved(tcPlacement(ox, oy, oz, ax, ay, az, rx, ry, rz, phase, key->handed)));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OCCTShapeRef OCCTThreadCutterCacheStore(const OCCTThreadCutterKey* key, OCCTShapeRef canonical,
+                                        double ox, double oy, double oz,
+                                        double ax, double ay, double az,
+                                        double rx, double ry, double rz, double phase) {
+    if (!key || !canonical) return nullptr;
+    try {
+        tcCache().insert(tcQuantize(*key), canonical->shape);
+        return new OCCTShape(canonical->shape.Moved(tcPlacement(ox, oy, oz, ax, ay, az, rx, ry, rz,
+                                                                phase, key->handed)));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OCCTShapeRef OCCTShapeBuildThreadCutterCached(double ox, double oy, double oz,
+                                              double ax, double ay, double az,
+                                              double rx, double ry, double rz,
+                                              double pitch, double turns, double apexSign,
+                                              double helixRadius, double cutDepth,
+                                              double outerHalf, double apexHalf, double bleed,
+                                              double phase, double handed, int32_t nSections,
+                                              double lengthBucket) {
+    if (pitch <= 0 || turns <= 0 || nSections < 2) return nullptr;
+    // Bucketed requests share the cutter of the next whole bucket, trimmed back below.
+    const double cachedTurns = lengthBucket > 0 ? std::ceil(turns / lengthBucket - 1e-9) * lengthBucket : turns;
+    OCCTThreadCutterKey key = { 0, nSections, pitch, cachedTurns, apexSign, helixRadius, cutDepth,
+                                outerHalf, apexHalf, bleed, 0.0, handed };
+    try {
+        TopoDS_Shape canonical;
+        if (tcCache().find(tcQuantize(key), canonical)) {
+            tcCache().hits++;
+        } else {
+            tcCache().misses++;
+            OCCTShapeRef built = OCCTShapeBuildThreadCutter(0, 0, 0, 0, 0, 1, 1, 0, 0,
+                                                            pitch, cachedTurns, apexSign, helixRadius, cutDepth,
+                                                            outerHalf, apexHalf, bleed, 0.0, handed, nSections);
+            if (!built) return nullptr;
+            canonical = built->shape;
+            delete built;
+            tcCache().insert(tcQuantize(key), canonical);
+        }
+        if (cachedTurns > turns + 1e-9) {
+            // Trim to length: keep the groove up to the requested thread end, z = pitch · turns.
+            const double r = std::abs(helixRadius) + cutDepth + bleed + outerHalf + 1.0;
+            TopoDS_Shape slab = BRepPrimAPI_MakeBox(gp_Pnt(-r, -r, -outerHalf - 1.0),
+                                                    gp_Pnt(r, r, pitch * turns)).Shape();
+            BRepAlgoAPI_Common trim(canonical, slab);
+            if (!trim.IsDone() || trim.Shape().IsNull()) return nullptr;
+            canonical = trim.Shape();
+        }
+        return new OCCTShape(canonical.Moved(tcPlacement(ox, oy, oz, ax, ay, az, rx, ry, rz, phase, handed)));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTThreadCutterCacheGetStats(int64_t* outHits, int64_t* outMisses, int32_t* outEntries) {
+    ThreadCutterCache& cache = tcCache();
+    if (outHits) *outHits = cache.hits.load();
+    if (outMisses) *outMisses = cache.misses.load();
+    if (outEntries) {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        *outEntries = (int32_t)cache.entries.size();
+    }
+}
+
+void OCCTThreadCutterCacheClear(void) {
+    ThreadCutterCache& cache = tcCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.entries.clear();
+    cache.order.clear();
+    cache.hits = 0;
+    cache.misses = 0;
+}
+
+void OCCTThreadCutterCacheSetCapacity(int32_t maxEntries) {
+    ThreadCutterCache& cache = tcCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.capacity = (size_t)std::max(0, maxEntries);
+    while (cache.entries.size() > cache.capacity) {
+        cache.entries.erase(cache.order.front());
+        cache.order.pop_front();
+    }
+}
+
 // MARK: - Surface Construction (v0.9.0)
 
 OCCTShapeRef OCCTShapeCreateBSplineSurface(const double* poles, int32_t uCount, int32_t vCount,
@@ -771,8 +1140,7 @@ OCCTShapeRef OCCTShapeShellWithOpenFaces(OCCTShapeRef shape, double thickness,
 
     try {
         // Get indexed map of faces
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
 
         // Build list of faces to remove (open faces)
         TopTools_ListOfShape facesToRemove;
@@ -1222,9 +1590,8 @@ OCCTShapeRef OCCTShapeChamferTwoDistances(OCCTShapeRef shape,
     if (!shape || !edgeIndices || !faceIndices || !dist1 || !dist2 || count <= 0) return nullptr;
     try {
         BRepFilletAPI_MakeChamfer chamfer(shape->shape);
-        TopTools_IndexedMapOfShape edgeMap, faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
 
         for (int32_t i = 0; i < count; i++) {
             int32_t ei = edgeIndices[i] + 1;  // 0-based to 1-based
@@ -1252,9 +1619,8 @@ OCCTShapeRef OCCTShapeChamferDistAngle(OCCTShapeRef shape,
     if (!shape || !edgeIndices || !faceIndices || !distances || !anglesDeg || count <= 0) return nullptr;
     try {
         BRepFilletAPI_MakeChamfer chamfer(shape->shape);
-        TopTools_IndexedMapOfShape edgeMap, faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
 
         for (int32_t i = 0; i < count; i++) {
             int32_t ei = edgeIndices[i] + 1;
@@ -1311,6 +1677,316 @@ OCCTShapeRef OCCTShapeCreateLoftAdvanced(const OCCTWireRef* profiles, int32_t pr
     }
 }
 
+// MARK: - Resampled Loft / Sweep
+
+#include <BRep_Tool.hxx>
+#include <GCPnts_UniformAbscissa.hxx>
+#include <Precision.hxx>
+#include <TColStd_HArray1OfReal.hxx>
+
+namespace {
+
+using LoftSection = std::vector<gp_Pnt>;
+
+/// Section index map: aligned index k reads raw index sign*k + offset (mod m).
+struct LoftIndexMap { int32_t sign = 1; int32_t offset = 0; };
+
+inline int32_t loftWrap(int32_t i, int32_t m) { return ((i % m) + m) % m; }
+
+/// `samples` points at uniform arc length. Closed wires drop the repeated end point.
+bool loftSampleWire(const TopoDS_Wire& wire, int32_t samples, LoftSection& out, bool& closed) {
+    BRepAdaptor_CompCurve curve(wire);
+    closed = BRep_Tool::IsClosed(wire);
+    const int32_t count = closed ? samples + 1 : samples;
+    GCPnts_UniformAbscissa ua(curve, count, curve.FirstParameter(), curve.LastParameter());
+    if (!ua.IsDone() || ua.NbPoints() != count) return false;
+    out.resize(samples);
+    for (int32_t k = 0; k < samples; k++) out[k] = curve.Value(ua.Parameter(k + 1));
+    return true;
+}
+
+gp_XYZ loftNewell(const LoftSection& s) {
+    gp_XYZ n(0, 0, 0);
+    for (size_t k = 0; k < s.size(); k++) n += s[k].XYZ().Crossed(s[(k + 1) % s.size()].XYZ());
+    return n;
+}
+
+/// How `cur` lines up with `prev` (both raw): winding, then the cyclic shift with the
+/// least squared distance. Open sections can only be reversed.
+LoftIndexMap loftRelativeMap(const LoftSection& prev, const LoftSection& cur, bool closed) {
+    const int32_t m = (int32_t)cur.size();
+    LoftIndexMap map;
+    if (!closed) {
+        const double keep = prev.front().SquareDistance(cur.front()) + prev.back().SquareDistance(cur.back());
+        const double flip = prev.front().SquareDistance(cur.back()) + prev.back().SquareDistance(cur.front());
+        if (flip < keep) { map.sign = -1; map.offset = m - 1; }
+        return map;
+    }
+    if (loftNewell(prev).Dot(loftNewell(cur)) < 0) map.sign = -1;
+    double best = RealLast();
+    for (int32_t s = 0; s < m; s++) {
+        double cost = 0;
+        for (int32_t k = 0; k < m && cost < best; k++)
+            cost += prev[k].SquareDistance(cur[loftWrap(map.sign * k + s, m)]);
+        if (cost < best) { best = cost; map.offset = s; }
+    }
+    return map;
+}
+
+/// Line every section up with section 0. Neighbour maps are independent and found in
+/// parallel; composing them is a cheap serial prefix.
+void loftAlign(std::vector<LoftSection>& grid, bool closed, bool parallel) {
+    const int32_t n = (int32_t)grid.size(), m = (int32_t)grid[0].size();
+    std::vector<LoftIndexMap> rel(n);
+    occtParallelChunks(n - 1, [&](int32_t b, int32_t e) {
+        for (int32_t i = b; i < e; i++) rel[i + 1] = loftRelativeMap(grid[i], grid[i + 1], closed);
+    }, parallel);
+    std::vector<LoftIndexMap> chain(n);
+    for (int32_t i = 1; i < n; i++) {
+        chain[i].sign = rel[i].sign * chain[i - 1].sign;
+        chain[i].offset = loftWrap(rel[i].sign * chain[i - 1].offset + rel[i].offset, m);
+    }
+    occtParallelChunks(n - 1, [&](int32_t b, int32_t e) {
+        for (int32_t i = b + 1; i < e + 1; i++) {
+            if (chain[i].sign == 1 && chain[i].offset == 0) continue;
+            LoftSection aligned(m);
+            for (int32_t k = 0; k < m; k++) aligned[k] = grid[i][loftWrap(chain[i].sign * k + chain[i].offset, m)];
+            grid[i].swap(aligned);
+        }
+    }, parallel);
+}
+
+/// Skin a bicubic surface through aligned sections: u runs along the sections, v across
+/// them. Every section is interpolated on the same uniform parameters, so all section
+/// curves share one knot vector and their poles form the rows of the surface net; each
+/// pole column is then interpolated across the sections on chord-length parameters.
+Handle(Geom_BSplineSurface) loftSkin(const std::vector<LoftSection>& grid, bool closed, bool parallel) {
+    const int32_t n = (int32_t)grid.size(), m = (int32_t)grid[0].size();
+    const int32_t nu = closed ? m + 1 : m;
+    Handle(TColStd_HArray1OfReal) uParams = new TColStd_HArray1OfReal(1, nu);
+    for (int32_t k = 0; k < nu; k++) uParams->SetValue(k + 1, double(k) / (nu - 1));
+
+    std::atomic<bool> ok{true};
+    std::vector<Handle(Geom_BSplineCurve)> sections(n);
+    occtParallelChunks(n, [&](int32_t b, int32_t e) {
+        for (int32_t i = b; i < e && ok; i++) {
+            const LoftSection& s = grid[i];
+            Handle(TColgp_HArray1OfPnt) pts = new TColgp_HArray1OfPnt(1, nu);
+            for (int32_t k = 0; k < nu; k++) pts->SetValue(k + 1, s[k % m]);
+            try {
+                GeomAPI_Interpolate interp(pts, uParams, Standard_False, Precision::Confusion());
+                if (closed) {
+                    // Same tangent at both ends keeps the seam C1.
+                    gp_Vec t(s[m - 1], s[1]);
+                    t *= m / 2.0;
+                    interp.Load(t, t, Standard_False);
+                }
+                interp.Perform();
+                if (interp.IsDone()) sections[i] = interp.Curve();
+                else ok = false;
+            } catch (...) {
+                ok = false;
+            }
+        }
+    }, parallel);
+    if (!ok) return nullptr;
+
+    std::vector<double> gaps(n - 1, 0.0);
+    occtParallelChunks(n - 1, [&](int32_t b, int32_t e) {
+        for (int32_t i = b; i < e; i++) {
+            double sum = 0;
+            for (int32_t k = 0; k < m; k++) sum += grid[i][k].Distance(grid[i + 1][k]);
+            gaps[i] = sum / m;
+        }
+    }, parallel);
+    const double total = std::accumulate(gaps.begin(), gaps.end(), 0.0);
+    Handle(TColStd_HArray1OfReal) vParams = new TColStd_HArray1OfReal(1, n);
+    double v = 0;
+    for (int32_t i = 0; i < n; i++) {
+        if (i > 0 && gaps[i - 1] <= Precision::Confusion()) return nullptr;
+        vParams->SetValue(i + 1, v / total);
+        if (i < n - 1) v += gaps[i];
+    }
+
+    double minStep = RealLast();
+    for (int32_t i = 1; i < n; i++) minStep = std::min(minStep, vParams->Value(i + 1) - vParams->Value(i));
+
+    const int32_t np = sections[0]->NbPoles();
+    std::vector<Handle(Geom_BSplineCurve)> columns(np);
+    occtParallelChunks(np, [&](int32_t b, int32_t e) {
+        for (int32_t j = b; j < e && ok; j++) {
+            Handle(TColgp_HArray1OfPnt) pts = new TColgp_HArray1OfPnt(1, n);
+            for (int32_t i = 0; i < n; i++) pts->SetValue(i + 1, sections[i]->Pole(j + 1));
+            try {
+                // Neighbouring sections may legitimately share a pole (a common edge point),
+                // which GeomAPI_Interpolate rejects even at zero tolerance. Interpolation is
+                // linear and reproduces v ↦ v·shift exactly, so such a column is interpolated
+                // with a shift large enough to separate every point, then the shift's own
+                // poles (shift times the Greville abscissae) are taken off again.
+                double maxJump = 0;
+                bool coincident = false;
+                for (int32_t i = 1; i < n; i++) {
+                    const double d = pts->Value(i).Distance(pts->Value(i + 1));
+                    maxJump = std::max(maxJump, d);
+                    coincident = coincident || d <= Precision::Confusion();
+                }
+                const gp_Vec shift = coincident ? gp_Vec(0, 0, (maxJump + 1.0) / minStep) : gp_Vec();
+                if (coincident) {
+                    for (int32_t i = 1; i <= n; i++) pts->ChangeValue(i).Translate(vParams->Value(i) * shift);
+                }
+                GeomAPI_Interpolate interp(pts, vParams, Standard_False, Precision::Confusion());
+                interp.Perform();
+                if (!interp.IsDone()) {
+                    ok = false;
+                    continue;
+                }
+                Handle(Geom_BSplineCurve) c = interp.Curve();
+                if (coincident) {
+                    const int32_t d = c->Degree();
+                    TColStd_Array1OfReal flat(1, c->NbPoles() + d + 1);
+                    c->KnotSequence(flat);
+                    for (int32_t l = 1; l <= c->NbPoles(); l++) {
+                        double greville = 0;
+                        for (int32_t r = l + 1; r <= l + d; r++) greville += flat(r);
+                        c->SetPole(l, c->Pole(l).Translated(-(greville / d) * shift));
+                    }
+                }
+                columns[j] = c;
+            } catch (...) {
+                ok = false;
+            }
+        }
+    }, parallel);
+    if (!ok) return nullptr;
+
+    const Handle(Geom_BSplineCurve)& row = sections[0];
+    const Handle(Geom_BSplineCurve)& col = columns[0];
+    TColgp_Array2OfPnt poles(1, np, 1, col->NbPoles());
+    for (int32_t j = 0; j < np; j++)
+        for (int32_t l = 1; l <= col->NbPoles(); l++) poles.SetValue(j + 1, l, columns[j]->Pole(l));
+    return new Geom_BSplineSurface(poles, row->Knots(), col->Knots(),
+                                   row->Multiplicities(), col->Multiplicities(),
+                                   row->Degree(), col->Degree());
+}
+
+/// Lateral face, or a solid closed with planar caps on the first and last sections.
+OCCTShapeRef loftResult(const Handle(Geom_BSplineSurface)& surface, bool capped) {
+    if (surface.IsNull()) return nullptr;
+    BRepBuilderAPI_MakeFace lateral(surface, Precision::Confusion());
+    if (!lateral.IsDone()) return nullptr;
+    if (!capped) return new OCCTShape(lateral.Face());
+
+    double u1, u2, v1, v2;
+    surface->Bounds(u1, u2, v1, v2);
+    BRepBuilderAPI_Sewing sewer(1e-6);
+    sewer.Add(lateral.Face());
+    for (double v : {v1, v2}) {
+        BRepBuilderAPI_MakeWire wire(BRepBuilderAPI_MakeEdge(surface->VIso(v)).Edge());
+        if (!wire.IsDone()) return nullptr;
+        BRepBuilderAPI_MakeFace cap(wire.Wire(), Standard_True);
+        if (!cap.IsDone()) return nullptr;
+        sewer.Add(cap.Face());
+    }
+    sewer.Perform();
+    TopExp_Explorer se(sewer.SewedShape(), TopAbs_SHELL);
+    if (!se.More()) return nullptr;
+    TopoDS_Solid solid = BRepBuilderAPI_MakeSolid(TopoDS::Shell(se.Current())).Solid();
+    BRepLib::OrientClosedSolid(solid);
+    return new OCCTShape(solid);
+}
+
+int32_t loftSampleCount(int32_t samples) { return samples <= 0 ? 64 : std::max(samples, 4); }
+
+} // namespace
+
+OCCTShapeRef OCCTShapeCreateLoftResampled(const OCCTWireRef* profiles, int32_t count, bool solid,
+                                          int32_t samples, bool parallel) {
+    if (!profiles || count < 2) return nullptr;
+    for (int32_t i = 0; i < count; i++) if (!profiles[i]) return nullptr;
+    const int32_t m = loftSampleCount(samples);
+    try {
+        std::vector<LoftSection> grid(count);
+        std::vector<char> closed(count, 0);
+        std::atomic<bool> ok{true};
+        occtParallelChunks(count, [&](int32_t b, int32_t e) {
+            for (int32_t i = b; i < e && ok; i++) {
+                bool c = false;
+                try {
+                    if (!loftSampleWire(profiles[i]->wire, m, grid[i], c)) ok = false;
+                } catch (...) {
+                    ok = false;
+                }
+                closed[i] = c;
+            }
+        }, parallel);
+        if (!ok) return nullptr;
+        // Mixed open and closed sections have no common parameterization.
+        if (std::any_of(closed.begin(), closed.end(), [&](char c) { return c != closed[0]; })) return nullptr;
+
+        loftAlign(grid, closed[0], parallel);
+        return loftResult(loftSkin(grid, closed[0], parallel), solid && closed[0]);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OCCTShapeRef OCCTShapeCreateSweepResampled(OCCTWireRef profile, OCCTWireRef spine,
+                                           int32_t stations, bool solid,
+                                           int32_t samples, bool parallel) {
+    if (!profile || !spine || stations < 2) return nullptr;
+    try {
+        LoftSection base;
+        bool closed = false;
+        if (!loftSampleWire(profile->wire, loftSampleCount(samples), base, closed)) return nullptr;
+
+        BRepAdaptor_CompCurve path(spine->wire);
+        GCPnts_UniformAbscissa ua(path, stations, path.FirstParameter(), path.LastParameter());
+        if (!ua.IsDone() || ua.NbPoints() != stations) return nullptr;
+        std::vector<gp_Pnt> origin(stations);
+        std::vector<gp_Vec> tangent(stations);
+        for (int32_t i = 0; i < stations; i++) {
+            path.D1(ua.Parameter(i + 1), origin[i], tangent[i]);
+            if (tangent[i].SquareMagnitude() < gp::Resolution()) return nullptr;
+            tangent[i].Normalize();
+        }
+
+        // Rotation-minimizing frames by double reflection (Wang et al.): serial but O(stations).
+        std::vector<gp_Vec> ref(stations);
+        ref[0] = gp_Vec(gp_Ax2(origin[0], gp_Dir(tangent[0])).XDirection());
+        for (int32_t i = 0; i + 1 < stations; i++) {
+            const gp_Vec v1(origin[i], origin[i + 1]);
+            const double c1 = v1.SquareMagnitude();
+            gp_Vec r = ref[i], t = tangent[i];
+            if (c1 > gp::Resolution()) {
+                r -= v1 * (2.0 / c1 * v1.Dot(r));
+                t -= v1 * (2.0 / c1 * v1.Dot(t));
+            }
+            const gp_Vec v2 = tangent[i + 1] - t;
+            const double c2 = v2.SquareMagnitude();
+            if (c2 > gp::Resolution()) r -= v2 * (2.0 / c2 * v2.Dot(r));
+            // Re-orthogonalize against drift over long spines.
+            r -= tangent[i + 1] * r.Dot(tangent[i + 1]);
+            if (r.SquareMagnitude() < gp::Resolution()) return nullptr;
+            ref[i + 1] = r.Normalized();
+        }
+
+        // Placed copies of one sampled profile are already compatible: no alignment pass.
+        const gp_Ax3 start(origin[0], gp_Dir(tangent[0]), gp_Dir(ref[0]));
+        std::vector<LoftSection> grid(stations);
+        occtParallelChunks(stations, [&](int32_t b, int32_t e) {
+            for (int32_t i = b; i < e; i++) {
+                gp_Trsf place;
+                place.SetDisplacement(start, gp_Ax3(origin[i], gp_Dir(tangent[i]), gp_Dir(ref[i])));
+                grid[i].resize(base.size());
+                for (size_t k = 0; k < base.size(); k++) grid[i][k] = base[k].Transformed(place);
+            }
+        }, parallel);
+        return loftResult(loftSkin(grid, closed, parallel), solid && closed);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
 // MARK: - Offset with Join Type (v0.32.0)
 
 OCCTShapeRef OCCTShapeOffsetByJoin(OCCTShapeRef shape, double distance,
@@ -1367,8 +2043,7 @@ OCCTShapeRef OCCTShapeDraftPrism(OCCTShapeRef shape, int32_t profileFace,
                                   double height, bool fuse) {
     if (!shape || !profile) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         int32_t fi = profileFace + 1;
         if (fi < 1 || fi > faceMap.Extent()) return nullptr;
         TopoDS_Face sketchFace = TopoDS::Face(faceMap(fi));
@@ -1394,8 +2069,7 @@ OCCTShapeRef OCCTShapeDraftPrismThruAll(OCCTShapeRef shape, int32_t profileFace,
                                          bool fuse) {
     if (!shape || !profile) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         int32_t fi = profileFace + 1;
         if (fi < 1 || fi > faceMap.Extent()) return nullptr;
         TopoDS_Face sketchFace = TopoDS::Face(faceMap(fi));
@@ -1426,8 +2100,7 @@ OCCTShapeRef OCCTShapeRevolFeature(OCCTShapeRef shape, int32_t profileFace,
                                     double angleDeg, bool fuse) {
     if (!shape || !profile) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         int32_t fi = profileFace + 1;
         if (fi < 1 || fi > faceMap.Extent()) return nullptr;
         TopoDS_Face sketchFace = TopoDS::Face(faceMap(fi));
@@ -1456,8 +2129,7 @@ OCCTShapeRef OCCTShapeRevolFeatureThruAll(OCCTShapeRef shape, int32_t profileFac
                                            bool fuse) {
     if (!shape || !profile) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         int32_t fi = profileFace + 1;
         if (fi < 1 || fi > faceMap.Extent()) return nullptr;
         TopoDS_Face sketchFace = TopoDS::Face(faceMap(fi));
@@ -1524,8 +2196,7 @@ bool OCCTShapeBooleanCheck(OCCTShapeRef shape1, OCCTShapeRef shape2) {
 OCCTShapeRef OCCTShapeSplitByWire(OCCTShapeRef shape, OCCTWireRef wire, int32_t faceIndex) {
     if (!shape || !wire) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         int32_t idx = faceIndex + 1; // Convert 0-based to 1-based
         if (idx < 1 || idx > faceMap.Extent()) return nullptr;
         TopoDS_Face face = TopoDS::Face(faceMap(idx));
@@ -1575,8 +2246,7 @@ int32_t OCCTWireMultiOffset(OCCTShapeRef face, const double* offsets, int32_t co
     if (!face || !offsets || count < 1 || !outWires || maxWires < 1) return 0;
     try {
         // Extract the face from the shape
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(face->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = face->subShapes(TopAbs_FACE);
         if (faceMap.Extent() < 1) return 0;
         TopoDS_Face topoFace = TopoDS::Face(faceMap(1));
 
@@ -1683,13 +2353,18 @@ int32_t OCCTShapeFuseWithHistory(OCCTShapeRef shape1, OCCTShapeRef shape2,
 #include <memory>
 
 struct OCCTBooleanHistory {
+    // Whatever `op` borrows and must outlive it — e.g. the shared pave filler of a
+    // boolean session, which a builder only points to. Declared before `op` so it is
+    // destroyed after it: members are destroyed in reverse declaration order.
+    std::shared_ptr<void> keepAlive;
     // Builder kept alive for the lifetime of the handle. unique_ptr because
     // BRepBuilderAPI_MakeShape carries large internal state and is not
     // safely copyable. Upcast from concrete Fuse / Cut / Common / Splitter.
     std::unique_ptr<BRepBuilderAPI_MakeShape> op;
 
-    explicit OCCTBooleanHistory(std::unique_ptr<BRepBuilderAPI_MakeShape> theOp)
-        : op(std::move(theOp)) {}
+    explicit OCCTBooleanHistory(std::unique_ptr<BRepBuilderAPI_MakeShape> theOp,
+                                std::shared_ptr<void> theKeepAlive = nullptr)
+        : keepAlive(std::move(theKeepAlive)), op(std::move(theOp)) {}
 };
 
 OCCTBooleanHistoryRef OCCTBooleanUnionWithHistory(OCCTShapeRef shape1, OCCTShapeRef shape2,
@@ -1833,8 +2508,7 @@ OCCTBooleanHistoryRef OCCTShapeHistoryFromFilletEdges(OCCTShapeRef shape,
     if (outResult) *outResult = nullptr;
     if (!shape || !edgeIndices || count < 1) return nullptr;
     try {
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
         std::unique_ptr<BRepFilletAPI_MakeFillet> op(new BRepFilletAPI_MakeFillet(shape->shape));
         for (int32_t i = 0; i < count; i++) {
             int32_t idx = edgeIndices[i] + 1; // 0-based to 1-based
@@ -1857,8 +2531,7 @@ OCCTBooleanHistoryRef OCCTShapeHistoryFromFilletEdgeVariable(OCCTShapeRef shape,
     if (outResult) *outResult = nullptr;
     if (!shape) return nullptr;
     try {
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
         int32_t idx = edgeIndex + 1;
         if (idx < 1 || idx > edgeMap.Extent()) return nullptr;
         TopoDS_Edge edge = TopoDS::Edge(edgeMap(idx));
@@ -1885,8 +2558,7 @@ OCCTBooleanHistoryRef OCCTShapeHistoryFromChamferEdges(OCCTShapeRef shape,
     if (outResult) *outResult = nullptr;
     if (!shape || !edgeIndices || count < 1) return nullptr;
     try {
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
         std::unique_ptr<BRepFilletAPI_MakeChamfer> op(new BRepFilletAPI_MakeChamfer(shape->shape));
         for (int32_t i = 0; i < count; i++) {
             int32_t idx = edgeIndices[i] + 1;
@@ -1909,8 +2581,7 @@ OCCTBooleanHistoryRef OCCTShapeHistoryFromShell(OCCTShapeRef shape,
     if (outResult) *outResult = nullptr;
     if (!shape || !faceIndices || faceCount < 1) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         TopTools_ListOfShape closingFaces;
         for (int32_t i = 0; i < faceCount; ++i) {
             int32_t idx = faceIndices[i] + 1;
@@ -1935,8 +2606,7 @@ OCCTBooleanHistoryRef OCCTShapeHistoryFromDefeature(OCCTShapeRef shape,
     if (outResult) *outResult = nullptr;
     if (!shape || !faceIndices || faceCount < 1) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         TopTools_ListOfShape facesToRemove;
         for (int32_t i = 0; i < faceCount; ++i) {
             int32_t idx = faceIndices[i] + 1;
@@ -1964,8 +2634,7 @@ OCCTShapeRef OCCTShapeMakeThickSolid(OCCTShapeRef shape, const int32_t* faceIndi
                                       int32_t joinType) {
     if (!shape || !faceIndices || faceCount < 1) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
 
         TopTools_ListOfShape closingFaces;
         for (int32_t i = 0; i < faceCount; ++i) {
@@ -2390,8 +3059,7 @@ OCCTShapeRef OCCTShapeFilletEvolving(OCCTShapeRef shape,
                                       const int32_t* pointCounts) {
     if (!shape || !edgeIndices || edgeCount <= 0 || !radiusPoints || !pointCounts) return nullptr;
     try {
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
 
         BRepFilletAPI_MakeFillet fillet(shape->shape);
 
@@ -2436,8 +3104,7 @@ OCCTShapeRef OCCTShapeOffsetPerFace(OCCTShapeRef shape, double defaultOffset,
                                      int32_t faceCount, double tolerance, int32_t joinType) {
     if (!shape) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
 
         GeomAbs_JoinType jt = GeomAbs_Arc;
         if (joinType == 1) jt = GeomAbs_Tangent;
@@ -2503,8 +3170,7 @@ OCCTShapeRef OCCTShapePipeFeature(OCCTShapeRef shape, int32_t profileFaceIndex,
                                    int32_t fuse) {
     if (!shape || !spine) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
 
         int32_t profIdx = profileFaceIndex + 1;
         int32_t sketchIdx = sketchFaceIndex + 1;
@@ -2532,8 +3198,7 @@ OCCTShapeRef OCCTShapePipeFeatureFromProfile(OCCTShapeRef baseShape, OCCTShapeRe
                                               int32_t fuse) {
     if (!baseShape || !profileShape || !spine) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(baseShape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = baseShape->subShapes(TopAbs_FACE);
 
         int32_t sketchIdx = sketchFaceIndex + 1;
         if (sketchIdx < 1 || sketchIdx > faceMap.Extent()) return nullptr;
@@ -2575,8 +3240,7 @@ OCCTShapeRef OCCTShapePrismUntilFace(OCCTShapeRef baseShape, OCCTShapeRef profil
                                       int32_t fuse, int32_t untilFaceIndex) {
     if (!baseShape || !profileShape) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(baseShape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = baseShape->subShapes(TopAbs_FACE);
 
         int32_t sketchIdx = sketchFaceIndex + 1;
         if (sketchIdx < 1 || sketchIdx > faceMap.Extent()) return nullptr;
@@ -3099,65 +3763,15 @@ OCCTShapeRef OCCTShapeCreateEvolved(OCCTWireRef spine, OCCTWireRef profile) {
 OCCTShapeRef OCCTShapeLinearPattern(OCCTShapeRef shape,
                                      double dirX, double dirY, double dirZ,
                                      double spacing, int32_t count) {
-    if (!shape || count < 1) return nullptr;
-
-    try {
-        BRep_Builder builder;
-        TopoDS_Compound compound;
-        builder.MakeCompound(compound);
-
-        gp_Vec direction(dirX, dirY, dirZ);
-        direction.Normalize();
-
-        for (int32_t i = 0; i < count; i++) {
-            gp_Trsf transform;
-            transform.SetTranslation(direction * (spacing * i));
-
-            BRepBuilderAPI_Transform xform(shape->shape, transform, true);
-            if (xform.IsDone()) {
-                builder.Add(compound, xform.Shape());
-            }
-        }
-
-        return new OCCTShape(compound);
-    } catch (...) {
-        return nullptr;
-    }
+    return OCCTShapeLinearPatternEx(shape, dirX, dirY, dirZ, spacing, count, OCCTPatternModeCopy);
 }
 
 OCCTShapeRef OCCTShapeCircularPattern(OCCTShapeRef shape,
                                        double axisX, double axisY, double axisZ,
                                        double axisDirX, double axisDirY, double axisDirZ,
                                        int32_t count, double angle) {
-    if (!shape || count < 1) return nullptr;
-
-    try {
-        BRep_Builder builder;
-        TopoDS_Compound compound;
-        builder.MakeCompound(compound);
-
-        gp_Pnt axisPoint(axisX, axisY, axisZ);
-        gp_Dir axisDir(axisDirX, axisDirY, axisDirZ);
-        gp_Ax1 axis(axisPoint, axisDir);
-
-        // If angle is 0, use full circle
-        double totalAngle = (angle == 0) ? (2.0 * M_PI) : angle;
-        double stepAngle = totalAngle / count;
-
-        for (int32_t i = 0; i < count; i++) {
-            gp_Trsf transform;
-            transform.SetRotation(axis, stepAngle * i);
-
-            BRepBuilderAPI_Transform xform(shape->shape, transform, true);
-            if (xform.IsDone()) {
-                builder.Add(compound, xform.Shape());
-            }
-        }
-
-        return new OCCTShape(compound);
-    } catch (...) {
-        return nullptr;
-    }
+    return OCCTShapeCircularPatternEx(shape, axisX, axisY, axisZ, axisDirX, axisDirY, axisDirZ,
+                                      count, angle, OCCTPatternModeCopy);
 }
 
 // MARK: - Wire Creation (2D Profiles)
@@ -5130,8 +5744,7 @@ bool OCCTLocOpeBuildWires(OCCTShapeRef shape, int32_t faceIndex,
     try {
         NCollection_List<TopoDS_Shape> edges;
         if (faceIndex > 0) {
-            TopTools_IndexedMapOfShape faceMap;
-            TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+            const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
             if (faceIndex > faceMap.Extent()) return false;
             TopoDS_Face face = TopoDS::Face(faceMap(faceIndex));
             TopExp_Explorer exp(face, TopAbs_EDGE);
@@ -5163,8 +5776,7 @@ OCCTShapeRef _Nullable OCCTLocOpeSplitByWireOnFace(OCCTShapeRef shape,
     OCCTShapeRef wire, int32_t faceIndex) {
     if (!shape || !wire) return nullptr;
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         if (faceIndex < 1 || faceIndex > faceMap.Extent()) return nullptr;
         TopoDS_Face face = TopoDS::Face(faceMap(faceIndex));
 
@@ -9925,53 +10537,457 @@ private:
 };
 DEFINE_STANDARD_HANDLE(OCCTBoolTimeoutBreaker, Message_ProgressIndicator)
 
-// Shared driver: BRepAlgoAPI_Fuse/Cut/Common all derive from
-// BRepAlgoAPI_BooleanOperation, so the option setters are identical across ops.
-// timeoutSeconds <= 0 means no time bound (run to completion).
-template <typename BoolOpT>
-static OCCTShapeRef runBooleanEx(OCCTShapeRef shape1, OCCTShapeRef shape2,
-                                 double fuzzyValue, int32_t glue, double timeoutSeconds) {
-    if (!shape1 || !shape2) return nullptr;
+// --- Boolean options (OCCTBooleanOptions) ---
+
+#include <BOPAlgo_PaveFiller.hxx>
+
+OCCTBooleanOptions OCCTBooleanOptionsDefault(void) {
+    OCCTBooleanOptions o;
+    o.runParallel = false;
+    o.useOBB = false;
+    o.nonDestructive = false;
+    o.checkInverted = true;
+    o.glue = 0;
+    o.fuzzyValue = 0.0;
+    o.timeoutSeconds = 0.0;
+    return o;
+}
+
+// Every BRepAlgoAPI boolean, section and splitter derives from BRepAlgoAPI_BuilderAlgo,
+// which carries all of the option setters.
+static void applyBooleanOptions(BRepAlgoAPI_BuilderAlgo& op, const OCCTBooleanOptions& o) {
+    op.SetRunParallel(o.runParallel);
+    op.SetUseOBB(o.useOBB);
+    op.SetNonDestructive(o.nonDestructive);
+    op.SetCheckInverted(o.checkInverted);
+    if (o.fuzzyValue > 0.0) op.SetFuzzyValue(o.fuzzyValue);
+    switch (o.glue) {
+        case 1:  op.SetGlue(BOPAlgo_GlueShift); break;
+        case 2:  op.SetGlue(BOPAlgo_GlueFull);  break;
+        default: op.SetGlue(BOPAlgo_GlueOff);   break;
+    }
+}
+
+// Builder for an OCCTBooleanOp with its operand lists set. General fuse has no tool
+// group: objects and tools are all arguments. With `filler`, the builder reuses that
+// already-performed intersection instead of running its own; the filler must have been
+// given exactly these objects and tools, and must outlive the builder.
+template <typename BuilderT>
+static BuilderT* newBooleanBuilderOf(const BOPAlgo_PaveFiller* filler) {
+    return filler ? new BuilderT(*filler) : new BuilderT();
+}
+
+static std::unique_ptr<BRepAlgoAPI_BuilderAlgo> newBooleanBuilder(int32_t kind,
+                                                                  const TopTools_ListOfShape& objects,
+                                                                  const TopTools_ListOfShape& tools,
+                                                                  const BOPAlgo_PaveFiller* filler = nullptr) {
+    std::unique_ptr<BRepAlgoAPI_BooleanOperation> boolOp;
+    bool reversed = false;
+    switch (kind) {
+        case OCCTBooleanOpFuse:    boolOp.reset(newBooleanBuilderOf<BRepAlgoAPI_Fuse>(filler));    break;
+        case OCCTBooleanOpCut:     boolOp.reset(newBooleanBuilderOf<BRepAlgoAPI_Cut>(filler));     break;
+        case OCCTBooleanOpCommon:  boolOp.reset(newBooleanBuilderOf<BRepAlgoAPI_Common>(filler));  break;
+        case OCCTBooleanOpSection: boolOp.reset(newBooleanBuilderOf<BRepAlgoAPI_Section>(filler)); break;
+        case OCCTBooleanOpCutReversed:
+            boolOp.reset(newBooleanBuilderOf<BRepAlgoAPI_Cut>(filler));
+            reversed = true;
+            break;
+        case OCCTBooleanOpSplit: {
+            std::unique_ptr<BRepAlgoAPI_Splitter> splitter(newBooleanBuilderOf<BRepAlgoAPI_Splitter>(filler));
+            splitter->SetArguments(objects);
+            splitter->SetTools(tools);
+            return splitter;
+        }
+        case OCCTBooleanOpGeneralFuse: {
+            std::unique_ptr<BRepAlgoAPI_BuilderAlgo> builder(newBooleanBuilderOf<BRepAlgoAPI_BuilderAlgo>(filler));
+            TopTools_ListOfShape all(objects);
+            for (TopTools_ListIteratorOfListOfShape it(tools); it.More(); it.Next()) all.Append(it.Value());
+            builder->SetArguments(all);
+            return builder;
+        }
+        default: return nullptr;
+    }
+    boolOp->SetArguments(reversed ? tools : objects);
+    boolOp->SetTools(reversed ? objects : tools);
+    return boolOp;
+}
+
+// Shared driver for every boolean / splitter entry point: set options, build under the
+// wall-clock watchdog (timeoutSeconds <= 0 = run to completion). Returns the built
+// builder (for history queries), or nullptr on failure or timeout.
+static std::unique_ptr<BRepAlgoAPI_BuilderAlgo> runBooleanBuilder(int32_t kind,
+                                                                  const TopTools_ListOfShape& objects,
+                                                                  const TopTools_ListOfShape& tools,
+                                                                  const OCCTBooleanOptions& options,
+                                                                  const BOPAlgo_PaveFiller* filler = nullptr) {
     occtEnsureSignals();
     try {
         OCC_CATCH_SIGNALS
-        BoolOpT op;
-        TopTools_ListOfShape args;  args.Append(shape1->shape);
-        TopTools_ListOfShape tools; tools.Append(shape2->shape);
-        op.SetArguments(args);
-        op.SetTools(tools);
-        if (fuzzyValue > 0.0) op.SetFuzzyValue(fuzzyValue);
-        switch (glue) {
-            case 1:  op.SetGlue(BOPAlgo_GlueShift); break;
-            case 2:  op.SetGlue(BOPAlgo_GlueFull);  break;
-            default: op.SetGlue(BOPAlgo_GlueOff);   break;
-        }
-        if (timeoutSeconds > 0.0) {
-            Handle(OCCTBoolTimeoutBreaker) breaker = new OCCTBoolTimeoutBreaker(timeoutSeconds);
+        std::unique_ptr<BRepAlgoAPI_BuilderAlgo> op = newBooleanBuilder(kind, objects, tools, filler);
+        if (!op) return nullptr;
+        applyBooleanOptions(*op, options);
+        if (options.timeoutSeconds > 0.0) {
+            Handle(OCCTBoolTimeoutBreaker) breaker = new OCCTBoolTimeoutBreaker(options.timeoutSeconds);
             Message_ProgressRange range = breaker->Start();
-            op.Build(range);
+            op->Build(range);
         } else {
-            op.Build();
+            op->Build();
         }
         // IsDone() is false both on genuine failure and when the watchdog
         // interrupted the build — either way there is no usable result.
-        if (!op.IsDone()) return nullptr;
-        return new OCCTShape(op.Shape());
+        if (!op->IsDone() || op->Shape().IsNull()) return nullptr;
+        return op;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+static bool collectBooleanOperands(const OCCTShapeRef* shapes, int32_t count, TopTools_ListOfShape& out) {
+    if (count > 0 && !shapes) return false;
+    for (int32_t i = 0; i < count; ++i) {
+        if (!shapes[i]) return false;
+        out.Append(shapes[i]->shape);
+    }
+    return true;
+}
+
+static OCCTShapeRef runBooleanEx(int32_t kind, OCCTShapeRef shape1, OCCTShapeRef shape2,
+                                 double fuzzyValue, int32_t glue, double timeoutSeconds) {
+    if (!shape1 || !shape2) return nullptr;
+    OCCTBooleanOptions options = OCCTBooleanOptionsDefault();
+    options.fuzzyValue = fuzzyValue;
+    options.glue = glue;
+    options.timeoutSeconds = timeoutSeconds;
+    return OCCTShapeBooleanWithOptions((OCCTBooleanOp)kind, &shape1, 1, &shape2, 1, &options);
+}
+
+// One object against many tools in a single BOP pass: the pave filler intersects every
+// pair once, instead of N passes over an ever more complex intermediate result. The
+// thread pool and OBB pre-filtering pay off once there are many tools.
+static OCCTShapeRef runBooleanMulti(int32_t kind, OCCTShapeRef object, const OCCTShapeRef* tools, int32_t count,
+                                    double fuzzyValue, int32_t glue, double timeoutSeconds) {
+    if (!object || !tools || count < 1) return nullptr;
+    OCCTBooleanOptions options = OCCTBooleanOptionsDefault();
+    options.runParallel = true;
+    options.useOBB = true;
+    options.fuzzyValue = fuzzyValue;
+    options.glue = glue;
+    options.timeoutSeconds = timeoutSeconds;
+    return OCCTShapeBooleanWithOptions((OCCTBooleanOp)kind, &object, 1, tools, count, &options);
+}
+
+OCCTShapeRef OCCTShapeBooleanWithOptions(OCCTBooleanOp op,
+                                         const OCCTShapeRef* objects, int32_t objectCount,
+                                         const OCCTShapeRef* tools, int32_t toolCount,
+                                         const OCCTBooleanOptions* options) {
+    if (objectCount < 1) return nullptr;
+    try {
+        TopTools_ListOfShape objectList, toolList;
+        if (!collectBooleanOperands(objects, objectCount, objectList)) return nullptr;
+        if (!collectBooleanOperands(tools, toolCount, toolList)) return nullptr;
+        auto builder = runBooleanBuilder(op, objectList, toolList,
+                                         options ? *options : OCCTBooleanOptionsDefault());
+        if (!builder) return nullptr;
+        return new OCCTShape(builder->Shape());
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OCCTBooleanHistoryRef OCCTBooleanWithOptionsAndHistory(OCCTBooleanOp op,
+                                                       const OCCTShapeRef* objects, int32_t objectCount,
+                                                       const OCCTShapeRef* tools, int32_t toolCount,
+                                                       const OCCTBooleanOptions* options,
+                                                       OCCTShapeRef* outResult) {
+    if (outResult) *outResult = nullptr;
+    if (objectCount < 1) return nullptr;
+    try {
+        TopTools_ListOfShape objectList, toolList;
+        if (!collectBooleanOperands(objects, objectCount, objectList)) return nullptr;
+        if (!collectBooleanOperands(tools, toolCount, toolList)) return nullptr;
+        auto builder = runBooleanBuilder(op, objectList, toolList,
+                                         options ? *options : OCCTBooleanOptionsDefault());
+        if (!builder) return nullptr;
+        if (outResult) *outResult = new OCCTShape(builder->Shape());
+        return new OCCTBooleanHistory(std::move(builder));
     } catch (...) {
         return nullptr;
     }
 }
 
 OCCTShapeRef OCCTShapeUnionEx(OCCTShapeRef shape1, OCCTShapeRef shape2, double fuzzyValue, int32_t glue, double timeoutSeconds) {
-    return runBooleanEx<BRepAlgoAPI_Fuse>(shape1, shape2, fuzzyValue, glue, timeoutSeconds);
+    return runBooleanEx(OCCTBooleanOpFuse, shape1, shape2, fuzzyValue, glue, timeoutSeconds);
 }
 
 OCCTShapeRef OCCTShapeSubtractEx(OCCTShapeRef shape1, OCCTShapeRef shape2, double fuzzyValue, int32_t glue, double timeoutSeconds) {
-    return runBooleanEx<BRepAlgoAPI_Cut>(shape1, shape2, fuzzyValue, glue, timeoutSeconds);
+    return runBooleanEx(OCCTBooleanOpCut, shape1, shape2, fuzzyValue, glue, timeoutSeconds);
 }
 
 OCCTShapeRef OCCTShapeIntersectEx(OCCTShapeRef shape1, OCCTShapeRef shape2, double fuzzyValue, int32_t glue, double timeoutSeconds) {
-    return runBooleanEx<BRepAlgoAPI_Common>(shape1, shape2, fuzzyValue, glue, timeoutSeconds);
+    return runBooleanEx(OCCTBooleanOpCommon, shape1, shape2, fuzzyValue, glue, timeoutSeconds);
+}
+
+OCCTShapeRef OCCTShapeSubtractMulti(OCCTShapeRef object, const OCCTShapeRef* tools, int32_t count,
+                                    double fuzzyValue, int32_t glue, double timeoutSeconds) {
+    return runBooleanMulti(OCCTBooleanOpCut, object, tools, count, fuzzyValue, glue, timeoutSeconds);
+}
+
+OCCTShapeRef OCCTShapeCommonMultiTool(OCCTShapeRef object, const OCCTShapeRef* tools, int32_t count,
+                                      double fuzzyValue, int32_t glue, double timeoutSeconds) {
+    return runBooleanMulti(OCCTBooleanOpCommon, object, tools, count, fuzzyValue, glue, timeoutSeconds);
+}
+
+// --- Boolean session: one pave filler, many operations ---
+
+// The intersection phase (BOPAlgo_PaveFiller) dominates boolean cost and depends only
+// on the operands, not on the operation. A session runs it once and builds each
+// requested result from the shared data structure. Builders only point to the filler,
+// so it is shared with every history handed out and lives as long as the last of them.
+struct OCCTBooleanSession {
+    TopTools_ListOfShape objects;
+    TopTools_ListOfShape tools;
+    OCCTBooleanOptions options;
+    std::shared_ptr<BOPAlgo_PaveFiller> filler;
+    // Builders read (and on some paths touch) the filler's data structure; one at a time.
+    std::mutex mutex;
+};
+
+OCCTBooleanSessionRef OCCTBooleanSessionCreate(const OCCTShapeRef* objects, int32_t objectCount,
+                                               const OCCTShapeRef* tools, int32_t toolCount,
+                                               const OCCTBooleanOptions* options) {
+    if (objectCount < 1) return nullptr;
+    occtEnsureSignals();
+    try {
+        OCC_CATCH_SIGNALS
+        auto session = std::make_unique<OCCTBooleanSession>();
+        if (!collectBooleanOperands(objects, objectCount, session->objects)) return nullptr;
+        if (!collectBooleanOperands(tools, toolCount, session->tools)) return nullptr;
+        session->options = options ? *options : OCCTBooleanOptionsDefault();
+        const OCCTBooleanOptions& o = session->options;
+
+        TopTools_ListOfShape all(session->objects);
+        for (TopTools_ListIteratorOfListOfShape it(session->tools); it.More(); it.Next()) all.Append(it.Value());
+
+        auto filler = std::make_shared<BOPAlgo_PaveFiller>();
+        filler->SetArguments(all);
+        filler->SetRunParallel(o.runParallel);
+        filler->SetUseOBB(o.useOBB);
+        filler->SetNonDestructive(o.nonDestructive);
+        if (o.fuzzyValue > 0.0) filler->SetFuzzyValue(o.fuzzyValue);
+        switch (o.glue) {
+            case 1:  filler->SetGlue(BOPAlgo_GlueShift); break;
+            case 2:  filler->SetGlue(BOPAlgo_GlueFull);  break;
+            default: filler->SetGlue(BOPAlgo_GlueOff);   break;
+        }
+        if (o.timeoutSeconds > 0.0) {
+            Handle(OCCTBoolTimeoutBreaker) breaker = new OCCTBoolTimeoutBreaker(o.timeoutSeconds);
+            Message_ProgressRange range = breaker->Start();
+            filler->Perform(range);
+        } else {
+            filler->Perform();
+        }
+        if (filler->HasErrors()) return nullptr;
+        session->filler = std::move(filler);
+        return session.release();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTBooleanSessionRelease(OCCTBooleanSessionRef session) {
+    delete session;
+}
+
+bool OCCTBooleanSessionHasWarnings(OCCTBooleanSessionRef session) {
+    if (!session) return false;
+    return session->filler->HasWarnings();
+}
+
+OCCTShapeRef OCCTBooleanSessionResult(OCCTBooleanSessionRef session, OCCTBooleanOp op) {
+    if (!session) return nullptr;
+    try {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        auto builder = runBooleanBuilder(op, session->objects, session->tools, session->options,
+                                         session->filler.get());
+        if (!builder) return nullptr;
+        return new OCCTShape(builder->Shape());
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OCCTBooleanHistoryRef OCCTBooleanSessionResultWithHistory(OCCTBooleanSessionRef session, OCCTBooleanOp op,
+                                                          OCCTShapeRef* outResult) {
+    if (outResult) *outResult = nullptr;
+    if (!session) return nullptr;
+    try {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        auto builder = runBooleanBuilder(op, session->objects, session->tools, session->options,
+                                         session->filler.get());
+        if (!builder) return nullptr;
+        if (outResult) *outResult = new OCCTShape(builder->Shape());
+        return new OCCTBooleanHistory(std::move(builder), session->filler);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+// --- Pattern modes (copy / instanced / fused) ---
+
+#include <Bnd_OBB.hxx>
+#include <TopLoc_Location.hxx>
+
+// Instance i of a linear pattern (i * spacing along dir) or a circular one (i * step about axis).
+static std::vector<gp_Trsf> patternTransforms(bool circular, const gp_Ax1& axis, const gp_Vec& offset,
+                                              double stepAngle, int32_t count) {
+    std::vector<gp_Trsf> trsfs((size_t)count);
+    for (int32_t i = 0; i < count; i++) {
+        if (circular) trsfs[i].SetRotation(axis, stepAngle * i);
+        else trsfs[i].SetTranslation(offset * i);
+    }
+    return trsfs;
+}
+
+// Offsets k for which instance i may touch instance i + k. Every pattern step is the same
+// rigid motion, so this is decided once, against instance 0, instead of for every pair:
+// an oriented box of the seed is moved by each transform and tested against the seed's.
+static std::vector<int32_t> patternInterferingOffsets(const TopoDS_Shape& seed, const std::vector<gp_Trsf>& trsfs) {
+    std::vector<int32_t> offsets;
+    Bnd_OBB seedBox;
+    BRepBndLib::AddOBB(seed, seedBox);
+    if (seedBox.IsVoid()) return offsets;
+    seedBox.Enlarge(Precision::Confusion());
+    for (size_t k = 1; k < trsfs.size(); k++) {
+        const gp_Trsf& t = trsfs[k];
+        Bnd_OBB moved(gp_Pnt(seedBox.Center()).Transformed(t),
+                      gp_Dir(seedBox.XDirection()).Transformed(t),
+                      gp_Dir(seedBox.YDirection()).Transformed(t),
+                      gp_Dir(seedBox.ZDirection()).Transformed(t),
+                      seedBox.XHSize(), seedBox.YHSize(), seedBox.ZHSize());
+        if (!seedBox.IsOut(moved)) offsets.push_back((int32_t)k);
+    }
+    return offsets;
+}
+
+static OCCTShapeRef buildPattern(OCCTShapeRef shape, const std::vector<gp_Trsf>& trsfs, OCCTPatternMode mode) {
+    BRep_Builder builder;
+    TopoDS_Compound compound;
+    builder.MakeCompound(compound);
+
+    if (mode == OCCTPatternModeCopy) {
+        for (const gp_Trsf& t : trsfs) {
+            BRepBuilderAPI_Transform xform(shape->shape, t, true);
+            if (xform.IsDone()) {
+                builder.Add(compound, xform.Shape());
+            }
+        }
+        return new OCCTShape(compound);
+    }
+
+    // Instances are the seed's TShapes under a new location: no geometry is copied.
+    TopTools_ListOfShape instances;
+    for (const gp_Trsf& t : trsfs) {
+        TopoDS_Shape instance = shape->shape.Moved(TopLoc_Location(t));
+        builder.Add(compound, instance);
+        instances.Append(instance);
+    }
+    if (mode == OCCTPatternModeInstanced || trsfs.size() < 2) return new OCCTShape(compound);
+
+    // Fused: disjoint instances are already the fused result; otherwise one multi-argument
+    // fuse, with OBB pre-filtering so only the neighbouring instances get intersected.
+    if (patternInterferingOffsets(shape->shape, trsfs).empty()) return new OCCTShape(compound);
+    TopTools_ListOfShape first, rest(instances);
+    first.Append(rest.First());
+    rest.RemoveFirst();
+    OCCTBooleanOptions options = OCCTBooleanOptionsDefault();
+    options.runParallel = true;
+    options.useOBB = true;
+    auto fuse = runBooleanBuilder(OCCTBooleanOpFuse, first, rest, options);
+    if (!fuse) return nullptr;
+    return new OCCTShape(fuse->Shape());
+}
+
+OCCTShapeRef OCCTShapeLinearPatternEx(OCCTShapeRef shape,
+                                      double dirX, double dirY, double dirZ,
+                                      double spacing, int32_t count, OCCTPatternMode mode) {
+    if (!shape || count < 1) return nullptr;
+
+    try {
+        gp_Vec direction(dirX, dirY, dirZ);
+        direction.Normalize();
+        return buildPattern(shape, patternTransforms(false, gp_Ax1(), direction * spacing, 0.0, count), mode);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OCCTShapeRef OCCTShapeCircularPatternEx(OCCTShapeRef shape,
+                                        double axisX, double axisY, double axisZ,
+                                        double axisDirX, double axisDirY, double axisDirZ,
+                                        int32_t count, double angle, OCCTPatternMode mode) {
+    if (!shape || count < 1) return nullptr;
+
+    try {
+        gp_Ax1 axis(gp_Pnt(axisX, axisY, axisZ), gp_Dir(axisDirX, axisDirY, axisDirZ));
+        // If angle is 0, use full circle
+        double totalAngle = (angle == 0) ? (2.0 * M_PI) : angle;
+        return buildPattern(shape, patternTransforms(true, axis, gp_Vec(), totalAngle / count, count), mode);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+// --- Feature tool bodies (FeatureScheduler) ---
+
+#include <BRepBuilderAPI_Copy.hxx>
+
+int32_t OCCTFeatureToolsBuild(const OCCTFeatureTool* tools, int32_t count, OCCTShapeRef* outShapes, bool parallel) {
+    if (!tools || !outShapes || count < 1) return 0;
+    for (int32_t i = 0; i < count; i++) outShapes[i] = nullptr;
+
+    // Making a face from a profile writes pcurves into its edges, so a wire used by two
+    // tools would be written from two threads. Every reuse after the first gets a copy.
+    std::vector<std::unique_ptr<OCCTWire>> copies;
+    std::vector<OCCTWireRef> profiles((size_t)count, nullptr);
+    try {
+        std::unordered_map<OCCTWireRef, int32_t> seen;
+        for (int32_t i = 0; i < count; i++) {
+            OCCTWireRef w = tools[i].profile;
+            if (!w) continue;
+            if (seen[w]++ == 0) { profiles[i] = w; continue; }
+            BRepBuilderAPI_Copy copier(w->wire);
+            copies.emplace_back(new OCCTWire(TopoDS::Wire(copier.Shape())));
+            profiles[i] = copies.back().get();
+        }
+    } catch (...) {
+        return 0;
+    }
+
+    std::atomic<int32_t> built(0);
+    occtParallelChunks(count, [&](int32_t begin, int32_t end) {
+        for (int32_t i = begin; i < end; i++) {
+            const OCCTFeatureTool& t = tools[i];
+            OCCTShapeRef shape = nullptr;
+            switch (t.kind) {
+                case OCCTFeatureToolExtrusion:
+                    shape = OCCTShapeCreateExtrusion(profiles[i], t.direction[0], t.direction[1], t.direction[2],
+                                                     t.extent);
+                    break;
+                case OCCTFeatureToolRevolution:
+                    shape = OCCTShapeCreateRevolution(profiles[i], t.origin[0], t.origin[1], t.origin[2],
+                                                      t.direction[0], t.direction[1], t.direction[2], t.extent);
+                    break;
+                case OCCTFeatureToolCylinder:
+                    shape = OCCTShapeCreateCylinderOriented(t.origin[0], t.origin[1], t.origin[2],
+                                                            t.direction[0], t.direction[1], t.direction[2],
+                                                            t.radius, t.extent);
+                    break;
+            }
+            outShapes[i] = shape;
+            if (shape) built++;
+        }
+    }, parallel);
+    return built.load();
 }
 
 // --- Self-intersection check (#208) ---
@@ -10197,8 +11213,7 @@ int32_t OCCTShapeGetEdgePoints(OCCTShapeRef shape, int32_t edgeIndex, double* ou
 
     try {
         // Use IndexedMap to match OCCTShapeGetTotalEdgeCount ordering
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
 
         if (edgeIndex >= edgeMap.Extent()) return 0;
 
@@ -10350,6 +11365,142 @@ OCCTWireRef* OCCTShapeSectionWiresAtZ(OCCTShapeRef shape, double z, double toler
     }
 }
 
+OCCTWireRef* OCCTShapeSectionWiresAtLevels(OCCTShapeRef shape, const double* origin, const double* normal,
+                                           const double* offsets, int32_t levelCount, double tolerance,
+                                           int32_t* outWireCounts, OCCTShapeRef* outFaces,
+                                           int32_t* outTotal, bool parallel) {
+    if (!outTotal) return nullptr;
+    *outTotal = 0;
+    if (outWireCounts) std::fill(outWireCounts, outWireCounts + std::max(levelCount, 0), 0);
+    if (outFaces) std::fill(outFaces, outFaces + std::max(levelCount, 0), nullptr);
+    if (!shape || !origin || !normal || !offsets || !outWireCounts || levelCount <= 0) return nullptr;
+
+    try {
+        const gp_Vec n(normal[0], normal[1], normal[2]);
+        if (n.Magnitude() < gp::Resolution()) return nullptr;
+        const gp_Dir dir(n);
+        const gp_Pnt o(origin[0], origin[1], origin[2]);
+
+        // Extent of every face along the normal, from its (tolerance-enlarged) bounding box.
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
+        const int32_t nbFaces = faceMap.Extent();
+        std::vector<std::pair<double, double>> extent(nbFaces);
+        occtParallelChunks(nbFaces, [&](int32_t begin, int32_t end) {
+            for (int32_t f = begin; f < end; f++) {
+                Bnd_Box box;
+                try {
+                    BRepBndLib::Add(faceMap(f + 1), box);
+                } catch (...) {
+                    box.SetVoid();
+                }
+                if (box.IsVoid()) {
+                    extent[f] = {1.0, -1.0};
+                    continue;
+                }
+                double x0, y0, z0, x1, y1, z1;
+                box.Get(x0, y0, z0, x1, y1, z1);
+                double lo = RealLast(), hi = RealFirst();
+                for (int c = 0; c < 8; c++) {
+                    const gp_Vec p((c & 1) ? x1 : x0, (c & 2) ? y1 : y0, (c & 4) ? z1 : z0);
+                    const double d = (p - gp_Vec(o.XYZ())).Dot(gp_Vec(dir));
+                    lo = std::min(lo, d);
+                    hi = std::max(hi, d);
+                }
+                extent[f] = {lo, hi};
+            }
+        }, parallel);
+
+        // Faces sorted by the low end of their extent, so a level only scans a prefix.
+        std::vector<int32_t> byLow(nbFaces);
+        std::iota(byLow.begin(), byLow.end(), 0);
+        std::sort(byLow.begin(), byLow.end(), [&](int32_t a, int32_t b) { return extent[a].first < extent[b].first; });
+        std::vector<double> lows(nbFaces);
+        for (int32_t i = 0; i < nbFaces; i++) lows[i] = extent[byLow[i]].first;
+
+        std::vector<std::vector<TopoDS_Wire>> levelWires(levelCount);
+        std::vector<TopoDS_Shape> levelFaces(levelCount);
+        occtParallelChunks(levelCount, [&](int32_t begin, int32_t end) {
+            for (int32_t l = begin; l < end; l++) {
+                try {
+                    const double h = offsets[l];
+                    TopoDS_Compound candidates;
+                    BRep_Builder builder;
+                    builder.MakeCompound(candidates);
+                    bool any = false;
+                    const int32_t prefix = (int32_t)(std::upper_bound(lows.begin(), lows.end(), h) - lows.begin());
+                    for (int32_t i = 0; i < prefix; i++) {
+                        const int32_t f = byLow[i];
+                        if (extent[f].second < h) continue;
+                        builder.Add(candidates, faceMap(f + 1));
+                        any = true;
+                    }
+                    if (!any) continue;
+
+                    // Levels share the input faces, so each section must leave them untouched.
+                    BRepAlgoAPI_Section section(candidates, gp_Pln(o.Translated(h * gp_Vec(dir)), dir), Standard_False);
+                    section.SetNonDestructive(Standard_True);
+                    section.SetRunParallel(Standard_False);
+                    section.Approximation(Standard_True);
+                    section.Build();
+                    if (!section.IsDone() || section.Shape().IsNull()) continue;
+
+                    Handle(TopTools_HSequenceOfShape) edges = new TopTools_HSequenceOfShape;
+                    for (TopExp_Explorer ex(section.Shape(), TopAbs_EDGE); ex.More(); ex.Next()) {
+                        edges->Append(ex.Current());
+                    }
+                    if (edges->Length() == 0) continue;
+
+                    Handle(TopTools_HSequenceOfShape) wires = new TopTools_HSequenceOfShape;
+                    ShapeAnalysis_FreeBounds::ConnectEdgesToWires(edges, tolerance, Standard_False, wires);
+                    for (int i = 1; i <= wires->Length(); i++) {
+                        levelWires[l].push_back(TopoDS::Wire(wires->Value(i)));
+                    }
+
+                    if (outFaces) {
+                        // WiresToFaces nests inner loops as holes of the face around them.
+                        TopoDS_Compound wireSet;
+                        builder.MakeCompound(wireSet);
+                        for (const TopoDS_Wire& w : levelWires[l]) builder.Add(wireSet, w);
+                        TopoDS_Shape faces;
+                        if (BOPAlgo_Tools::WiresToFaces(wireSet, faces) && TopExp_Explorer(faces, TopAbs_FACE).More()) {
+                            levelFaces[l] = faces;
+                        }
+                    }
+                } catch (...) {
+                    // Reported as an empty level; nothing may escape the OSD_Parallel worker.
+                    levelWires[l].clear();
+                    levelFaces[l].Nullify();
+                }
+            }
+        }, parallel);
+
+        int32_t total = 0;
+        for (int32_t l = 0; l < levelCount; l++) {
+            outWireCounts[l] = (int32_t)levelWires[l].size();
+            total += outWireCounts[l];
+            if (outFaces && !levelFaces[l].IsNull()) outFaces[l] = new OCCTShape(levelFaces[l]);
+        }
+        if (total == 0) return nullptr;
+
+        OCCTWireRef* result = new OCCTWireRef[total];
+        int32_t k = 0;
+        for (const auto& wires : levelWires) {
+            for (const TopoDS_Wire& w : wires) result[k++] = new OCCTWire(w);
+        }
+        *outTotal = total;
+        return result;
+    } catch (...) {
+        if (outFaces) {
+            for (int32_t l = 0; l < levelCount; l++) {
+                delete outFaces[l];
+                outFaces[l] = nullptr;
+            }
+        }
+        std::fill(outWireCounts, outWireCounts + levelCount, 0);
+        return nullptr;
+    }
+}
+
 void OCCTFreeWireArray(OCCTWireRef* wires, int32_t count) {
     if (!wires) return;
     for (int32_t i = 0; i < count; i++) {
@@ -10363,3 +11514,231 @@ void OCCTFreeWireArrayOnly(OCCTWireRef* wires) {
     delete[] wires;
 }
 
+
+// MARK: - Persistent Naming Index
+// Stable integer IDs for the faces / edges / vertices of an evolving shape. Each
+// modelling step is folded in from its history (retained builder or
+// BRepTools_History): modified sub-shapes keep their ID, splits map one ID to
+// several images, deletions leave the ID empty, and anything new gets a fresh ID
+// (remembering the ID it was generated from). Lookups in both directions are hash
+// lookups, so feature replays resolve selectors without any geometric search.
+
+#include <NCollection_DataMap.hxx>
+#include <BRepTools_History.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+struct OCCTNamingEntry {
+    TopAbs_ShapeEnum kind;
+    int64_t parent = 0;                     // ID this one was generated from (0 = none)
+    std::vector<TopoDS_Shape> images;       // current sub-shapes; empty once deleted
+};
+
+struct OCCTNamingIndex {
+    uint32_t kindMask = 0;                  // 1 << TopAbs_ShapeEnum per tracked kind
+    TopoDS_Shape current;
+    std::vector<OCCTNamingEntry> entries;   // entries[id - 1]
+    NCollection_DataMap<TopoDS_Shape, int64_t, TopTools_ShapeMapHasher> owner;
+    TopTools_IndexedMapOfShape maps[TopAbs_SHAPE];   // index maps of `current`, tracked kinds only
+};
+
+static const uint32_t kNamingDefaultKinds = (1u << TopAbs_FACE) | (1u << TopAbs_EDGE) | (1u << TopAbs_VERTEX);
+
+static void namingRebuildMaps(OCCTNamingIndex& idx, const TopoDS_Shape& shape) {
+    idx.current = shape;
+    for (int k = 0; k < TopAbs_SHAPE; k++) {
+        idx.maps[k].Clear();
+        if (idx.kindMask & (1u << k)) TopExp::MapShapes(shape, (TopAbs_ShapeEnum)k, idx.maps[k]);
+    }
+}
+
+static int64_t namingAdd(OCCTNamingIndex& idx, const TopoDS_Shape& s, int64_t parent) {
+    OCCTNamingEntry e;
+    e.kind = s.ShapeType();
+    e.parent = parent;
+    e.images.push_back(s);
+    idx.entries.push_back(std::move(e));
+    const int64_t id = (int64_t)idx.entries.size();
+    idx.owner.Bind(s, id);
+    return id;
+}
+
+// Adapters over the two history flavours.
+struct NamingBuilderHistory {
+    BRepBuilderAPI_MakeShape& op;
+    const TopTools_ListOfShape& modified(const TopoDS_Shape& s) { return op.Modified(s); }
+    const TopTools_ListOfShape& generated(const TopoDS_Shape& s) { return op.Generated(s); }
+    bool deleted(const TopoDS_Shape& s) { return op.IsDeleted(s); }
+};
+
+struct NamingToolsHistory {
+    BRepTools_History& h;
+    const TopTools_ListOfShape& modified(const TopoDS_Shape& s) { return h.Modified(s); }
+    const TopTools_ListOfShape& generated(const TopoDS_Shape& s) { return h.Generated(s); }
+    bool deleted(const TopoDS_Shape& s) { return h.IsRemoved(s); }
+};
+
+template <typename History>
+static void namingApply(OCCTNamingIndex& idx, History history, const TopoDS_Shape& result) {
+    namingRebuildMaps(idx, result);
+    auto alive = [&](const TopoDS_Shape& s) {
+        const int k = s.ShapeType();
+        return (idx.kindMask & (1u << k)) && idx.maps[k].Contains(s);
+    };
+
+    NCollection_DataMap<TopoDS_Shape, int64_t, TopTools_ShapeMapHasher> owner;
+    std::vector<std::pair<int64_t, TopoDS_Shape>> generatedFrom;
+    const int64_t nbOld = (int64_t)idx.entries.size();
+    for (int64_t id = 1; id <= nbOld; id++) {
+        OCCTNamingEntry& e = idx.entries[id - 1];
+        if (e.images.empty()) continue;
+        std::vector<TopoDS_Shape> next;
+        for (const TopoDS_Shape& s : e.images) {
+            for (TopTools_ListOfShape::Iterator it(history.generated(s)); it.More(); it.Next()) {
+                if (alive(it.Value())) generatedFrom.push_back({id, it.Value()});
+            }
+            if (history.deleted(s)) continue;
+            const TopTools_ListOfShape& mods = history.modified(s);
+            if (mods.IsEmpty()) {
+                if (alive(s)) next.push_back(s);
+                continue;
+            }
+            for (TopTools_ListOfShape::Iterator it(mods); it.More(); it.Next()) {
+                if (it.Value().ShapeType() == e.kind && alive(it.Value())) next.push_back(it.Value());
+            }
+        }
+        // Drop duplicate images (several old images merged into one).
+        std::vector<TopoDS_Shape> unique;
+        for (const TopoDS_Shape& s : next) {
+            bool seen = false;
+            for (const TopoDS_Shape& u : unique) seen = seen || u.IsSame(s);
+            if (!seen) unique.push_back(s);
+        }
+        for (const TopoDS_Shape& s : unique) {
+            if (!owner.IsBound(s)) owner.Bind(s, id);   // merged: the oldest ID owns it
+        }
+        e.images.swap(unique);
+    }
+    idx.owner = owner;
+
+    for (const auto& g : generatedFrom) {
+        if (!idx.owner.IsBound(g.second)) namingAdd(idx, g.second, g.first);
+    }
+    for (int k = 0; k < TopAbs_SHAPE; k++) {
+        for (int i = 1; i <= idx.maps[k].Extent(); i++) {
+            if (!idx.owner.IsBound(idx.maps[k](i))) namingAdd(idx, idx.maps[k](i), 0);
+        }
+    }
+}
+
+OCCTNamingIndexRef OCCTNamingIndexCreate(OCCTShapeRef shape, uint32_t kindMask) {
+    if (!shape || shape->shape.IsNull()) return nullptr;
+    try {
+        auto* idx = new OCCTNamingIndex();
+        idx->kindMask = kindMask ? kindMask : kNamingDefaultKinds;
+        namingRebuildMaps(*idx, shape->shape);
+        for (int k = 0; k < TopAbs_SHAPE; k++) {
+            for (int i = 1; i <= idx->maps[k].Extent(); i++) namingAdd(*idx, idx->maps[k](i), 0);
+        }
+        return idx;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTNamingIndexRelease(OCCTNamingIndexRef index) {
+    delete index;
+}
+
+bool OCCTNamingIndexApplyBuilderHistory(OCCTNamingIndexRef index, OCCTBooleanHistoryRef history,
+                                        OCCTShapeRef result) {
+    if (!index || !history || !history->op || !result || result->shape.IsNull()) return false;
+    try {
+        namingApply(*index, NamingBuilderHistory{*history->op}, result->shape);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool OCCTNamingIndexApplyHistory(OCCTNamingIndexRef index, OCCTHistoryRef history, OCCTShapeRef result) {
+    if (!index || !history || !result || result->shape.IsNull()) return false;
+    try {
+        auto* h = static_cast<OCCTHistoryStorage*>(history);
+        if (h->history.IsNull()) return false;
+        namingApply(*index, NamingToolsHistory{*h->history}, result->shape);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+int64_t OCCTNamingIndexIDCount(OCCTNamingIndexRef index) {
+    return index ? (int64_t)index->entries.size() : 0;
+}
+
+OCCTShapeRef OCCTNamingIndexCurrentShape(OCCTNamingIndexRef index) {
+    if (!index || index->current.IsNull()) return nullptr;
+    try {
+        return new OCCTShape(index->current);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+int32_t OCCTNamingIndexKindOf(OCCTNamingIndexRef index, int64_t id) {
+    if (!index || id < 1 || id > (int64_t)index->entries.size()) return -1;
+    return (int32_t)index->entries[id - 1].kind;
+}
+
+int64_t OCCTNamingIndexParentOf(OCCTNamingIndexRef index, int64_t id) {
+    if (!index || id < 1 || id > (int64_t)index->entries.size()) return 0;
+    return index->entries[id - 1].parent;
+}
+
+int32_t OCCTNamingIndexResolve(OCCTNamingIndexRef index, int64_t id, int32_t* outIndices, int32_t maxCount) {
+    if (!index || id < 1 || id > (int64_t)index->entries.size()) return -1;
+    const OCCTNamingEntry& e = index->entries[id - 1];
+    const TopTools_IndexedMapOfShape& map = index->maps[e.kind];
+    int32_t n = 0;
+    for (const TopoDS_Shape& s : e.images) {
+        if (outIndices && n < maxCount) outIndices[n] = map.FindIndex(s) - 1;
+        n++;
+    }
+    return n;
+}
+
+int32_t OCCTNamingIndexResolveFirst(OCCTNamingIndexRef index, const int64_t* ids, int32_t count,
+                                    int32_t* outIndices) {
+    if (!index || !ids || !outIndices || count < 0) return -1;
+    int32_t resolved = 0;
+    for (int32_t i = 0; i < count; i++) {
+        outIndices[i] = -1;
+        const int64_t id = ids[i];
+        if (id < 1 || id > (int64_t)index->entries.size()) continue;
+        const OCCTNamingEntry& e = index->entries[id - 1];
+        if (e.images.empty()) continue;
+        outIndices[i] = index->maps[e.kind].FindIndex(e.images.front()) - 1;
+        resolved++;
+    }
+    return resolved;
+}
+
+int64_t OCCTNamingIndexIDOf(OCCTNamingIndexRef index, int32_t kind, int32_t subIndex) {
+    if (!index || kind < 0 || kind >= TopAbs_SHAPE) return 0;
+    const TopTools_IndexedMapOfShape& map = index->maps[kind];
+    if (subIndex < 0 || subIndex >= map.Extent()) return 0;
+    const int64_t* id = index->owner.Seek(map(subIndex + 1));
+    return id ? *id : 0;
+}
+
+int32_t OCCTNamingIndexIDsOfKind(OCCTNamingIndexRef index, int32_t kind, int64_t* outIDs) {
+    if (!index || kind < 0 || kind >= TopAbs_SHAPE) return -1;
+    const TopTools_IndexedMapOfShape& map = index->maps[kind];
+    if (outIDs) {
+        for (int i = 1; i <= map.Extent(); i++) {
+            const int64_t* id = index->owner.Seek(map(i));
+            outIDs[i - 1] = id ? *id : 0;
+        }
+    }
+    return map.Extent();
+}
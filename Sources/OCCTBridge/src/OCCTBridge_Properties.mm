@@ -56,6 +56,7 @@
 #include <GeomLProp_CLProps.hxx>
 #include <GeomLProp_SLProps.hxx>
 
+#include <gp.hxx>
 #include <gp_Ax1.hxx>
 #include <gp_Dir.hxx>
 #include <gp_Pnt.hxx>
@@ -196,24 +197,29 @@ bool OCCTFaceGetPrincipalCurvatures(OCCTFaceRef face, double u, double v,
     }
 }
 
+// OCCTFaceGetSurfaceType codes.
+static int32_t propSurfaceTypeCode(GeomAbs_SurfaceType type) {
+    switch (type) {
+        case GeomAbs_Plane:              return 0;
+        case GeomAbs_Cylinder:           return 1;
+        case GeomAbs_Cone:               return 2;
+        case GeomAbs_Sphere:             return 3;
+        case GeomAbs_Torus:              return 4;
+        case GeomAbs_BezierSurface:      return 5;
+        case GeomAbs_BSplineSurface:     return 6;
+        case GeomAbs_SurfaceOfRevolution:return 7;
+        case GeomAbs_SurfaceOfExtrusion: return 8;
+        case GeomAbs_OffsetSurface:      return 9;
+        default:                         return 10;
+    }
+}
+
 int32_t OCCTFaceGetSurfaceType(OCCTFaceRef face) {
     if (!face) return 10; // Other
 
     try {
         BRepAdaptor_Surface adaptor(face->face);
-        switch (adaptor.GetType()) {
-            case GeomAbs_Plane:              return 0;
-            case GeomAbs_Cylinder:           return 1;
-            case GeomAbs_Cone:               return 2;
-            case GeomAbs_Sphere:             return 3;
-            case GeomAbs_Torus:              return 4;
-            case GeomAbs_BezierSurface:      return 5;
-            case GeomAbs_BSplineSurface:     return 6;
-            case GeomAbs_SurfaceOfRevolution:return 7;
-            case GeomAbs_SurfaceOfExtrusion: return 8;
-            case GeomAbs_OffsetSurface:      return 9;
-            default:                         return 10;
-        }
+        return propSurfaceTypeCode(adaptor.GetType());
     } catch (...) {
         return 10;
     }
@@ -234,6 +240,59 @@ double OCCTFaceGetArea(OCCTFaceRef face, double tolerance) {
 #include <Geom_SurfaceOfRevolution.hxx>
 #include <Geom_SurfaceOfLinearExtrusion.hxx>
 
+// Primary axis of `face` (OCCTFaceGetPrimaryAxis kind codes); false for non-axial surfaces.
+static bool propPrimaryAxis(const TopoDS_Face& face, const BRepAdaptor_Surface& adaptor,
+                            gp_Ax1& axis, int32_t& kind) {
+    switch (adaptor.GetType()) {
+        case GeomAbs_Cylinder: {
+            axis = adaptor.Cylinder().Axis();
+            kind = 1;
+            return true;
+        }
+        case GeomAbs_Cone: {
+            axis = adaptor.Cone().Axis();
+            kind = 2;
+            return true;
+        }
+        case GeomAbs_Sphere: {
+            gp_Sphere s = adaptor.Sphere();
+            axis = gp_Ax1(s.Location(), s.Position().Direction());
+            kind = 3;
+            return true;
+        }
+        case GeomAbs_Torus: {
+            axis = adaptor.Torus().Axis();
+            kind = 4;
+            return true;
+        }
+        case GeomAbs_SurfaceOfRevolution: {
+            Handle(Geom_Surface) surf = BRep_Tool::Surface(face);
+            Handle(Geom_SurfaceOfRevolution) rev = Handle(Geom_SurfaceOfRevolution)::DownCast(surf);
+            if (rev.IsNull()) return false;
+            axis = rev->Axis();
+            kind = 5;
+            return true;
+        }
+        case GeomAbs_SurfaceOfExtrusion: {
+            Handle(Geom_Surface) surf = BRep_Tool::Surface(face);
+            Handle(Geom_SurfaceOfLinearExtrusion) ext = Handle(Geom_SurfaceOfLinearExtrusion)::DownCast(surf);
+            if (ext.IsNull()) return false;
+            gp_Dir dir = ext->Direction();
+            // Extrusion has no canonical origin — use basis curve start.
+            Handle(Geom_Curve) basis = ext->BasisCurve();
+            gp_Pnt origin(0, 0, 0);
+            if (!basis.IsNull()) {
+                origin = basis->Value(basis->FirstParameter());
+            }
+            axis = gp_Ax1(origin, dir);
+            kind = 6;
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
 bool OCCTFaceGetPrimaryAxis(OCCTFaceRef face,
                              double* ox, double* oy, double* oz,
                              double* dx, double* dy, double* dz,
@@ -243,55 +302,8 @@ bool OCCTFaceGetPrimaryAxis(OCCTFaceRef face,
     try {
         BRepAdaptor_Surface adaptor(face->face);
         gp_Ax1 axis;
-        int kind = 0;
-        switch (adaptor.GetType()) {
-            case GeomAbs_Cylinder: {
-                axis = adaptor.Cylinder().Axis();
-                kind = 1;
-                break;
-            }
-            case GeomAbs_Cone: {
-                axis = adaptor.Cone().Axis();
-                kind = 2;
-                break;
-            }
-            case GeomAbs_Sphere: {
-                gp_Sphere s = adaptor.Sphere();
-                axis = gp_Ax1(s.Location(), s.Position().Direction());
-                kind = 3;
-                break;
-            }
-            case GeomAbs_Torus: {
-                axis = adaptor.Torus().Axis();
-                kind = 4;
-                break;
-            }
-            case GeomAbs_SurfaceOfRevolution: {
-                Handle(Geom_Surface) surf = BRep_Tool::Surface(face->face);
-                Handle(Geom_SurfaceOfRevolution) rev = Handle(Geom_SurfaceOfRevolution)::DownCast(surf);
-                if (rev.IsNull()) return false;
-                axis = rev->Axis();
-                kind = 5;
-                break;
-            }
-            case GeomAbs_SurfaceOfExtrusion: {
-                Handle(Geom_Surface) surf = BRep_Tool::Surface(face->face);
-                Handle(Geom_SurfaceOfLinearExtrusion) ext = Handle(Geom_SurfaceOfLinearExtrusion)::DownCast(surf);
-                if (ext.IsNull()) return false;
-                gp_Dir dir = ext->Direction();
-                // Extrusion has no canonical origin — use basis curve start.
-                Handle(Geom_Curve) basis = ext->BasisCurve();
-                gp_Pnt origin(0, 0, 0);
-                if (!basis.IsNull()) {
-                    origin = basis->Value(basis->FirstParameter());
-                }
-                axis = gp_Ax1(origin, dir);
-                kind = 6;
-                break;
-            }
-            default:
-                return false;
-        }
+        int32_t kind = 0;
+        if (!propPrimaryAxis(face->face, adaptor, axis, kind)) return false;
         const gp_Pnt& p = axis.Location();
         const gp_Dir& d = axis.Direction();
         *ox = p.X(); *oy = p.Y(); *oz = p.Z();
@@ -303,7 +315,6 @@ bool OCCTFaceGetPrimaryAxis(OCCTFaceRef face,
     }
 }
 
-
 // MARK: - Edge 3D Curve Properties (v0.18.0)
 
 #include <GeomLProp_CLProps.hxx>
@@ -466,22 +477,27 @@ bool OCCTEdgeGetPointAtParam(OCCTEdgeRef edge, double param,
     }
 }
 
+// OCCTEdgeGetCurveType codes.
+static int32_t propCurveTypeCode(GeomAbs_CurveType type) {
+    switch (type) {
+        case GeomAbs_Line:       return 0;
+        case GeomAbs_Circle:     return 1;
+        case GeomAbs_Ellipse:    return 2;
+        case GeomAbs_Hyperbola:  return 3;
+        case GeomAbs_Parabola:   return 4;
+        case GeomAbs_BezierCurve:return 5;
+        case GeomAbs_BSplineCurve:return 6;
+        case GeomAbs_OffsetCurve:return 7;
+        default:                 return 8;
+    }
+}
+
 int32_t OCCTEdgeGetCurveType(OCCTEdgeRef edge) {
     if (!edge) return 8; // Other
 
     try {
         BRepAdaptor_Curve adaptor(edge->edge);
-        switch (adaptor.GetType()) {
-            case GeomAbs_Line:       return 0;
-            case GeomAbs_Circle:     return 1;
-            case GeomAbs_Ellipse:    return 2;
-            case GeomAbs_Hyperbola:  return 3;
-            case GeomAbs_Parabola:   return 4;
-            case GeomAbs_BezierCurve:return 5;
-            case GeomAbs_BSplineCurve:return 6;
-            case GeomAbs_OffsetCurve:return 7;
-            default:                 return 8;
-        }
+        return propCurveTypeCode(adaptor.GetType());
     } catch (...) {
         return 8;
     }
@@ -1866,8 +1882,7 @@ int32_t OCCTShapeGetVertexCount(OCCTShapeRef shape) {
 
     try {
         // Use IndexedMapOfShape for unique vertices
-        TopTools_IndexedMapOfShape vertexMap;
-        TopExp::MapShapes(shape->shape, TopAbs_VERTEX, vertexMap);
+        const TopTools_IndexedMapOfShape& vertexMap = shape->subShapes(TopAbs_VERTEX);
         return vertexMap.Extent();
     } catch (...) {
         return 0;
@@ -1879,8 +1894,7 @@ bool OCCTShapeGetVertexAt(OCCTShapeRef shape, int32_t index, double* outX, doubl
 
     try {
         // Use IndexedMapOfShape for unique vertices
-        TopTools_IndexedMapOfShape vertexMap;
-        TopExp::MapShapes(shape->shape, TopAbs_VERTEX, vertexMap);
+        const TopTools_IndexedMapOfShape& vertexMap = shape->subShapes(TopAbs_VERTEX);
 
         // IndexedMapOfShape uses 1-based indexing
         if (index >= vertexMap.Extent()) return false;
@@ -1901,8 +1915,7 @@ int32_t OCCTShapeGetVertices(OCCTShapeRef shape, double* outVertices) {
 
     try {
         // Use IndexedMapOfShape for unique vertices
-        TopTools_IndexedMapOfShape vertexMap;
-        TopExp::MapShapes(shape->shape, TopAbs_VERTEX, vertexMap);
+        const TopTools_IndexedMapOfShape& vertexMap = shape->subShapes(TopAbs_VERTEX);
 
         int32_t count = vertexMap.Extent();
         for (int32_t i = 0; i < count; i++) {
@@ -1934,3 +1947,171 @@ void OCCTShapeGetBounds(OCCTShapeRef shape, double* minX, double* minY, double*
     }
 }
 
+
+// MARK: - Parallel per-face / per-edge queries
+
+// Run the selected query kernels over every face (edge) of a shape. Faces of
+// one shape may share a Geom_Surface, so every kernel works on adaptors built
+// inside the worker for that face — never on a shared BRepAdaptor — which keeps
+// the BSpline evaluation caches private to one thread (docs/thread-safety.md).
+
+static void propQueryFace(const TopoDS_Face& face, uint32_t queries, double areaTolerance,
+                          OCCTFaceQueryResult& r) {
+    r = OCCTFaceQueryResult();
+    r.surfaceType = 10;
+    BRepAdaptor_Surface adaptor(face);
+    if (queries & OCCTFaceQuerySurfaceType) {
+        r.surfaceType = propSurfaceTypeCode(adaptor.GetType());
+        r.valid |= OCCTFaceQuerySurfaceType;
+    }
+
+    const bool needUV = queries & (OCCTFaceQueryUVBounds | OCCTFaceQueryNormal | OCCTFaceQueryCurvature);
+    double u0 = 0, u1 = 0, v0 = 0, v1 = 0;
+    if (needUV) {
+        BRepTools::UVBounds(face, u0, u1, v0, v1);
+        r.uMin = u0; r.uMax = u1; r.vMin = v0; r.vMax = v1;
+        if (queries & OCCTFaceQueryUVBounds) r.valid |= OCCTFaceQueryUVBounds;
+    }
+
+    if (queries & OCCTFaceQueryArea) {
+        GProp_GProps props;
+        BRepGProp::SurfaceProperties(face, props, areaTolerance);
+        r.area = props.Mass();
+        r.valid |= OCCTFaceQueryArea;
+    }
+
+    if (queries & OCCTFaceQueryNormal) {
+        BRepLProp_SLProps props(adaptor, 0.5 * (u0 + u1), 0.5 * (v0 + v1), 1, Precision::Confusion());
+        const gp_Pnt& p = props.Value();
+        r.px = p.X(); r.py = p.Y(); r.pz = p.Z();
+        if (props.IsNormalDefined()) {
+            gp_Dir n = props.Normal();
+            if (face.Orientation() == TopAbs_REVERSED) n.Reverse();
+            r.nx = n.X(); r.ny = n.Y(); r.nz = n.Z();
+            r.valid |= OCCTFaceQueryNormal;
+        }
+    }
+
+    if (queries & OCCTFaceQueryCurvature) {
+        // 5×5 samples over the UV box (the centre included).
+        BRepLProp_SLProps props(adaptor, 2, Precision::Confusion());
+        double kMin = 0, kMax = 0;
+        bool any = false;
+        for (int i = 0; i < 5; i++) {
+            for (int j = 0; j < 5; j++) {
+                props.SetParameters(u0 + (u1 - u0) * i / 4.0, v0 + (v1 - v0) * j / 4.0);
+                if (!props.IsCurvatureDefined()) continue;
+                const double k1 = props.MinCurvature(), k2 = props.MaxCurvature();
+                kMin = any ? std::min(kMin, k1) : k1;
+                kMax = any ? std::max(kMax, k2) : k2;
+                any = true;
+            }
+        }
+        if (any) {
+            r.minCurvature = kMin;
+            r.maxCurvature = kMax;
+            r.valid |= OCCTFaceQueryCurvature;
+        }
+    }
+
+    if (queries & OCCTFaceQueryAxis) {
+        gp_Ax1 axis;
+        int32_t kind = 0;
+        if (propPrimaryAxis(face, adaptor, axis, kind)) {
+            r.axisKind = kind;
+            r.ox = axis.Location().X(); r.oy = axis.Location().Y(); r.oz = axis.Location().Z();
+            r.dx = axis.Direction().X(); r.dy = axis.Direction().Y(); r.dz = axis.Direction().Z();
+            r.valid |= OCCTFaceQueryAxis;
+        }
+    }
+
+    if (queries & OCCTFaceQueryTolerance) {
+        r.tolerance = BRep_Tool::Tolerance(face);
+        r.valid |= OCCTFaceQueryTolerance;
+    }
+}
+
+int32_t OCCTShapeQueryFaces(OCCTShapeRef shape, uint32_t queries, double areaTolerance,
+                            OCCTFaceQueryResult* outResults, bool parallel) {
+    if (!shape) return -1;
+    try {
+        const TopTools_IndexedMapOfShape& faces = shape->subShapes(TopAbs_FACE);
+        const int32_t count = faces.Extent();
+        if (!outResults) return count;
+        occtParallelChunks(count, [&](int32_t begin, int32_t end) {
+            for (int32_t i = begin; i < end; i++) {
+                try {
+                    propQueryFace(TopoDS::Face(faces(i + 1)), queries, areaTolerance, outResults[i]);
+                } catch (...) {
+                    outResults[i].valid = 0;
+                }
+            }
+        }, parallel);
+        return count;
+    } catch (...) {
+        return -1;
+    }
+}
+
+static void propQueryEdge(const TopoDS_Edge& edge, uint32_t queries, OCCTEdgeQueryResult& r) {
+    r = OCCTEdgeQueryResult();
+    r.curveType = 8;
+    r.isDegenerated = BRep_Tool::Degenerated(edge);
+    if (queries & OCCTEdgeQueryTolerance) {
+        r.tolerance = BRep_Tool::Tolerance(edge);
+        r.valid |= OCCTEdgeQueryTolerance;
+    }
+    if (r.isDegenerated || !BRep_Tool::IsGeometric(edge)) return;
+
+    BRepAdaptor_Curve adaptor(edge);
+    const double first = adaptor.FirstParameter(), last = adaptor.LastParameter();
+    if (queries & OCCTEdgeQueryCurveType) {
+        r.curveType = propCurveTypeCode(adaptor.GetType());
+        r.valid |= OCCTEdgeQueryCurveType;
+    }
+    if (queries & OCCTEdgeQueryRange) {
+        r.first = first;
+        r.last = last;
+        r.valid |= OCCTEdgeQueryRange;
+    }
+    if (queries & OCCTEdgeQueryLength) {
+        r.length = GCPnts_AbscissaPoint::Length(adaptor);
+        r.valid |= OCCTEdgeQueryLength;
+    }
+    if (queries & OCCTEdgeQueryPoints) {
+        const gp_Pnt s = adaptor.Value(first), e = adaptor.Value(last);
+        gp_Pnt m;
+        gp_Vec t;
+        adaptor.D1(0.5 * (first + last), m, t);
+        r.sx = s.X(); r.sy = s.Y(); r.sz = s.Z();
+        r.ex = e.X(); r.ey = e.Y(); r.ez = e.Z();
+        r.mx = m.X(); r.my = m.Y(); r.mz = m.Z();
+        if (t.Magnitude() > gp::Resolution()) {
+            t.Normalize();
+            r.tx = t.X(); r.ty = t.Y(); r.tz = t.Z();
+        }
+        r.valid |= OCCTEdgeQueryPoints;
+    }
+}
+
+int32_t OCCTShapeQueryEdges(OCCTShapeRef shape, uint32_t queries,
+                            OCCTEdgeQueryResult* outResults, bool parallel) {
+    if (!shape) return -1;
+    try {
+        const TopTools_IndexedMapOfShape& edges = shape->subShapes(TopAbs_EDGE);
+        const int32_t count = edges.Extent();
+        if (!outResults) return count;
+        occtParallelChunks(count, [&](int32_t begin, int32_t end) {
+            for (int32_t i = begin; i < end; i++) {
+                try {
+                    propQueryEdge(TopoDS::Edge(edges(i + 1)), queries, outResults[i]);
+                } catch (...) {
+                    outResults[i].valid = 0;
+                }
+            }
+        }, parallel);
+        return count;
+    } catch (...) {
+        return -1;
+    }
+}
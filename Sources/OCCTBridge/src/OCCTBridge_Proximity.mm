@@ -0,0 +1,1926 @@
+//
+//  OCCTBridge_Proximity.mm
+//  OCCTSwift
+//
+//  Per-area TU for batched proximity queries over many shapes / points:
+//
+//  - Assembly interference & clearance engine (AABB tree broad phase,
+//    BRepExtrema_ShapeProximity mid phase on cached triangulations,
+//    optional BRepExtrema_DistShapeShape refinement)
+//  - Cached solid classifier (pooled BRepClass3d_SolidExplorer + ray-parity
+//    fast path over a closed triangulation)
+//  - Voxelization / narrow-band signed distance field
+//  - Batched point projection (triangle BVH candidate faces, per-face
+//    Extrema_GenExtPS initialised once per worker and reused)
+//  - Reusable two-shape distance engine (cached meshes / face boxes, dual
+//    BVH lower bound, exact extrema on the surviving face pairs only)
+//  - Preview mesh booleans (cached meshes, box cull, BVH crossing test and
+//    ray-parity classification per triangle, crossing triangles refined)
+//
+//  Per-pair / per-point work runs through occtParallelChunks; each task
+//  builds its own extrema / classifier objects so no adaptor cache is
+//  shared between threads (docs/thread-safety.md).
+//
+
+#import "../include/OCCTBridge.h"
+#import "OCCTBridge_Internal.h"
+
+// === Area-specific OCCT headers ===
+
+#include <Bnd_Box.hxx>
+#include <Bnd_OBB.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepAdaptor_Curve.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepClass3d_SClassifier.hxx>
+#include <BRepClass3d_SolidClassifier.hxx>
+#include <BRepClass3d_SolidExplorer.hxx>
+#include <BRepExtrema_DistShapeShape.hxx>
+#include <BRepExtrema_Poly.hxx>
+#include <BRepExtrema_ShapeProximity.hxx>
+#include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTools.hxx>
+#include <BRepTopAdaptor_FClass2d.hxx>
+#include <Extrema_ExtPC.hxx>
+#include <Extrema_GenExtPS.hxx>
+#include <Geom2d_Curve.hxx>
+#include <Precision.hxx>
+#include <TColStd_PackedMapOfInteger.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <gp_Vec.hxx>
+#include <gp_XYZ.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// MARK: - Assembly Interference & Clearance Engine
+
+struct OCCTInterferenceEngine {
+    std::vector<TopoDS_Shape> shapes;     // null where the caller passed NULL
+    std::vector<Bnd_Box> boxes;
+    std::vector<Bnd_OBB> obbs;
+    std::vector<uint8_t> isSolid;
+    double deflection = 0;
+
+    std::vector<OCCTInterferencePair> pairs;
+    OCCTInterferenceStats stats = {};
+};
+
+OCCTInterferenceEngineRef OCCTInterferenceEngineCreate(const OCCTShapeRef* shapes, int32_t count,
+                                                       double deflection) {
+    if (!shapes || count < 0 || !(deflection > 0)) return nullptr;
+    occtEnsureSignals();
+    try {
+        auto* e = new OCCTInterferenceEngine();
+        e->deflection = deflection;
+        e->shapes.resize(count);
+        e->boxes.resize(count);
+        e->obbs.resize(count);
+        e->isSolid.assign(count, 0);
+
+        // One mesher over the whole set: shared instances (same TShape) are meshed once,
+        // and BRepMesh parallelises over faces internally.
+        BRep_Builder builder;
+        TopoDS_Compound all;
+        builder.MakeCompound(all);
+        for (int32_t i = 0; i < count; i++) {
+            if (!shapes[i] || shapes[i]->shape.IsNull()) continue;
+            e->shapes[i] = shapes[i]->shape;
+            builder.Add(all, shapes[i]->shape);
+        }
+        BRepMesh_IncrementalMesh mesher(all, deflection, Standard_False, 0.5, Standard_True);
+
+        occtParallelChunks(count, [&](int32_t begin, int32_t end) {
+            for (int32_t i = begin; i < end; i++) {
+                const TopoDS_Shape& s = e->shapes[i];
+                if (s.IsNull()) continue;
+                try {
+                    BRepBndLib::Add(s, e->boxes[i], Standard_True);
+                    BRepBndLib::AddOBB(s, e->obbs[i], Standard_True, Standard_False, Standard_True);
+                    e->isSolid[i] = TopExp_Explorer(s, TopAbs_SOLID).More() ? 1 : 0;
+                } catch (...) {
+                    e->boxes[i].SetVoid();
+                }
+            }
+        });
+        return e;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTInterferenceEngineRelease(OCCTInterferenceEngineRef engine) {
+    delete engine;
+}
+
+// Compound of the faces listed in one side of a BRepExtrema_ShapeProximity result.
+static TopoDS_Compound ifFaceCompound(const BRepExtrema_ShapeProximity& prox, bool first,
+                                      const TColStd_PackedMapOfInteger& ids) {
+    BRep_Builder builder;
+    TopoDS_Compound comp;
+    builder.MakeCompound(comp);
+    for (TColStd_PackedMapOfInteger::Iterator it(ids); it.More(); it.Next()) {
+        builder.Add(comp, first ? prox.GetSubShape1(it.Key()) : prox.GetSubShape2(it.Key()));
+    }
+    return comp;
+}
+
+// True if `inner`'s first vertex classifies IN the solid `outer`.
+static bool ifContainedIn(const TopoDS_Shape& inner, const TopoDS_Shape& outer, gp_Pnt& outPnt) {
+    TopExp_Explorer vx(inner, TopAbs_VERTEX);
+    if (!vx.More()) return false;
+    outPnt = BRep_Tool::Pnt(TopoDS::Vertex(vx.Current()));
+    BRepClass3d_SolidClassifier classifier(outer, outPnt, Precision::Confusion());
+    return classifier.State() == TopAbs_IN;
+}
+
+static void ifSetWitness(OCCTInterferencePair& r, const gp_Pnt& p1, const gp_Pnt& p2) {
+    r.p1[0] = p1.X(); r.p1[1] = p1.Y(); r.p1[2] = p1.Z();
+    r.p2[0] = p2.X(); r.p2[1] = p2.Y(); r.p2[2] = p2.Z();
+}
+
+// Mid phase + refinement for one candidate pair. Returns true if the pair is reported.
+static bool ifEvaluatePair(const OCCTInterferenceEngine& e, int32_t a, int32_t b,
+                           double clearance, bool exact, OCCTInterferencePair& r) {
+    r = OCCTInterferencePair();
+    r.shape1 = a;
+    r.shape2 = b;
+    const TopoDS_Shape& sa = e.shapes[a];
+    const TopoDS_Shape& sb = e.shapes[b];
+
+    // Inflate by the mesh deflection so a true distance just under `clearance` isn't
+    // lost to chordal error.
+    const double tol = clearance > 0 ? clearance + e.deflection : 0.0;
+    BRepExtrema_ShapeProximity prox(sa, sb, tol);
+    prox.Perform();
+    if (!prox.IsDone()) return false;
+
+    // Collect both sides of the overlap map.
+    TColStd_PackedMapOfInteger ids1, ids2;
+    int32_t facePairs = 0;
+    for (NCollection_DataMap<int, TColStd_PackedMapOfInteger>::Iterator it(prox.OverlapSubShapes1());
+         it.More(); it.Next()) {
+        ids1.Add(it.Key());
+        facePairs += it.Value().Extent();
+    }
+    for (NCollection_DataMap<int, TColStd_PackedMapOfInteger>::Iterator it(prox.OverlapSubShapes2());
+         it.More(); it.Next()) {
+        ids2.Add(it.Key());
+    }
+
+    if (facePairs == 0) {
+        // No boundary contact: the only remaining interference is full containment,
+        // which requires one box to lie inside the other.
+        gp_Pnt p;
+        const bool aInB = e.isSolid[b] &&
+                          e.boxes[b].IsOut(e.boxes[a].CornerMin()) == Standard_False &&
+                          e.boxes[b].IsOut(e.boxes[a].CornerMax()) == Standard_False &&
+                          ifContainedIn(sa, sb, p);
+        const bool bInA = !aInB && e.isSolid[a] &&
+                          e.boxes[a].IsOut(e.boxes[b].CornerMin()) == Standard_False &&
+                          e.boxes[a].IsOut(e.boxes[b].CornerMax()) == Standard_False &&
+                          ifContainedIn(sb, sa, p);
+        if (!aInB && !bInA) return false;
+        r.kind = OCCTInterferenceContained;
+        r.distance = 0;
+        r.exact = true;
+        ifSetWitness(r, p, p);
+        return true;
+    }
+
+    r.facePairCount = facePairs;
+    const TopoDS_Compound c1 = ifFaceCompound(prox, true, ids1);
+    const TopoDS_Compound c2 = ifFaceCompound(prox, false, ids2);
+
+    if (exact) {
+        BRepExtrema_DistShapeShape dist(c1, c2);
+        if (!dist.IsDone() || dist.NbSolution() < 1) return false;
+        r.exact = true;
+        r.distance = dist.Value();
+        ifSetWitness(r, dist.PointOnShape1(1), dist.PointOnShape2(1));
+        if (r.distance <= Precision::Confusion()) {
+            r.kind = OCCTInterferenceIntersecting;
+            r.distance = 0;
+            return true;
+        }
+        r.kind = OCCTInterferenceClearance;
+        return r.distance < clearance;
+    }
+
+    // Mesh estimate. At tolerance 0 the overlap already means crossing triangles;
+    // otherwise re-test just the overlapping faces at 0 to separate touching from near.
+    bool crossing = tol == 0.0;
+    if (!crossing) {
+        BRepExtrema_ShapeProximity prox0(c1, c2, 0.0);
+        prox0.Perform();
+        crossing = prox0.IsDone() && !prox0.OverlapSubShapes1().IsEmpty();
+    }
+    gp_Pnt p1, p2;
+    double d = 0;
+    const bool measured = BRepExtrema_Poly::Distance(c1, c2, p1, p2, d);
+    if (measured) ifSetWitness(r, p1, p2);
+    r.exact = false;
+    if (crossing) {
+        r.kind = OCCTInterferenceIntersecting;
+        r.distance = 0.0;
+        return true;
+    }
+    // The proximity pass ran at clearance + deflection; keep only pairs whose
+    // estimated distance is inside the clearance itself, as the exact path does.
+    r.kind = OCCTInterferenceClearance;
+    r.distance = d;
+    return measured && d < clearance;
+}
+
+int32_t OCCTInterferenceEngineRun(OCCTInterferenceEngineRef engine, double clearance,
+                                  bool exact, bool useOBB, bool parallel) {
+    if (!engine || !(clearance >= 0)) return -1;
+    try {
+        auto& e = *engine;
+        e.pairs.clear();
+        e.stats = OCCTInterferenceStats();
+
+        // Broad phase: AABBs grown by half the clearance on each side, so two boxes overlap
+        // iff their gap is below `clearance`.
+        std::vector<int32_t> proxyShape;
+        std::vector<double> flat;
+        const double half = 0.5 * clearance;
+        for (int32_t i = 0; i < (int32_t)e.shapes.size(); i++) {
+            if (e.shapes[i].IsNull() || e.boxes[i].IsVoid()) continue;
+            double b[6];
+            e.boxes[i].Get(b[0], b[1], b[2], b[3], b[4], b[5]);
+            for (int k = 0; k < 3; k++) { b[k] -= half; b[k + 3] += half; }
+            flat.insert(flat.end(), b, b + 6);
+            proxyShape.push_back(i);
+        }
+        const int32_t nbProxies = (int32_t)proxyShape.size();
+        if (nbProxies < 2) return 0;
+
+        OCCTAABBTreeRef tree = OCCTAABBTreeCreateFromBoxes(flat.data(), nbProxies, 0.0);
+        if (!tree) return -1;
+        const int32_t nbCandidates = OCCTAABBTreeComputePairs(tree, parallel);
+        std::vector<int32_t> offsets(nbProxies + 1);
+        std::vector<int32_t> partners(std::max(nbCandidates, 0));
+        const bool gotPairs = nbCandidates >= 0 &&
+                              OCCTAABBTreeGetPairs(tree, offsets.data(), partners.data());
+        OCCTAABBTreeRelease(tree);
+        if (!gotPairs) return -1;
+        e.stats.broadPhasePairs = nbCandidates;
+
+        std::vector<std::pair<int32_t, int32_t>> candidates;
+        candidates.reserve(nbCandidates);
+        for (int32_t p = 0; p < nbProxies; p++) {
+            for (int32_t k = offsets[p]; k < offsets[p + 1]; k++) {
+                const int32_t a = proxyShape[p];
+                const int32_t b = proxyShape[partners[k]];
+                candidates.emplace_back(std::min(a, b), std::max(a, b));
+            }
+        }
+
+        if (useOBB) {
+            std::vector<uint8_t> keep(candidates.size(), 1);
+            occtParallelChunks((int32_t)candidates.size(), [&](int32_t begin, int32_t end) {
+                for (int32_t i = begin; i < end; i++) {
+                    Bnd_OBB oa = e.obbs[candidates[i].first];
+                    if (oa.IsVoid()) continue;
+                    oa.Enlarge(clearance);
+                    keep[i] = oa.IsOut(e.obbs[candidates[i].second]) ? 0 : 1;
+                }
+            }, parallel);
+            size_t w = 0;
+            for (size_t i = 0; i < candidates.size(); i++) if (keep[i]) candidates[w++] = candidates[i];
+            e.stats.obbRejected = (int32_t)(candidates.size() - w);
+            candidates.resize(w);
+        }
+
+        // Mid phase + refinement, one task per candidate pair.
+        const int32_t nbTasks = (int32_t)candidates.size();
+        std::vector<OCCTInterferencePair> results(nbTasks);
+        std::vector<uint8_t> reported(nbTasks, 0);
+        std::vector<uint8_t> midHit(nbTasks, 0);
+        occtParallelChunks(nbTasks, [&](int32_t begin, int32_t end) {
+            for (int32_t i = begin; i < end; i++) {
+                try {
+                    reported[i] = ifEvaluatePair(e, candidates[i].first, candidates[i].second,
+                                                 clearance, exact, results[i]) ? 1 : 0;
+                    midHit[i] = results[i].facePairCount > 0 ? 1 : 0;
+                } catch (...) {
+                    reported[i] = 0;
+                }
+            }
+        }, parallel);
+
+        for (int32_t i = 0; i < nbTasks; i++) {
+            e.stats.midPhasePairs += midHit[i];
+            if (reported[i]) e.pairs.push_back(results[i]);
+        }
+        std::sort(e.pairs.begin(), e.pairs.end(),
+                  [](const OCCTInterferencePair& x, const OCCTInterferencePair& y) {
+                      return x.shape1 != y.shape1 ? x.shape1 < y.shape1 : x.shape2 < y.shape2;
+                  });
+        e.stats.reportedPairs = (int32_t)e.pairs.size();
+        return e.stats.reportedPairs;
+    } catch (...) {
+        return -1;
+    }
+}
+
+int32_t OCCTInterferenceEngineGetPairs(OCCTInterferenceEngineRef engine,
+                                       OCCTInterferencePair* outPairs, int32_t maxPairs) {
+    if (!engine || !outPairs || maxPairs <= 0) return 0;
+    const int32_t n = std::min((int32_t)engine->pairs.size(), maxPairs);
+    std::copy(engine->pairs.begin(), engine->pairs.begin() + n, outPairs);
+    return n;
+}
+
+OCCTInterferenceStats OCCTInterferenceEngineGetStats(OCCTInterferenceEngineRef engine) {
+    if (!engine) return OCCTInterferenceStats();
+    return engine->stats;
+}
+
+// MARK: - Cached Solid Classifier
+
+struct OCCTSolidClassifier {
+    TopoDS_Shape shape;
+    double tolerance = 0;
+    Bnd_Box box;                          // enlarged by tolerance; outside → OUT
+
+    // Explorers are stateful (shell/face iteration), so each worker borrows its own.
+    std::mutex poolMutex;
+    std::vector<std::unique_ptr<BRepClass3d_SolidExplorer>> pool;
+
+    // Ray-parity index: rays go along +Z, triangles are binned on an XY grid.
+    bool hasMesh = false;
+    double band = 0;                      // tolerance + deflection, measured along the normal
+    std::vector<double> tris;             // 9 doubles per triangle (a, b, c)
+    std::vector<double> invNz;            // 1 / |normal.z| per triangle (0 = vertical)
+    double gridX0 = 0, gridY0 = 0, cellW = 1, cellH = 1;
+    int32_t gridNx = 0, gridNy = 0;
+    std::vector<int32_t> cellStart;       // CSR over cells
+    std::vector<int32_t> cellTris;
+};
+
+static std::unique_ptr<BRepClass3d_SolidExplorer> scAcquire(OCCTSolidClassifier& c) {
+    {
+        std::lock_guard<std::mutex> lock(c.poolMutex);
+        if (!c.pool.empty()) {
+            auto ex = std::move(c.pool.back());
+            c.pool.pop_back();
+            return ex;
+        }
+    }
+    return std::unique_ptr<BRepClass3d_SolidExplorer>(new BRepClass3d_SolidExplorer(c.shape));
+}
+
+static void scRelease(OCCTSolidClassifier& c, std::unique_ptr<BRepClass3d_SolidExplorer> ex) {
+    std::lock_guard<std::mutex> lock(c.poolMutex);
+    c.pool.push_back(std::move(ex));
+}
+
+static int32_t scExact(const OCCTSolidClassifier& c, BRepClass3d_SolidExplorer& explorer,
+                       const gp_Pnt& p) {
+    if (c.box.IsOut(p)) return (int32_t)TopAbs_OUT;
+    BRepClass3d_SClassifier classifier;
+    classifier.Perform(explorer, p, c.tolerance);
+    return (int32_t)classifier.State();
+}
+
+// True if every edge bounds exactly two face uses (seams count twice), i.e. the faces
+// close up and BRepMesh will produce a watertight mesh.
+static bool pxIsClosed(const TopoDS_Shape& shape) {
+    TopTools_IndexedDataMapOfShapeListOfShape edgeFaces;
+    TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, edgeFaces);
+    for (int i = 1; i <= edgeFaces.Extent(); i++) {
+        const TopoDS_Edge& edge = TopoDS::Edge(edgeFaces.FindKey(i));
+        if (BRep_Tool::Degenerated(edge)) continue;
+        const TopTools_ListOfShape& faces = edgeFaces(i);
+        const int n = faces.Extent();
+        if (n == 2) continue;
+        if (n == 1 && BRep_Tool::IsClosed(edge, TopoDS::Face(faces.First()))) continue;
+        return false;
+    }
+    return true;
+}
+
+// Appends the triangles of one face (9 doubles each: a, b, c in world coordinates)
+// to `tris`. Returns false if the face has no triangulation.
+static bool pxAppendFaceTriangles(const TopoDS_Face& face, std::vector<double>& tris) {
+    TopLoc_Location loc;
+    Handle(Poly_Triangulation) tri = BRep_Tool::Triangulation(face, loc);
+    if (tri.IsNull()) return false;
+    const gp_Trsf trsf = loc.Transformation();
+    for (int t = 1; t <= tri->NbTriangles(); t++) {
+        int n1, n2, n3;
+        tri->Triangle(t).Get(n1, n2, n3);
+        const gp_Pnt pts[3] = { tri->Node(n1).Transformed(trsf),
+                                tri->Node(n2).Transformed(trsf),
+                                tri->Node(n3).Transformed(trsf) };
+        for (const gp_Pnt& q : pts) {
+            tris.push_back(q.X()); tris.push_back(q.Y()); tris.push_back(q.Z());
+        }
+    }
+    return true;
+}
+
+// Appends every face triangle of `shape` to `tris`.
+// Returns false if a face has no triangulation.
+static bool pxCollectTriangles(const TopoDS_Shape& shape, std::vector<double>& tris) {
+    for (TopExp_Explorer fx(shape, TopAbs_FACE); fx.More(); fx.Next()) {
+        if (!pxAppendFaceTriangles(TopoDS::Face(fx.Current()), tris)) return false;
+    }
+    return true;
+}
+
+static void scBuildGrid(OCCTSolidClassifier& c) {
+    const int32_t nbTris = (int32_t)(c.tris.size() / 9);
+    c.invNz.assign(nbTris, 0.0);
+    double xmin = 1e300, ymin = 1e300, xmax = -1e300, ymax = -1e300;
+    for (int32_t t = 0; t < nbTris; t++) {
+        const double* v = &c.tris[9 * t];
+        const gp_Vec e1(v[3] - v[0], v[4] - v[1], v[5] - v[2]);
+        const gp_Vec e2(v[6] - v[0], v[7] - v[1], v[8] - v[2]);
+        const gp_Vec n = e1.Crossed(e2);
+        const double mag = n.Magnitude();
+        if (mag > 0 && std::abs(n.Z()) > 1e-12 * mag) c.invNz[t] = mag / std::abs(n.Z());
+        for (int k = 0; k < 3; k++) {
+            xmin = std::min(xmin, v[3 * k]);     xmax = std::max(xmax, v[3 * k]);
+            ymin = std::min(ymin, v[3 * k + 1]); ymax = std::max(ymax, v[3 * k + 1]);
+        }
+    }
+    const int32_t side = std::max(1, std::min(1024, (int32_t)std::sqrt(nbTris / 2.0)));
+    c.gridNx = c.gridNy = side;
+    c.gridX0 = xmin;
+    c.gridY0 = ymin;
+    c.cellW = std::max(xmax - xmin, 1e-12) / side;
+    c.cellH = std::max(ymax - ymin, 1e-12) / side;
+
+    auto cellRange = [&](const double* v, int32_t& i0, int32_t& i1, int32_t& j0, int32_t& j1) {
+        const double x0 = std::min({v[0], v[3], v[6]}) - c.band, x1 = std::max({v[0], v[3], v[6]}) + c.band;
+        const double y0 = std::min({v[1], v[4], v[7]}) - c.band, y1 = std::max({v[1], v[4], v[7]}) + c.band;
+        i0 = std::max(0, std::min(side - 1, (int32_t)((x0 - c.gridX0) / c.cellW)));
+        i1 = std::max(0, std::min(side - 1, (int32_t)((x1 - c.gridX0) / c.cellW)));
+        j0 = std::max(0, std::min(side - 1, (int32_t)((y0 - c.gridY0) / c.cellH)));
+        j1 = std::max(0, std::min(side - 1, (int32_t)((y1 - c.gridY0) / c.cellH)));
+    };
+
+    c.cellStart.assign((size_t)side * side + 1, 0);
+    for (int32_t t = 0; t < nbTris; t++) {
+        int32_t i0, i1, j0, j1;
+        cellRange(&c.tris[9 * t], i0, i1, j0, j1);
+        for (int32_t j = j0; j <= j1; j++)
+            for (int32_t i = i0; i <= i1; i++) c.cellStart[j * side + i + 1]++;
+    }
+    for (size_t k = 1; k < c.cellStart.size(); k++) c.cellStart[k] += c.cellStart[k - 1];
+    c.cellTris.resize(c.cellStart.back());
+    std::vector<int32_t> cursor(c.cellStart.begin(), c.cellStart.end() - 1);
+    for (int32_t t = 0; t < nbTris; t++) {
+        int32_t i0, i1, j0, j1;
+        cellRange(&c.tris[9 * t], i0, i1, j0, j1);
+        for (int32_t j = j0; j <= j1; j++)
+            for (int32_t i = i0; i <= i1; i++) c.cellTris[cursor[j * side + i]++] = t;
+    }
+}
+
+// Ray-parity along +Z. Returns IN/OUT, or -1 when the mesh can't decide: the ray grazes a
+// mesh edge/vertex, or the point may lie within the tolerance + deflection band of a
+// triangle. A cell holds every triangle whose XY box, grown by the band, touches it, so
+// every triangle that could be that close is tested.
+static int32_t scMeshParity(const OCCTSolidClassifier& c, const gp_Pnt& p) {
+    const double px = p.X(), py = p.Y(), pz = p.Z();
+    const double fx = (px - c.gridX0) / c.cellW, fy = (py - c.gridY0) / c.cellH;
+    const double slackX = c.band / c.cellW, slackY = c.band / c.cellH;
+    if (fx < -slackX || fy < -slackY || fx > c.gridNx + slackX || fy > c.gridNy + slackY)
+        return (int32_t)TopAbs_OUT;
+    if (fx < 0 || fy < 0 || fx >= c.gridNx || fy >= c.gridNy) return -1;  // on the mesh silhouette
+    const int32_t i = std::min(c.gridNx - 1, (int32_t)fx);
+    const int32_t j = std::min(c.gridNy - 1, (int32_t)fy);
+    const int32_t cell = j * c.gridNx + i;
+    int32_t crossings = 0;
+    for (int32_t k = c.cellStart[cell]; k < c.cellStart[cell + 1]; k++) {
+        const int32_t t = c.cellTris[k];
+        const double* v = &c.tris[9 * t];
+        const double zmin = std::min({v[2], v[5], v[8]}), zmax = std::max({v[2], v[5], v[8]});
+        const bool zNear = pz >= zmin - c.band && pz <= zmax + c.band;
+        if (c.invNz[t] == 0) {
+            // Vertical: never crossed by the ray, but the point may sit on it.
+            const double x0 = std::min({v[0], v[3], v[6]}), x1 = std::max({v[0], v[3], v[6]});
+            const double y0 = std::min({v[1], v[4], v[7]}), y1 = std::max({v[1], v[4], v[7]});
+            if (zNear && px >= x0 - c.band && px <= x1 + c.band &&
+                py >= y0 - c.band && py <= y1 + c.band) return -1;
+            continue;
+        }
+        double w0 = (v[3] - px) * (v[7] - py) - (v[4] - py) * (v[6] - px);
+        double w1 = (v[6] - px) * (v[1] - py) - (v[7] - py) * (v[0] - px);
+        double w2 = (v[0] - px) * (v[4] - py) - (v[1] - py) * (v[3] - px);
+        double area = w0 + w1 + w2;
+        if (area < 0) { w0 = -w0; w1 = -w1; w2 = -w2; area = -area; }
+        const double eps = 1e-9 * area;
+        if (w0 < -eps || w1 < -eps || w2 < -eps) {
+            // Missed; still undecidable if the point is within the band of this triangle.
+            // The distance to a violated edge line bounds the 2D (hence 3D) distance from below.
+            if (!zNear) continue;
+            double gap = 0;
+            if (w0 < 0) gap = std::max(gap, -w0 / std::hypot(v[6] - v[3], v[7] - v[4]));
+            if (w1 < 0) gap = std::max(gap, -w1 / std::hypot(v[0] - v[6], v[1] - v[7]));
+            if (w2 < 0) gap = std::max(gap, -w2 / std::hypot(v[3] - v[0], v[4] - v[1]));
+            if (gap <= c.band) return -1;
+            continue;
+        }
+        if (w0 <= eps || w1 <= eps || w2 <= eps) return -1;
+        const double z = (w0 * v[2] + w1 * v[5] + w2 * v[8]) / area;
+        const double dz = z - pz;
+        if (std::abs(dz) <= c.band * c.invNz[t]) return -1;
+        if (dz > 0) crossings++;
+    }
+    return (int32_t)((crossings & 1) ? TopAbs_IN : TopAbs_OUT);
+}
+
+OCCTSolidClassifierRef OCCTSolidClassifierCreate(OCCTShapeRef shape, double tolerance,
+                                                 double meshDeflection) {
+    if (!shape || shape->shape.IsNull() || !(tolerance >= 0) || !(meshDeflection >= 0)) return nullptr;
+    try {
+        auto* c = new OCCTSolidClassifier();
+        c->shape = shape->shape;
+        c->tolerance = tolerance;
+        BRepBndLib::Add(c->shape, c->box, Standard_False);
+        if (c->box.IsVoid()) { delete c; return nullptr; }
+        c->box.Enlarge(tolerance + Precision::Confusion());
+        c->pool.emplace_back(new BRepClass3d_SolidExplorer(c->shape));
+
+        if (meshDeflection > 0 && TopExp_Explorer(c->shape, TopAbs_SOLID).More()) {
+            BRepMesh_IncrementalMesh mesher(c->shape, meshDeflection, Standard_False, 0.5, Standard_True);
+            if (pxIsClosed(c->shape) && pxCollectTriangles(c->shape, c->tris) && !c->tris.empty()) {
+                c->band = tolerance + meshDeflection;
+                scBuildGrid(*c);
+                c->hasMesh = true;
+            } else {
+                c->tris.clear();
+            }
+        }
+        return c;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTSolidClassifierRelease(OCCTSolidClassifierRef classifier) {
+    delete classifier;
+}
+
+bool OCCTSolidClassifierHasMeshPath(OCCTSolidClassifierRef classifier) {
+    return classifier && classifier->hasMesh;
+}
+
+OCCTTopAbsState OCCTSolidClassifierClassify(OCCTSolidClassifierRef classifier,
+                                            double px, double py, double pz) {
+    if (!classifier) return 3;
+    try {
+        auto explorer = scAcquire(*classifier);
+        const int32_t state = scExact(*classifier, *explorer, gp_Pnt(px, py, pz));
+        scRelease(*classifier, std::move(explorer));
+        return state;
+    } catch (...) { return 3; }
+}
+
+int32_t OCCTSolidClassifierClassifyPoints(OCCTSolidClassifierRef classifier,
+                                          const double* coords, int32_t count,
+                                          OCCTTopAbsState* outStates,
+                                          bool useMesh, bool parallel) {
+    if (!classifier || !coords || !outStates || count < 0) return -1;
+    try {
+        auto& c = *classifier;
+        const bool mesh = useMesh && c.hasMesh;
+        std::vector<uint8_t> fast(mesh ? count : 0, 0);
+        occtParallelChunks(count, [&](int32_t begin, int32_t end) {
+            std::unique_ptr<BRepClass3d_SolidExplorer> explorer;
+            for (int32_t i = begin; i < end; i++) {
+                const gp_Pnt p(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
+                try {
+                    if (c.box.IsOut(p)) {
+                        outStates[i] = (int32_t)TopAbs_OUT;
+                        if (mesh) fast[i] = 1;
+                        continue;
+                    }
+                    if (mesh) {
+                        const int32_t state = scMeshParity(c, p);
+                        if (state >= 0) { outStates[i] = state; fast[i] = 1; continue; }
+                    }
+                    if (!explorer) explorer = scAcquire(c);
+                    outStates[i] = scExact(c, *explorer, p);
+                } catch (...) {
+                    outStates[i] = 3;
+                }
+            }
+            if (explorer) scRelease(c, std::move(explorer));
+        }, parallel);
+        int32_t nbFast = 0;
+        for (uint8_t f : fast) nbFast += f;
+        return nbFast;
+    } catch (...) {
+        return -1;
+    }
+}
+
+// MARK: - Voxelization & Signed Distance Field
+
+struct OCCTVoxelGrid {
+    int32_t nx = 0, ny = 0, nz = 0;
+    double origin[3] = {0, 0, 0};
+    double h = 1;
+    std::vector<uint8_t> bits;            // bit-packed occupancy
+    std::vector<float> sdf;
+    int64_t occupied = 0;
+};
+
+// Squared distance from p to triangle (a, b, c) — closest-point regions after Ericson,
+// Real-Time Collision Detection §5.1.5.
+static double vxDist2PointTriangle(const double p[3], const double* v) {
+    const gp_XYZ P(p[0], p[1], p[2]);
+    const gp_XYZ A(v[0], v[1], v[2]), B(v[3], v[4], v[5]), C(v[6], v[7], v[8]);
+    const gp_XYZ ab = B - A, ac = C - A, ap = P - A;
+    const double d1 = ab.Dot(ap), d2 = ac.Dot(ap);
+    if (d1 <= 0 && d2 <= 0) return ap.SquareModulus();
+    const gp_XYZ bp = P - B;
+    const double d3 = ab.Dot(bp), d4 = ac.Dot(bp);
+    if (d3 >= 0 && d4 <= d3) return bp.SquareModulus();
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        const double t = d1 / (d1 - d3);
+        return (P - (A + ab * t)).SquareModulus();
+    }
+    const gp_XYZ cp = P - C;
+    const double d5 = ab.Dot(cp), d6 = ac.Dot(cp);
+    if (d6 >= 0 && d5 <= d6) return cp.SquareModulus();
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        const double t = d2 / (d2 - d6);
+        return (P - (A + ac * t)).SquareModulus();
+    }
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+        const double t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return (P - (B + (C - B) * t)).SquareModulus();
+    }
+    const double denom = 1.0 / (va + vb + vc);
+    const double v2 = vb * denom, w2 = vc * denom;
+    return (P - (A + ab * v2 + ac * w2)).SquareModulus();
+}
+
+OCCTVoxelGridRef OCCTVoxelGridCreate(OCCTShapeRef shape, double voxelSize, int32_t padding,
+                                     double bandWidth, double deflection, bool parallel) {
+    if (!shape || shape->shape.IsNull() || !(voxelSize > 0) || !(bandWidth >= 0)) return nullptr;
+    try {
+        const double h = voxelSize;
+        // Mesh within half a voxel of the surface, so every voxel whose centre could be on
+        // the other side of the true surface lands in the exactly classified shell.
+        deflection = deflection > 0 ? std::min(deflection, 0.5 * h) : 0.25 * h;
+        BRepMesh_IncrementalMesh mesher(shape->shape, deflection, Standard_False, 0.5, Standard_True);
+        std::vector<double> tris;
+        if (!pxCollectTriangles(shape->shape, tris) || tris.empty()) return nullptr;
+        const int32_t nbTris = (int32_t)(tris.size() / 9);
+
+        double lo[3] = { 1e300, 1e300, 1e300 }, hi[3] = { -1e300, -1e300, -1e300 };
+        for (size_t k = 0; k < tris.size(); k++) {
+            lo[k % 3] = std::min(lo[k % 3], tris[k]);
+            hi[k % 3] = std::max(hi[k % 3], tris[k]);
+        }
+        padding = std::max(padding, 1);
+        std::unique_ptr<OCCTVoxelGrid> g(new OCCTVoxelGrid());
+        g->h = h;
+        int32_t dims[3];
+        int64_t total = 1;
+        for (int a = 0; a < 3; a++) {
+            const double cells = std::ceil((hi[a] - lo[a]) / h);
+            if (cells + 2.0 * padding > (double)(1 << 27)) return nullptr;
+            dims[a] = std::max(1, (int32_t)cells) + 2 * padding;
+            g->origin[a] = 0.5 * (lo[a] + hi[a]) - 0.5 * dims[a] * h;
+            total *= dims[a];
+        }
+        if (total > ((int64_t)1 << 27)) return nullptr;
+        g->nx = dims[0]; g->ny = dims[1]; g->nz = dims[2];
+        const int64_t nxy = (int64_t)g->nx * g->ny;
+
+        // A voxel cube touches the mesh only if its centre is within half a diagonal of it.
+        const double shellR = 0.5 * std::sqrt(3.0) * h;
+        const double bandR = std::max(bandWidth * h, shellR);
+
+        // Bucket triangles by the z slices whose centres lie within bandR of them.
+        auto sliceOf = [&](double z, bool up) {
+            const double f = (z - g->origin[2]) / h - 0.5;
+            const int32_t k = (int32_t)(up ? std::floor(f) : std::ceil(f));
+            return std::max(0, std::min(g->nz - 1, k));
+        };
+        std::vector<int32_t> sliceStart(g->nz + 1, 0);
+        std::vector<int32_t> triK0(nbTris), triK1(nbTris);
+        for (int32_t t = 0; t < nbTris; t++) {
+            const double* v = &tris[9 * t];
+            triK0[t] = sliceOf(std::min({v[2], v[5], v[8]}) - bandR, false);
+            triK1[t] = sliceOf(std::max({v[2], v[5], v[8]}) + bandR, true);
+            for (int32_t k = triK0[t]; k <= triK1[t]; k++) sliceStart[k + 1]++;
+        }
+        for (int32_t k = 0; k < g->nz; k++) sliceStart[k + 1] += sliceStart[k];
+        std::vector<int32_t> sliceTris(sliceStart.back());
+        {
+            std::vector<int32_t> cursor(sliceStart.begin(), sliceStart.end() - 1);
+            for (int32_t t = 0; t < nbTris; t++)
+                for (int32_t k = triK0[t]; k <= triK1[t]; k++) sliceTris[cursor[k]++] = t;
+        }
+
+        // Unsigned distance (clamped to bandR) per voxel; each slice is owned by one chunk.
+        g->sdf.assign((size_t)total, (float)bandR);
+        occtParallelChunks(g->nz, [&](int32_t k0, int32_t k1) {
+            for (int32_t k = k0; k < k1; k++) {
+                float* slice = &g->sdf[(size_t)(k * nxy)];
+                const double pz = g->origin[2] + (k + 0.5) * h;
+                for (int32_t s = sliceStart[k]; s < sliceStart[k + 1]; s++) {
+                    const double* v = &tris[9 * sliceTris[s]];
+                    const auto cellRange = [&](int axis, int32_t n, int32_t& c0, int32_t& c1) {
+                        const double mn = std::min({v[axis], v[axis + 3], v[axis + 6]}) - bandR;
+                        const double mx = std::max({v[axis], v[axis + 3], v[axis + 6]}) + bandR;
+                        c0 = std::max(0, (int32_t)std::ceil((mn - g->origin[axis]) / h - 0.5));
+                        c1 = std::min(n - 1, (int32_t)std::floor((mx - g->origin[axis]) / h - 0.5));
+                    };
+                    int32_t i0, i1, j0, j1;
+                    cellRange(0, g->nx, i0, i1);
+                    cellRange(1, g->ny, j0, j1);
+                    for (int32_t j = j0; j <= j1; j++) {
+                        for (int32_t i = i0; i <= i1; i++) {
+                            const double p[3] = { g->origin[0] + (i + 0.5) * h,
+                                                  g->origin[1] + (j + 0.5) * h, pz };
+                            const float d = (float)std::sqrt(vxDist2PointTriangle(p, v));
+                            float& cell = slice[(size_t)j * g->nx + i];
+                            if (d < cell) cell = d;
+                        }
+                    }
+                }
+            }
+        }, parallel);
+
+        // 0 = unknown, 1 = shell (touches the mesh), 2 = outside, 3 = inside,
+        // 4 = enclosed component awaiting the classification of its representative.
+        std::vector<uint8_t> label((size_t)total, 0);
+        std::vector<int64_t> shell;
+        for (int64_t idx = 0; idx < total; idx++) {
+            if (g->sdf[idx] <= shellR) { label[idx] = 1; shell.push_back(idx); }
+        }
+
+        // Relabel the 6-connected non-shell component of `seed` from label `from` to `to`.
+        // Any path between neighbouring centres that crosses the mesh passes through a
+        // shell voxel, so a flood never leaks across the surface.
+        std::vector<int64_t> stack;
+        auto flood = [&](int64_t seed, uint8_t from, uint8_t to) {
+            label[seed] = to;
+            stack.push_back(seed);
+            while (!stack.empty()) {
+                const int64_t idx = stack.back();
+                stack.pop_back();
+                const int32_t i = (int32_t)(idx % g->nx);
+                const int32_t j = (int32_t)((idx / g->nx) % g->ny);
+                const int32_t k = (int32_t)(idx / nxy);
+                const int64_t nbrs[6] = {
+                    i > 0 ? idx - 1 : -1, i + 1 < g->nx ? idx + 1 : -1,
+                    j > 0 ? idx - g->nx : -1, j + 1 < g->ny ? idx + g->nx : -1,
+                    k > 0 ? idx - nxy : -1, k + 1 < g->nz ? idx + nxy : -1 };
+                for (int64_t n : nbrs) {
+                    if (n >= 0 && label[n] == from) { label[n] = to; stack.push_back(n); }
+                }
+            }
+        };
+
+        // The outside, from a padded corner. Whatever it doesn't reach is either solid
+        // material or an enclosed cavity; one voxel centre per component decides which.
+        flood(0, 0, 2);
+        std::vector<int64_t> enclosed;
+        for (int64_t idx = 0; idx < total; idx++) {
+            if (label[idx] == 0) { enclosed.push_back(idx); flood(idx, 0, 4); }
+        }
+
+        // Exact classification of the shell voxel centres and of the component
+        // representatives, with the cached classifier.
+        OCCTShape wrapped(shape->shape);
+        OCCTSolidClassifierRef classifier = OCCTSolidClassifierCreate(&wrapped, Precision::Confusion(), 0.0);
+        if (!classifier) return nullptr;
+        const int32_t nbShell = (int32_t)shell.size();
+        const int32_t nbQuery = nbShell + (int32_t)enclosed.size();
+        std::vector<double> centres((size_t)nbQuery * 3);
+        for (int32_t s = 0; s < nbQuery; s++) {
+            const int64_t idx = s < nbShell ? shell[s] : enclosed[s - nbShell];
+            centres[3 * s]     = g->origin[0] + ((idx % g->nx) + 0.5) * h;
+            centres[3 * s + 1] = g->origin[1] + (((idx / g->nx) % g->ny) + 0.5) * h;
+            centres[3 * s + 2] = g->origin[2] + ((idx / nxy) + 0.5) * h;
+        }
+        std::vector<OCCTTopAbsState> states(nbQuery, (int32_t)TopAbs_OUT);
+        const int32_t rc = OCCTSolidClassifierClassifyPoints(classifier, centres.data(), nbQuery,
+                                                             states.data(), false, parallel);
+        OCCTSolidClassifierRelease(classifier);
+        if (rc < 0) return nullptr;
+        for (int32_t s = 0; s < nbQuery; s++) {
+            const int32_t st = states[s];
+            const bool in = st == (int32_t)TopAbs_IN || st == (int32_t)TopAbs_ON;
+            if (s < nbShell) label[shell[s]] = in ? 3 : 2;
+            else flood(enclosed[s - nbShell], 4, in ? 3 : 2);
+        }
+
+        // Pack occupancy and sign the distance field.
+        g->bits.assign((size_t)((total + 7) / 8), 0);
+        for (int64_t idx = 0; idx < total; idx++) {
+            if (label[idx] == 2) continue;
+            g->bits[idx >> 3] |= (uint8_t)(1u << (idx & 7));
+            g->sdf[idx] = -g->sdf[idx];
+            g->occupied++;
+        }
+        return g.release();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTVoxelGridRelease(OCCTVoxelGridRef grid) {
+    delete grid;
+}
+
+void OCCTVoxelGridGetInfo(OCCTVoxelGridRef grid, int32_t* nx, int32_t* ny, int32_t* nz,
+                          double* origin, double* voxelSize) {
+    *nx = grid->nx;
+    *ny = grid->ny;
+    *nz = grid->nz;
+    origin[0] = grid->origin[0];
+    origin[1] = grid->origin[1];
+    origin[2] = grid->origin[2];
+    *voxelSize = grid->h;
+}
+
+int64_t OCCTVoxelGridOccupiedCount(OCCTVoxelGridRef grid) {
+    return grid->occupied;
+}
+
+bool OCCTVoxelGridIsOccupied(OCCTVoxelGridRef grid, int32_t i, int32_t j, int32_t k) {
+    if (i < 0 || j < 0 || k < 0 || i >= grid->nx || j >= grid->ny || k >= grid->nz) return false;
+    const int64_t idx = i + (int64_t)grid->nx * (j + (int64_t)grid->ny * k);
+    return (grid->bits[idx >> 3] >> (idx & 7)) & 1;
+}
+
+int64_t OCCTVoxelGridGetOccupancy(OCCTVoxelGridRef grid, uint8_t* outBits) {
+    if (outBits) std::copy(grid->bits.begin(), grid->bits.end(), outBits);
+    return (int64_t)grid->bits.size();
+}
+
+void OCCTVoxelGridGetSDF(OCCTVoxelGridRef grid, float* outValues) {
+    std::copy(grid->sdf.begin(), grid->sdf.end(), outValues);
+}
+
+// MARK: - Batched Point Projection
+
+// Triangle BVH over a shape's face meshes (median split on the longest axis).
+// A leaf (count > 0) covers order[start, start + count).
+struct PXBVHNode {
+    double lo[3], hi[3];
+    int32_t start, count, left, right;
+};
+
+struct PXTriangleBVH {
+    std::vector<double> tris;            // 9 doubles per triangle
+    std::vector<int32_t> triFace;        // face index (index-map order) per triangle
+    std::vector<int32_t> order;          // triangle ids, leaf order
+    std::vector<PXBVHNode> nodes;
+};
+
+// Scratch stack for BVH walks: growable, so no subtree is ever skipped, and kept per
+// thread so a walk per query point doesn't allocate. Walks must not nest.
+static std::vector<int32_t>& pxWalkStack() {
+    static thread_local std::vector<int32_t> stack;
+    stack.clear();
+    return stack;
+}
+
+static double pxBoxDist2(const PXBVHNode& n, const double p[3]) {
+    double d2 = 0;
+    for (int a = 0; a < 3; a++) {
+        const double d = p[a] < n.lo[a] ? n.lo[a] - p[a] : (p[a] > n.hi[a] ? p[a] - n.hi[a] : 0.0);
+        d2 += d * d;
+    }
+    return d2;
+}
+
+static void pxBuildBVH(PXTriangleBVH& bvh) {
+    const int32_t nbTris = (int32_t)bvh.triFace.size();
+    std::vector<double> centroid(3 * nbTris);
+    for (int32_t t = 0; t < nbTris; t++) {
+        const double* v = &bvh.tris[9 * t];
+        for (int a = 0; a < 3; a++) centroid[3 * t + a] = (v[a] + v[3 + a] + v[6 + a]) / 3.0;
+    }
+    bvh.order.resize(nbTris);
+    for (int32_t t = 0; t < nbTris; t++) bvh.order[t] = t;
+    bvh.nodes.clear();
+    bvh.nodes.reserve(2 * (nbTris / 4 + 1));
+
+    // (node index, start, count); the node is created before its range is split.
+    struct Job { int32_t node, start, count; };
+    std::vector<Job> stack;
+    bvh.nodes.push_back(PXBVHNode());
+    stack.push_back({0, 0, nbTris});
+    while (!stack.empty()) {
+        const Job job = stack.back();
+        stack.pop_back();
+        PXBVHNode& node = bvh.nodes[job.node];
+        for (int a = 0; a < 3; a++) { node.lo[a] = 1e300; node.hi[a] = -1e300; }
+        for (int32_t k = job.start; k < job.start + job.count; k++) {
+            const double* v = &bvh.tris[9 * bvh.order[k]];
+            for (int c = 0; c < 3; c++) {
+                for (int a = 0; a < 3; a++) {
+                    node.lo[a] = std::min(node.lo[a], v[3 * c + a]);
+                    node.hi[a] = std::max(node.hi[a], v[3 * c + a]);
+                }
+            }
+        }
+        node.start = job.start;
+        if (job.count <= 4) {
+            node.count = job.count;
+            node.left = node.right = -1;
+            continue;
+        }
+        node.count = 0;
+        int axis = 0;
+        for (int a = 1; a < 3; a++) {
+            if (node.hi[a] - node.lo[a] > node.hi[axis] - node.lo[axis]) axis = a;
+        }
+        const int32_t half = job.count / 2;
+        std::nth_element(bvh.order.begin() + job.start, bvh.order.begin() + job.start + half,
+                         bvh.order.begin() + job.start + job.count,
+                         [&](int32_t x, int32_t y) { return centroid[3 * x + axis] < centroid[3 * y + axis]; });
+        const int32_t left = (int32_t)bvh.nodes.size();
+        bvh.nodes.push_back(PXBVHNode());
+        const int32_t right = (int32_t)bvh.nodes.size();
+        bvh.nodes.push_back(PXBVHNode());
+        // `node` may dangle after the push_backs above; index through bvh.nodes.
+        bvh.nodes[job.node].left = left;
+        bvh.nodes[job.node].right = right;
+        stack.push_back({right, job.start + half, job.count - half});
+        stack.push_back({left, job.start, half});
+    }
+}
+
+// Mesh `shape` and fill `bvh` with its face triangles (faces in `faceMap` order).
+// `pad` receives a conservative bound on how far the mesh can be from the exact
+// surface: twice the largest recorded deflection plus the largest face tolerance.
+static bool pxMeshIntoBVH(const TopoDS_Shape& shape, const TopTools_IndexedMapOfShape& faceMap,
+                          double deflection, PXTriangleBVH& bvh, double& pad) {
+    BRepMesh_IncrementalMesh mesher(shape, deflection, Standard_False, 0.5, Standard_True);
+    double meshDeflection = deflection, maxTolerance = 0;
+    for (int32_t f = 1; f <= faceMap.Extent(); f++) {
+        const TopoDS_Face& face = TopoDS::Face(faceMap(f));
+        if (!pxAppendFaceTriangles(face, bvh.tris)) continue;
+        bvh.triFace.resize(bvh.tris.size() / 9, f - 1);
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) tri = BRep_Tool::Triangulation(face, loc);
+        meshDeflection = std::max(meshDeflection, tri->Deflection());
+        maxTolerance = std::max(maxTolerance, BRep_Tool::Tolerance(face));
+    }
+    if (bvh.triFace.empty()) return false;
+    pad = 2.0 * meshDeflection + maxTolerance;
+    pxBuildBVH(bvh);
+    return true;
+}
+
+struct OCCTShapeProjector {
+    TopoDS_Shape shape;
+    std::vector<TopoDS_Face> faces;      // index-map order
+    PXTriangleBVH bvh;
+    double pad = 0;                      // mesh-to-surface slack on both sides
+};
+
+// Nearest mesh distance per face, pruned to faces that can still hold the exact
+// closest point: a face is kept while its mesh distance is within 2·pad of the
+// best mesh distance seen. `faceDist2` is indexed by face and reset by the caller.
+static void pjCandidates(const OCCTShapeProjector& pj, const double p[3], double cutoff2,
+                         std::vector<double>& faceDist2, std::vector<int32_t>& touched,
+                         double& best2) {
+    best2 = cutoff2;
+    auto limit2 = [&]() {
+        const double r = std::sqrt(best2) + 2.0 * pj.pad;
+        return std::min(cutoff2, r * r);
+    };
+    std::vector<int32_t>& stack = pxWalkStack();
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const PXBVHNode& n = pj.bvh.nodes[stack.back()];
+        stack.pop_back();
+        if (pxBoxDist2(n, p) > limit2()) continue;
+        if (n.count > 0) {
+            for (int32_t k = n.start; k < n.start + n.count; k++) {
+                const int32_t t = pj.bvh.order[k];
+                const double d2 = vxDist2PointTriangle(p, &pj.bvh.tris[9 * t]);
+                const int32_t f = pj.bvh.triFace[t];
+                if (faceDist2[f] < 0) touched.push_back(f);
+                if (faceDist2[f] < 0 || d2 < faceDist2[f]) faceDist2[f] = d2;
+                best2 = std::min(best2, d2);
+            }
+            continue;
+        }
+        const int32_t left = n.left, right = n.right;
+        const bool leftFirst = pxBoxDist2(pj.bvh.nodes[left], p) <= pxBoxDist2(pj.bvh.nodes[right], p);
+        stack.push_back(leftFirst ? right : left);
+        stack.push_back(leftFirst ? left : right);
+    }
+}
+
+// Per-worker exact state for one face, built on first use and reused for every
+// point the worker projects onto that face.
+struct PJFaceState {
+    struct Boundary {
+        TopoDS_Edge edge;
+        BRepAdaptor_Curve curve;
+        Extrema_ExtPC ext;
+        Handle(Geom2d_Curve) pcurve;
+        Boundary(const TopoDS_Edge& e, const TopoDS_Face& f) : edge(e), curve(e) {
+            ext.Initialize(curve, curve.FirstParameter(), curve.LastParameter());
+            Standard_Real first, last;
+            pcurve = BRep_Tool::CurveOnSurface(e, f, first, last);
+        }
+    };
+
+    TopoDS_Face face;
+    BRepAdaptor_Surface surface;
+    Extrema_GenExtPS ext;
+    BRepTopAdaptor_FClass2d classifier;
+    std::vector<std::unique_ptr<Boundary>> boundary;   // built on the first outside hit
+    bool boundaryReady = false;
+
+    explicit PJFaceState(const TopoDS_Face& f)
+        : face(f), surface(f), classifier(f, Precision::PConfusion()) {
+        double u0, u1, v0, v1;
+        BRepTools::UVBounds(f, u0, u1, v0, v1);
+        ext.SetFlag(Extrema_ExtFlag_MIN);
+        ext.SetAlgo(Extrema_ExtAlgo_Tree);
+        ext.Initialize(surface, 20, 20, u0, u1, v0, v1, Precision::PConfusion(), Precision::PConfusion());
+    }
+};
+
+// Exact closest point of `face` to p. Returns false if nothing was found.
+static bool pjProjectOnFace(PJFaceState& st, const gp_Pnt& p, double& d2, double& u, double& v,
+                            gp_Pnt& foot, int32_t& status) {
+    d2 = 1e300;
+    st.ext.Perform(p);
+    if (st.ext.IsDone()) {
+        for (int i = 1; i <= st.ext.NbExt(); i++) {
+            if (st.ext.SquareDistance(i) >= d2) continue;
+            double pu, pv;
+            st.ext.Point(i).Parameter(pu, pv);
+            if (st.classifier.Perform(gp_Pnt2d(pu, pv)) == TopAbs_OUT) continue;
+            d2 = st.ext.SquareDistance(i);
+            u = pu; v = pv;
+            foot = st.ext.Point(i).Value();
+            status = 0;
+        }
+    }
+    if (d2 < 1e300) return true;
+
+    // The surface minimum lies outside the trimmed face: the closest point of the
+    // face is on its boundary.
+    if (!st.boundaryReady) {
+        for (TopExp_Explorer ex(st.face, TopAbs_EDGE); ex.More(); ex.Next()) {
+            const TopoDS_Edge& e = TopoDS::Edge(ex.Current());
+            if (BRep_Tool::Degenerated(e) || !BRep_Tool::IsGeometric(e)) continue;
+            st.boundary.emplace_back(new PJFaceState::Boundary(e, st.face));
+        }
+        st.boundaryReady = true;
+    }
+    for (const auto& b : st.boundary) {
+        double param = 0, bd2 = 1e300;
+        gp_Pnt q;
+        b->ext.Perform(p);
+        if (b->ext.IsDone()) {
+            for (int i = 1; i <= b->ext.NbExt(); i++) {
+                if (b->ext.SquareDistance(i) < bd2) {
+                    bd2 = b->ext.SquareDistance(i);
+                    param = b->ext.Point(i).Parameter();
+                    q = b->ext.Point(i).Value();
+                }
+            }
+        }
+        // Segment endpoints (vertices) are not extrema of the curve.
+        const double first = b->curve.FirstParameter(), last = b->curve.LastParameter();
+        const gp_Pnt pf = b->curve.Value(first), pl = b->curve.Value(last);
+        if (p.SquareDistance(pf) < bd2) { bd2 = p.SquareDistance(pf); param = first; q = pf; }
+        if (p.SquareDistance(pl) < bd2) { bd2 = p.SquareDistance(pl); param = last; q = pl; }
+        if (bd2 >= d2) continue;
+        d2 = bd2;
+        foot = q;
+        status = 1;
+        if (!b->pcurve.IsNull()) {
+            const gp_Pnt2d uv = b->pcurve->Value(param);
+            u = uv.X(); v = uv.Y();
+        }
+    }
+    return d2 < 1e300;
+}
+
+OCCTShapeProjectorRef OCCTShapeProjectorCreate(OCCTShapeRef shape, double deflection) {
+    if (!shape || shape->shape.IsNull()) return nullptr;
+    try {
+        Bnd_Box box;
+        BRepBndLib::Add(shape->shape, box, Standard_False);
+        if (box.IsVoid()) return nullptr;
+        if (!(deflection > 0)) deflection = 0.005 * std::sqrt(box.SquareExtent());
+
+        auto* pj = new OCCTShapeProjector();
+        pj->shape = shape->shape;
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
+        for (int32_t f = 1; f <= faceMap.Extent(); f++) pj->faces.push_back(TopoDS::Face(faceMap(f)));
+        if (!pxMeshIntoBVH(pj->shape, faceMap, deflection, pj->bvh, pj->pad)) { delete pj; return nullptr; }
+        return pj;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTShapeProjectorRelease(OCCTShapeProjectorRef projector) {
+    delete projector;
+}
+
+int32_t OCCTShapeProjectorFaceCount(OCCTShapeProjectorRef projector) {
+    return projector ? (int32_t)projector->faces.size() : 0;
+}
+
+int32_t OCCTShapeProjectorProject(OCCTShapeProjectorRef projector, const double* coords, int32_t count,
+                                  double maxDistance, OCCTPointProjection* outResults, bool parallel) {
+    if (!projector || !coords || !outResults || count < 0) return -1;
+    try {
+        const OCCTShapeProjector& pj = *projector;
+        const int32_t nbFaces = (int32_t)pj.faces.size();
+        const double cutoff = maxDistance > 0 ? maxDistance + pj.pad : 1e150;
+        std::atomic<int32_t> found{0};
+
+        occtParallelChunks(count, [&](int32_t begin, int32_t end) {
+            std::vector<std::unique_ptr<PJFaceState>> states(nbFaces);
+            std::vector<double> faceDist2(nbFaces, -1.0);
+            std::vector<int32_t> touched;
+            std::vector<std::pair<double, int32_t>> candidates;
+            int32_t nbFound = 0;
+            for (int32_t i = begin; i < end; i++) {
+                OCCTPointProjection& r = outResults[i];
+                r = OCCTPointProjection();
+                r.face = -1;
+                r.status = -1;
+                r.distance = -1;
+                const double p[3] = { coords[3 * i], coords[3 * i + 1], coords[3 * i + 2] };
+                try {
+                    double best2;
+                    touched.clear();
+                    pjCandidates(pj, p, cutoff * cutoff, faceDist2, touched, best2);
+                    candidates.clear();
+                    const double keep = std::sqrt(best2) + 2.0 * pj.pad;
+                    for (int32_t f : touched) {
+                        const double d = std::sqrt(faceDist2[f]);
+                        if (d <= keep) candidates.push_back({d, f});
+                        faceDist2[f] = -1.0;
+                    }
+                    std::sort(candidates.begin(), candidates.end());
+
+                    const gp_Pnt P(p[0], p[1], p[2]);
+                    double bestD2 = 1e300;
+                    for (const auto& c : candidates) {
+                        // The mesh is within pad of the surface: this face can't beat the best.
+                        const double lower = std::max(0.0, c.first - pj.pad);
+                        if (lower * lower > bestD2) break;
+                        auto& st = states[c.second];
+                        if (!st) st.reset(new PJFaceState(pj.faces[c.second]));
+                        double d2, u = 0, v = 0;
+                        gp_Pnt foot;
+                        int32_t status = -1;
+                        if (!pjProjectOnFace(*st, P, d2, u, v, foot, status) || d2 >= bestD2) continue;
+                        bestD2 = d2;
+                        r.face = c.second;
+                        r.status = status;
+                        r.u = u; r.v = v;
+                        r.x = foot.X(); r.y = foot.Y(); r.z = foot.Z();
+                    }
+                    if (r.face >= 0) {
+                        r.distance = std::sqrt(bestD2);
+                        if (maxDistance > 0 && r.distance > maxDistance) {
+                            r = OCCTPointProjection();
+                            r.face = -1; r.status = -1; r.distance = -1;
+                        } else {
+                            nbFound++;
+                        }
+                    }
+                } catch (...) {
+                    for (int32_t f : touched) faceDist2[f] = -1.0;
+                    r.face = -1; r.status = -1; r.distance = -1;
+                }
+            }
+            found += nbFound;
+        }, parallel);
+        return found.load();
+    } catch (...) {
+        return -1;
+    }
+}
+
+// MARK: - Reusable Shape-Shape Distance
+
+// Closest-point distance between two segments.
+static double pxSegSegDist2(const gp_XYZ& p1, const gp_XYZ& q1, const gp_XYZ& p2, const gp_XYZ& q2) {
+    const gp_XYZ d1 = q1 - p1, d2 = q2 - p2, r = p1 - p2;
+    const double a = d1.SquareModulus(), e = d2.SquareModulus(), f = d2.Dot(r);
+    auto clamp01 = [](double x) { return std::min(1.0, std::max(0.0, x)); };
+    double s = 0, t = 0;
+    if (a <= 1e-300 && e <= 1e-300) return r.SquareModulus();
+    if (a <= 1e-300) {
+        t = clamp01(f / e);
+    } else {
+        const double c = d1.Dot(r);
+        if (e <= 1e-300) {
+            s = clamp01(-c / a);
+        } else {
+            const double b = d1.Dot(d2), denom = a * e - b * b;
+            s = denom > 0 ? clamp01((b * f - c * e) / denom) : 0.0;
+            t = (b * s + f) / e;
+            if (t < 0) { t = 0; s = clamp01(-c / a); }
+            else if (t > 1) { t = 1; s = clamp01((b - c) / a); }
+        }
+    }
+    return ((p1 + d1 * s) - (p2 + d2 * t)).SquareModulus();
+}
+
+// Whether segment pq crosses triangle v (Möller–Trumbore, t ∈ [0, 1]). Coplanar
+// contact is left to the vertex/edge distances, which are 0 in that case.
+static bool pxSegmentHitsTriangle(const gp_XYZ& p, const gp_XYZ& q, const double* v) {
+    const gp_XYZ A(v[0], v[1], v[2]), B(v[3], v[4], v[5]), C(v[6], v[7], v[8]);
+    const gp_XYZ dir = q - p, e1 = B - A, e2 = C - A;
+    const gp_XYZ h = dir.Crossed(e2);
+    const double det = e1.Dot(h);
+    if (std::abs(det) < 1e-300) return false;
+    const double inv = 1.0 / det;
+    const gp_XYZ s = p - A;
+    const double u = s.Dot(h) * inv;
+    if (u < 0 || u > 1) return false;
+    const gp_XYZ qv = s.Crossed(e1);
+    const double w = dir.Dot(qv) * inv;
+    if (w < 0 || u + w > 1) return false;
+    const double t = e2.Dot(qv) * inv;
+    return t >= 0 && t <= 1;
+}
+
+// Squared distance between two triangles (0 if they intersect).
+static double pxTriTriDist2(const double* a, const double* b) {
+    const gp_XYZ A[3] = { gp_XYZ(a[0], a[1], a[2]), gp_XYZ(a[3], a[4], a[5]), gp_XYZ(a[6], a[7], a[8]) };
+    const gp_XYZ B[3] = { gp_XYZ(b[0], b[1], b[2]), gp_XYZ(b[3], b[4], b[5]), gp_XYZ(b[6], b[7], b[8]) };
+    for (int i = 0; i < 3; i++) {
+        if (pxSegmentHitsTriangle(A[i], A[(i + 1) % 3], b)) return 0;
+        if (pxSegmentHitsTriangle(B[i], B[(i + 1) % 3], a)) return 0;
+    }
+    double d2 = 1e300;
+    for (int i = 0; i < 3; i++) {
+        d2 = std::min(d2, vxDist2PointTriangle(&a[3 * i], b));
+        d2 = std::min(d2, vxDist2PointTriangle(&b[3 * i], a));
+        for (int j = 0; j < 3; j++) {
+            d2 = std::min(d2, pxSegSegDist2(A[i], A[(i + 1) % 3], B[j], B[(j + 1) % 3]));
+        }
+    }
+    return d2;
+}
+
+// Rigid placement of shape 2 relative to shape 1 (row-major 3×4).
+struct PXPlacement {
+    double m[12] = { 1, 0, 0, 0,  0, 1, 0, 0,  0, 0, 1, 0 };
+
+    void apply(const double* in, double* out) const {
+        for (int r = 0; r < 3; r++) {
+            out[r] = m[4 * r] * in[0] + m[4 * r + 1] * in[1] + m[4 * r + 2] * in[2] + m[4 * r + 3];
+        }
+    }
+    // Axis-aligned box of a transformed box (centre moved, half-extents through |R|).
+    void applyBox(const PXBVHNode& n, double lo[3], double hi[3]) const {
+        const double c[3] = { 0.5 * (n.lo[0] + n.hi[0]), 0.5 * (n.lo[1] + n.hi[1]), 0.5 * (n.lo[2] + n.hi[2]) };
+        const double h[3] = { 0.5 * (n.hi[0] - n.lo[0]), 0.5 * (n.hi[1] - n.lo[1]), 0.5 * (n.hi[2] - n.lo[2]) };
+        double tc[3];
+        apply(c, tc);
+        for (int r = 0; r < 3; r++) {
+            const double e = std::abs(m[4 * r]) * h[0] + std::abs(m[4 * r + 1]) * h[1] + std::abs(m[4 * r + 2]) * h[2];
+            lo[r] = tc[r] - e;
+            hi[r] = tc[r] + e;
+        }
+    }
+};
+
+struct OCCTDistanceEngine {
+    TopoDS_Shape shapes[2];
+    std::vector<TopoDS_Face> faces[2];     // index-map order
+    std::vector<Bnd_Box> faceBoxes[2];     // per-face boxes, tolerance included
+    PXTriangleBVH bvh[2];
+    double pad = 0;                        // |exact − mesh distance| bound (both meshes)
+    std::atomic<int64_t> queries{0};
+    std::atomic<int64_t> decidedByMesh{0};
+    std::atomic<int64_t> exactFacePairs{0};
+};
+
+// Dual BVH traversal: minimum mesh distance per face pair, kept while the pair can still
+// hold the exact minimum (mesh distance within 2·pad of the best seen, and within
+// `cutoff` overall). Stops as soon as the mesh proves distance < stopBelow.
+static double pxMeshDistance(const OCCTDistanceEngine& eng, const PXPlacement& place, double cutoff,
+                             double stopBelow, std::vector<std::pair<double, int64_t>>& facePairs) {
+    const PXTriangleBVH& A = eng.bvh[0];
+    const PXTriangleBVH& B = eng.bvh[1];
+    const int64_t nbFaces2 = (int64_t)eng.faces[1].size();
+    double best2 = 1e300;
+    auto limit2 = [&]() {
+        const double r = std::min(cutoff, best2 < 1e299 ? std::sqrt(best2) + 2.0 * eng.pad : 1e150);
+        return r * r;
+    };
+    auto boxDist2 = [&](int32_t a, int32_t b) {
+        double lo[3], hi[3];
+        place.applyBox(B.nodes[b], lo, hi);
+        const PXBVHNode& n = A.nodes[a];
+        double d2 = 0;
+        for (int k = 0; k < 3; k++) {
+            const double d = std::max(0.0, std::max(n.lo[k] - hi[k], lo[k] - n.hi[k]));
+            d2 += d * d;
+        }
+        return d2;
+    };
+
+    std::vector<std::pair<int32_t, int32_t>> stack;
+    stack.push_back({0, 0});
+    double moved[9];
+    while (!stack.empty()) {
+        const auto [a, b] = stack.back();
+        stack.pop_back();
+        if (boxDist2(a, b) > limit2()) continue;
+        const PXBVHNode& na = A.nodes[a];
+        const PXBVHNode& nb = B.nodes[b];
+        if (na.count > 0 && nb.count > 0) {
+            for (int32_t j = nb.start; j < nb.start + nb.count; j++) {
+                const int32_t tb = B.order[j];
+                for (int c = 0; c < 3; c++) place.apply(&B.tris[9 * tb + 3 * c], &moved[3 * c]);
+                for (int32_t i = na.start; i < na.start + na.count; i++) {
+                    const int32_t ta = A.order[i];
+                    const double d2 = pxTriTriDist2(&A.tris[9 * ta], moved);
+                    if (d2 > limit2()) continue;
+                    facePairs.push_back({d2, (int64_t)A.triFace[ta] * nbFaces2 + B.triFace[tb]});
+                    best2 = std::min(best2, d2);
+                }
+            }
+            if (std::sqrt(best2) + eng.pad < stopBelow) break;
+            continue;
+        }
+        // Descend the larger box (or the one that isn't a leaf).
+        const double sa = (na.hi[0] - na.lo[0]) + (na.hi[1] - na.lo[1]) + (na.hi[2] - na.lo[2]);
+        const double sb = (nb.hi[0] - nb.lo[0]) + (nb.hi[1] - nb.lo[1]) + (nb.hi[2] - nb.lo[2]);
+        if (nb.count > 0 || (na.count == 0 && sa >= sb)) {
+            const double dl = boxDist2(na.left, b), dr = boxDist2(na.right, b);
+            stack.push_back({dl <= dr ? na.right : na.left, b});
+            stack.push_back({dl <= dr ? na.left : na.right, b});
+        } else {
+            const double dl = boxDist2(a, nb.left), dr = boxDist2(a, nb.right);
+            stack.push_back({a, dl <= dr ? nb.right : nb.left});
+            stack.push_back({a, dl <= dr ? nb.left : nb.right});
+        }
+    }
+
+    // Reduce to the minimum per face pair, within the final limit.
+    std::sort(facePairs.begin(), facePairs.end(),
+              [](const std::pair<double, int64_t>& x, const std::pair<double, int64_t>& y) {
+                  return x.second != y.second ? x.second < y.second : x.first < y.first;
+              });
+    const double keep2 = limit2();
+    size_t n = 0;
+    for (size_t k = 0; k < facePairs.size(); k++) {
+        if (k > 0 && facePairs[k].second == facePairs[k - 1].second) continue;
+        if (facePairs[k].first <= keep2) facePairs[n++] = facePairs[k];
+    }
+    facePairs.resize(n);
+    for (auto& fp : facePairs) fp.first = std::sqrt(fp.first);
+    std::sort(facePairs.begin(), facePairs.end());
+    return best2 < 1e299 ? std::sqrt(best2) : -1.0;
+}
+
+// One query. With threshold > 0, returns as soon as distance < threshold is decided
+// either way; *closer receives the answer. Returns false on failure.
+static bool pxEngineQuery(OCCTDistanceEngine& eng, const PXPlacement& place, double threshold,
+                          OCCTDistanceResult* out, int32_t* closer) {
+    eng.queries++;
+    std::vector<std::pair<double, int64_t>> facePairs;
+    const double cutoff = threshold > 0 ? threshold + eng.pad : 1e150;
+    const double meshDist = pxMeshDistance(eng, place, cutoff, threshold, facePairs);
+    if (closer) {
+        // No mesh pair within threshold + pad → exact distance ≥ threshold.
+        if (meshDist < 0) { eng.decidedByMesh++; *closer = 0; return true; }
+        if (meshDist + eng.pad < threshold) { eng.decidedByMesh++; *closer = 1; return true; }
+    }
+    if (facePairs.empty()) return false;
+
+    gp_Trsf trsf;
+    trsf.SetValues(place.m[0], place.m[1], place.m[2], place.m[3],
+                   place.m[4], place.m[5], place.m[6], place.m[7],
+                   place.m[8], place.m[9], place.m[10], place.m[11]);
+    const TopLoc_Location loc(trsf);
+    const int64_t nbFaces2 = (int64_t)eng.faces[1].size();
+
+    double best = 1e300;
+    for (const auto& fp : facePairs) {
+        if (fp.first - eng.pad >= best) break;
+        const int32_t f1 = (int32_t)(fp.second / nbFaces2), f2 = (int32_t)(fp.second % nbFaces2);
+        const Bnd_Box& box1 = eng.faceBoxes[0][f1];
+        const Bnd_Box box2 = eng.faceBoxes[1][f2].Transformed(trsf);
+        if (!box1.IsVoid() && !box2.IsVoid() && box1.Distance(box2) >= best) continue;
+        eng.exactFacePairs++;
+        BRepExtrema_DistShapeShape dist(eng.faces[0][f1], eng.faces[1][f2].Moved(loc));
+        if (!dist.IsDone() || dist.NbSolution() < 1 || dist.Value() >= best) continue;
+        best = dist.Value();
+        if (out) {
+            const gp_Pnt p1 = dist.PointOnShape1(1), p2 = dist.PointOnShape2(1);
+            out->distance = best;
+            out->face1 = f1;
+            out->face2 = f2;
+            out->x1 = p1.X(); out->y1 = p1.Y(); out->z1 = p1.Z();
+            out->x2 = p2.X(); out->y2 = p2.Y(); out->z2 = p2.Z();
+        }
+        if (closer && best < threshold) { *closer = 1; return true; }
+    }
+    if (best >= 1e300) return false;
+    if (closer) *closer = best < threshold ? 1 : 0;
+    return true;
+}
+
+static bool pxPlacementFrom(const double* matrix12, PXPlacement& place) {
+    if (!matrix12) return true;
+    std::copy(matrix12, matrix12 + 12, place.m);
+    // Rigid only (RᵀR = I, det R = +1): the mesh pads assume distances are preserved,
+    // and a scale test alone lets shears and reflections through.
+    const double* m = place.m;
+    for (int i = 0; i < 3; i++) {
+        for (int j = i; j < 3; j++) {
+            const double dot = m[i] * m[j] + m[4 + i] * m[4 + j] + m[8 + i] * m[8 + j];
+            if (std::abs(dot - (i == j ? 1.0 : 0.0)) > 1e-9) return false;
+        }
+    }
+    const double det = m[0] * (m[5] * m[10] - m[6] * m[9])
+                     - m[1] * (m[4] * m[10] - m[6] * m[8])
+                     + m[2] * (m[4] * m[9] - m[5] * m[8]);
+    return std::abs(det - 1.0) < 1e-9;
+}
+
+OCCTDistanceEngineRef OCCTDistanceEngineCreate(OCCTShapeRef shape1, OCCTShapeRef shape2, double deflection) {
+    if (!shape1 || !shape2 || shape1->shape.IsNull() || shape2->shape.IsNull()) return nullptr;
+    try {
+        auto* eng = new OCCTDistanceEngine();
+        OCCTShapeRef refs[2] = { shape1, shape2 };
+        double pads[2] = { 0, 0 };
+        for (int s = 0; s < 2; s++) {
+            eng->shapes[s] = refs[s]->shape;
+            Bnd_Box box;
+            BRepBndLib::Add(eng->shapes[s], box, Standard_False);
+            if (box.IsVoid()) { delete eng; return nullptr; }
+            const double d = deflection > 0 ? deflection : 0.005 * std::sqrt(box.SquareExtent());
+            const TopTools_IndexedMapOfShape& faceMap = refs[s]->subShapes(TopAbs_FACE);
+            for (int32_t f = 1; f <= faceMap.Extent(); f++) {
+                const TopoDS_Face& face = TopoDS::Face(faceMap(f));
+                eng->faces[s].push_back(face);
+                Bnd_Box fb;
+                BRepBndLib::Add(face, fb, Standard_False);
+                eng->faceBoxes[s].push_back(fb);
+            }
+            if (!pxMeshIntoBVH(eng->shapes[s], faceMap, d, eng->bvh[s], pads[s])) { delete eng; return nullptr; }
+        }
+        eng->pad = pads[0] + pads[1];
+        return eng;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTDistanceEngineRelease(OCCTDistanceEngineRef engine) {
+    delete engine;
+}
+
+bool OCCTDistanceEngineCompute(OCCTDistanceEngineRef engine, const double* matrix12,
+                               OCCTDistanceResult* outResult) {
+    if (!engine || !outResult) return false;
+    try {
+        PXPlacement place;
+        if (!pxPlacementFrom(matrix12, place)) return false;
+        *outResult = OCCTDistanceResult();
+        outResult->distance = -1;
+        return pxEngineQuery(*engine, place, 0, outResult, nullptr);
+    } catch (...) {
+        return false;
+    }
+}
+
+int32_t OCCTDistanceEngineIsCloserThan(OCCTDistanceEngineRef engine, const double* matrix12, double threshold) {
+    if (!engine || !(threshold > 0)) return -1;
+    try {
+        PXPlacement place;
+        if (!pxPlacementFrom(matrix12, place)) return -1;
+        int32_t closer = -1;
+        return pxEngineQuery(*engine, place, threshold, nullptr, &closer) ? closer : -1;
+    } catch (...) {
+        return -1;
+    }
+}
+
+int32_t OCCTDistanceEngineComputeBatch(OCCTDistanceEngineRef engine, const double* matrices, int32_t count,
+                                       double* outDistances, bool parallel) {
+    if (!engine || !matrices || !outDistances || count < 0) return -1;
+    std::atomic<int32_t> done{0};
+    occtParallelChunks(count, [&](int32_t begin, int32_t end) {
+        int32_t nbDone = 0;
+        for (int32_t i = begin; i < end; i++) {
+            outDistances[i] = -1;
+            try {
+                PXPlacement place;
+                OCCTDistanceResult r;
+                if (!pxPlacementFrom(&matrices[12 * i], place)) continue;
+                if (!pxEngineQuery(*engine, place, 0, &r, nullptr)) continue;
+                outDistances[i] = r.distance;
+                nbDone++;
+            } catch (...) {}
+        }
+        done += nbDone;
+    }, parallel);
+    return done.load();
+}
+
+OCCTDistanceEngineStats OCCTDistanceEngineGetStats(OCCTDistanceEngineRef engine) {
+    OCCTDistanceEngineStats stats = {};
+    if (!engine) return stats;
+    stats.queries = engine->queries.load();
+    stats.decidedByMesh = engine->decidedByMesh.load();
+    stats.exactFacePairs = engine->exactFacePairs.load();
+    return stats;
+}
+
+// MARK: - Preview Mesh Boolean
+
+enum PBState { PB_OUT = 0, PB_IN = 1, PB_SAME = 2, PB_OPPOSITE = 3 };
+
+// One meshed solid: outward-wound triangles with their faces in a BVH, a unit normal per
+// triangle, and a +Z ray-parity grid over the same triangles.
+struct PBOperand {
+    PXTriangleBVH bvh;
+    std::vector<double> normals;
+    OCCTSolidClassifier parity;
+    double lo[3], hi[3];
+    int32_t faceCount = 0;
+};
+
+struct OCCTPreviewBoolean {
+    PBOperand operand[2];                  // object, tool (in its own frame)
+    std::atomic<int64_t> queries{0};
+    std::atomic<int64_t> culled{0};
+    std::atomic<int64_t> classified{0};
+    std::atomic<int64_t> split{0};
+};
+
+static bool pbBuildOperand(OCCTShapeRef shape, double deflection, PBOperand& op) {
+    Bnd_Box box;
+    BRepBndLib::Add(shape->shape, box, Standard_False);
+    if (box.IsVoid()) return false;
+    const double diag = std::sqrt(box.SquareExtent());
+    const double d = deflection > 0 ? deflection : 0.005 * diag;
+    BRepMesh_IncrementalMesh mesher(shape->shape, d, Standard_False, 0.5, Standard_True);
+    if (!pxIsClosed(shape->shape)) return false;
+
+    const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
+    op.faceCount = faceMap.Extent();
+    std::vector<double>& tris = op.bvh.tris;
+    for (int32_t f = 1; f <= faceMap.Extent(); f++) {
+        const TopoDS_Face& face = TopoDS::Face(faceMap(f));
+        const size_t first = tris.size();
+        if (!pxAppendFaceTriangles(face, tris)) return false;
+        if (face.Orientation() == TopAbs_REVERSED) {
+            for (size_t k = first; k < tris.size(); k += 9) std::swap_ranges(&tris[k + 3], &tris[k + 6], &tris[k + 6]);
+        }
+        op.bvh.triFace.resize(tris.size() / 9, f - 1);
+    }
+    const int32_t nbTris = (int32_t)op.bvh.triFace.size();
+    if (nbTris == 0) return false;
+
+    op.normals.resize(3 * (size_t)nbTris);
+    for (int a = 0; a < 3; a++) { op.lo[a] = 1e300; op.hi[a] = -1e300; }
+    for (int32_t t = 0; t < nbTris; t++) {
+        const double* v = &tris[9 * t];
+        gp_XYZ n = gp_XYZ(v[3] - v[0], v[4] - v[1], v[5] - v[2]).Crossed(gp_XYZ(v[6] - v[0], v[7] - v[1], v[8] - v[2]));
+        const double mag = n.Modulus();
+        if (mag > 0) n /= mag;
+        op.normals[3 * t] = n.X(); op.normals[3 * t + 1] = n.Y(); op.normals[3 * t + 2] = n.Z();
+        for (int c = 0; c < 3; c++) {
+            for (int a = 0; a < 3; a++) {
+                op.lo[a] = std::min(op.lo[a], v[3 * c + a]);
+                op.hi[a] = std::max(op.hi[a], v[3 * c + a]);
+            }
+        }
+    }
+    // The parity test runs against this mesh itself, so the band only absorbs round-off.
+    op.parity.tris = tris;
+    op.parity.band = std::max(Precision::Confusion(), 1e-9 * diag);
+    scBuildGrid(op.parity);
+    op.parity.hasMesh = true;
+    pxBuildBVH(op.bvh);
+    return true;
+}
+
+static int32_t pbNearest(const PXTriangleBVH& bvh, const double p[3], double& best2) {
+    best2 = 1e300;
+    int32_t bestT = -1;
+    std::vector<int32_t>& stack = pxWalkStack();
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const PXBVHNode& n = bvh.nodes[stack.back()];
+        stack.pop_back();
+        if (pxBoxDist2(n, p) >= best2) continue;
+        if (n.count > 0) {
+            for (int32_t k = n.start; k < n.start + n.count; k++) {
+                const int32_t t = bvh.order[k];
+                const double d2 = vxDist2PointTriangle(p, &bvh.tris[9 * t]);
+                if (d2 < best2) { best2 = d2; bestT = t; }
+            }
+            continue;
+        }
+        const bool leftFirst = pxBoxDist2(bvh.nodes[n.left], p) <= pxBoxDist2(bvh.nodes[n.right], p);
+        stack.push_back(leftFirst ? n.right : n.left);
+        stack.push_back(leftFirst ? n.left : n.right);
+    }
+    return bestT;
+}
+
+// Triangles of `bvh` whose box overlaps [lo, hi].
+static void pbOverlapping(const PXTriangleBVH& bvh, const double lo[3], const double hi[3],
+                          std::vector<int32_t>& out) {
+    out.clear();
+    std::vector<int32_t>& stack = pxWalkStack();
+    stack.push_back(0);
+    while (!stack.empty()) {
+        const PXBVHNode& n = bvh.nodes[stack.back()];
+        stack.pop_back();
+        if (n.lo[0] > hi[0] || n.hi[0] < lo[0] || n.lo[1] > hi[1] || n.hi[1] < lo[1] ||
+            n.lo[2] > hi[2] || n.hi[2] < lo[2]) continue;
+        if (n.count > 0) {
+            for (int32_t k = n.start; k < n.start + n.count; k++) out.push_back(bvh.order[k]);
+            continue;
+        }
+        stack.push_back(n.right);
+        stack.push_back(n.left);
+    }
+}
+
+// State of point p against X (both in X's frame). `n` is the unit normal of the surface
+// p lies on, used to tell coincident faces apart.
+static PBState pbClassifyPoint(const PBOperand& X, const double p[3], const double n[3]) {
+    const double band = X.parity.band;
+    for (int a = 0; a < 3; a++) {
+        if (p[a] < X.lo[a] - band || p[a] > X.hi[a] + band) return PB_OUT;
+    }
+    const int32_t r = scMeshParity(X.parity, gp_Pnt(p[0], p[1], p[2]));
+    if (r == (int32_t)TopAbs_IN) return PB_IN;
+    if (r == (int32_t)TopAbs_OUT) return PB_OUT;
+    // On the surface, or the ray grazed a mesh edge: the nearest triangle decides.
+    double d2;
+    const int32_t t = pbNearest(X.bvh, p, d2);
+    if (t < 0) return PB_OUT;
+    const double* m = &X.normals[3 * t];
+    if (d2 <= band * band) return n[0] * m[0] + n[1] * m[1] + n[2] * m[2] >= 0 ? PB_SAME : PB_OPPOSITE;
+    const double* v = &X.bvh.tris[9 * t];
+    const double side = (p[0] - v[0]) * m[0] + (p[1] - v[1]) * m[1] + (p[2] - v[2]) * m[2];
+    return side < 0 ? PB_IN : PB_OUT;
+}
+
+static bool pbTrianglesCross(const double* a, const double* b) {
+    const gp_XYZ A[3] = { gp_XYZ(a[0], a[1], a[2]), gp_XYZ(a[3], a[4], a[5]), gp_XYZ(a[6], a[7], a[8]) };
+    const gp_XYZ B[3] = { gp_XYZ(b[0], b[1], b[2]), gp_XYZ(b[3], b[4], b[5]), gp_XYZ(b[6], b[7], b[8]) };
+    for (int i = 0; i < 3; i++) {
+        if (pxSegmentHitsTriangle(A[i], A[(i + 1) % 3], b)) return true;
+        if (pxSegmentHitsTriangle(B[i], B[(i + 1) % 3], a)) return true;
+    }
+    return false;
+}
+
+static PXPlacement pbInverse(const PXPlacement& p) {
+    PXPlacement inv;
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) inv.m[4 * r + c] = p.m[4 * c + r];
+        inv.m[4 * r + 3] = -(p.m[r] * p.m[3] + p.m[4 + r] * p.m[7] + p.m[8 + r] * p.m[11]);
+    }
+    return inv;
+}
+
+// One side of a query: triangles of `self` classified against `other`.
+struct PBPass {
+    const PBOperand& self;
+    const PBOperand& other;
+    PXPlacement toOther, toWorld;
+    uint32_t keep;                         // bit per PBState
+    bool flip;
+    int32_t faceOffset;
+    int32_t refinement;
+};
+
+struct PBOutput {
+    std::vector<double> tris;              // 9 doubles per triangle, world frame
+    std::vector<int32_t> faces;
+    int64_t culled = 0, classified = 0, split = 0;
+};
+
+static void pbEmit(const PBPass& pass, const double* v, int32_t face, PBOutput& out) {
+    const int order[2][3] = { { 0, 1, 2 }, { 0, 2, 1 } };
+    for (int c : order[pass.flip ? 1 : 0]) {
+        double w[3];
+        pass.toWorld.apply(&v[3 * c], w);
+        out.tris.insert(out.tris.end(), w, w + 3);
+    }
+    out.faces.push_back(pass.faceOffset + face);
+}
+
+// Triangle v (self frame) with unit normal n (other frame); `cands` are the other's
+// triangles near it. Crossing triangles are split until `depth` runs out.
+static void pbRefine(const PBPass& pass, const double* v, const double* n, int32_t face,
+                     const std::vector<int32_t>& cands, int32_t depth, PBOutput& out) {
+    double w[9];
+    for (int c = 0; c < 3; c++) pass.toOther.apply(&v[3 * c], &w[3 * c]);
+    bool crosses = false;
+    if (depth > 0) {
+        for (int32_t t : cands) {
+            if (pbTrianglesCross(w, &pass.other.bvh.tris[9 * t])) { crosses = true; break; }
+        }
+    }
+    if (crosses) {
+        double m[9];
+        for (int a = 0; a < 3; a++) {
+            m[a] = 0.5 * (v[a] + v[3 + a]);
+            m[3 + a] = 0.5 * (v[3 + a] + v[6 + a]);
+            m[6 + a] = 0.5 * (v[6 + a] + v[a]);
+        }
+        const double kids[4][9] = {
+            { v[0], v[1], v[2], m[0], m[1], m[2], m[6], m[7], m[8] },
+            { m[0], m[1], m[2], v[3], v[4], v[5], m[3], m[4], m[5] },
+            { m[6], m[7], m[8], m[3], m[4], m[5], v[6], v[7], v[8] },
+            { m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8] },
+        };
+        for (const auto& kid : kids) pbRefine(pass, kid, n, face, cands, depth - 1, out);
+        return;
+    }
+    const double c[3] = { (w[0] + w[3] + w[6]) / 3.0, (w[1] + w[4] + w[7]) / 3.0, (w[2] + w[5] + w[8]) / 3.0 };
+    if (pass.keep & (1u << pbClassifyPoint(pass.other, c, n))) pbEmit(pass, v, face, out);
+}
+
+static void pbRunTriangle(const PBPass& pass, int32_t t, std::vector<int32_t>& cands, PBOutput& out) {
+    const double* v = &pass.self.bvh.tris[9 * t];
+    const int32_t face = pass.self.bvh.triFace[t];
+    double n[3];
+    {
+        const double* sn = &pass.self.normals[3 * t];
+        const double* m = pass.toOther.m;
+        for (int r = 0; r < 3; r++) n[r] = m[4 * r] * sn[0] + m[4 * r + 1] * sn[1] + m[4 * r + 2] * sn[2];
+    }
+    double w[9], lo[3] = { 1e300, 1e300, 1e300 }, hi[3] = { -1e300, -1e300, -1e300 };
+    for (int c = 0; c < 3; c++) {
+        pass.toOther.apply(&v[3 * c], &w[3 * c]);
+        for (int a = 0; a < 3; a++) {
+            lo[a] = std::min(lo[a], w[3 * c + a] - pass.other.parity.band);
+            hi[a] = std::max(hi[a], w[3 * c + a] + pass.other.parity.band);
+        }
+    }
+    const bool disjoint = lo[0] > pass.other.hi[0] || hi[0] < pass.other.lo[0] ||
+                          lo[1] > pass.other.hi[1] || hi[1] < pass.other.lo[1] ||
+                          lo[2] > pass.other.hi[2] || hi[2] < pass.other.lo[2];
+    if (disjoint) {
+        out.culled++;
+        if (pass.keep & (1u << PB_OUT)) pbEmit(pass, v, face, out);
+        return;
+    }
+    pbOverlapping(pass.other.bvh, lo, hi, cands);
+    bool crosses = false;
+    for (int32_t o : cands) {
+        if (pbTrianglesCross(w, &pass.other.bvh.tris[9 * o])) { crosses = true; break; }
+    }
+    if (crosses && pass.refinement > 0) {
+        out.split++;
+        pbRefine(pass, v, n, face, cands, pass.refinement, out);
+        return;
+    }
+    out.classified++;
+    const double c[3] = { (w[0] + w[3] + w[6]) / 3.0, (w[1] + w[4] + w[7]) / 3.0, (w[2] + w[5] + w[8]) / 3.0 };
+    if (pass.keep & (1u << pbClassifyPoint(pass.other, c, n))) pbEmit(pass, v, face, out);
+}
+
+OCCTPreviewBooleanRef OCCTPreviewBooleanCreate(OCCTShapeRef object, OCCTShapeRef tool, double deflection) {
+    if (!object || !tool || object->shape.IsNull() || tool->shape.IsNull()) return nullptr;
+    try {
+        auto* eng = new OCCTPreviewBoolean();
+        if (!pbBuildOperand(object, deflection, eng->operand[0]) ||
+            !pbBuildOperand(tool, deflection, eng->operand[1])) {
+            delete eng;
+            return nullptr;
+        }
+        return eng;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTPreviewBooleanRelease(OCCTPreviewBooleanRef engine) {
+    delete engine;
+}
+
+int32_t OCCTPreviewBooleanObjectFaceCount(OCCTPreviewBooleanRef engine) {
+    return engine ? engine->operand[0].faceCount : 0;
+}
+
+OCCTMeshRef OCCTPreviewBooleanCompute(OCCTPreviewBooleanRef engine, OCCTBooleanOp op,
+                                      const double* matrix12, int32_t refinement, bool parallel) {
+    if (!engine) return nullptr;
+    // Kept states (bit per PBState) for the object and the tool, and which side is flipped.
+    uint32_t keepObject, keepTool;
+    bool flipObject = false, flipTool = false;
+    // Coincident faces: same-facing ones are kept once (from the object) for fuse/common;
+    // opposite-facing ones survive a cut on the side that is being cut.
+    const uint32_t kOut = 1u << PB_OUT, kIn = 1u << PB_IN, kSame = 1u << PB_SAME, kOpp = 1u << PB_OPPOSITE;
+    switch (op) {
+        case OCCTBooleanOpFuse:        keepObject = kOut | kSame; keepTool = kOut; break;
+        case OCCTBooleanOpCommon:      keepObject = kIn | kSame;  keepTool = kIn;  break;
+        case OCCTBooleanOpCut:         keepObject = kOut | kOpp;  keepTool = kIn;  flipTool = true; break;
+        case OCCTBooleanOpCutReversed: keepObject = kIn;  keepTool = kOut | kOpp;  flipObject = true; break;
+        default: return nullptr;
+    }
+    try {
+        PXPlacement place;
+        if (!pxPlacementFrom(matrix12, place)) return nullptr;
+        const PBOperand& A = engine->operand[0];
+        const PBOperand& B = engine->operand[1];
+        const int32_t depth = std::max(0, std::min(4, refinement));
+        const PBPass passes[2] = {
+            { A, B, pbInverse(place), PXPlacement(), keepObject, flipObject, 0, depth },
+            { B, A, place, place, keepTool, flipTool, A.faceCount, depth },
+        };
+        const int32_t nbA = (int32_t)A.bvh.triFace.size();
+        const int32_t nbB = (int32_t)B.bvh.triFace.size();
+
+        // Chunks finish in any order; keyed by their first triangle, they are stitched
+        // back in triangle order so the result doesn't depend on scheduling.
+        std::mutex outMutex;
+        std::vector<std::pair<int32_t, PBOutput>> chunks;
+        occtParallelChunks(nbA + nbB, [&](int32_t begin, int32_t end) {
+            PBOutput out;
+            std::vector<int32_t> cands;
+            for (int32_t i = begin; i < end; i++) {
+                if (i < nbA) pbRunTriangle(passes[0], i, cands, out);
+                else pbRunTriangle(passes[1], i - nbA, cands, out);
+            }
+            std::lock_guard<std::mutex> lock(outMutex);
+            chunks.emplace_back(begin, std::move(out));
+        }, parallel);
+        std::sort(chunks.begin(), chunks.end(),
+                  [](const auto& x, const auto& y) { return x.first < y.first; });
+
+        auto* mesh = new OCCTMesh();
+        int64_t culled = 0, classified = 0, split = 0;
+        for (const auto& [begin, out] : chunks) {
+            culled += out.culled;
+            classified += out.classified;
+            split += out.split;
+            for (size_t t = 0; t < out.faces.size(); t++) {
+                const double* v = &out.tris[9 * t];
+                gp_XYZ n = gp_XYZ(v[3] - v[0], v[4] - v[1], v[5] - v[2]).Crossed(gp_XYZ(v[6] - v[0], v[7] - v[1], v[8] - v[2]));
+                if (n.Modulus() > 1e-300) n.Normalize();
+                const uint32_t base = (uint32_t)(mesh->vertices.size() / 3);
+                for (int c = 0; c < 3; c++) {
+                    for (int a = 0; a < 3; a++) {
+                        mesh->vertices.push_back((float)v[3 * c + a]);
+                        mesh->normals.push_back((float)n.Coord(a + 1));
+                    }
+                    mesh->indices.push_back(base + c);
+                }
+                mesh->faceIndices.push_back(out.faces[t]);
+                for (int a = 1; a <= 3; a++) mesh->triangleNormals.push_back((float)n.Coord(a));
+            }
+        }
+        engine->queries++;
+        engine->culled += culled;
+        engine->classified += classified;
+        engine->split += split;
+        return mesh;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OCCTPreviewBooleanStats OCCTPreviewBooleanGetStats(OCCTPreviewBooleanRef engine) {
+    OCCTPreviewBooleanStats stats = {};
+    if (!engine) return stats;
+    stats.queries = engine->queries.load();
+    stats.trianglesCulled = engine->culled.load();
+    stats.trianglesClassified = engine->classified.load();
+    stats.trianglesSplit = engine->split.load();
+    return stats;
+}
@@ -176,6 +176,206 @@ int32_t OCCTKDTreeBoxSearch(OCCTKDTreeRef tree,
         return 0;
     }
 }
+
+// MARK: - Point-Cloud Processing (KD-tree normals, curvature, downsampling, outliers)
+
+#include <gp.hxx>
+#include <math_Jacobi.hxx>
+#include <math_Matrix.hxx>
+#include <math_Vector.hxx>
+#include <unordered_map>
+
+// PCA of one kNN neighbourhood. `nbrs` holds 1-based tree indices (NCollection_KDTree
+// convention). Returns false for fewer than 3 neighbours or a degenerate covariance.
+static bool kdPcaNormal(const std::vector<gp_Pnt>& pts,
+                        const NCollection_Array1<size_t>& nbrs, size_t n,
+                        gp_XYZ& outNormal, double& outCurvature) {
+    if (n < 3) return false;
+    gp_XYZ c(0, 0, 0);
+    for (size_t i = 1; i <= n; i++) c += pts[nbrs.Value((int)i) - 1].XYZ();
+    c /= (double)n;
+
+    math_Matrix cov(1, 3, 1, 3, 0.0);
+    for (size_t i = 1; i <= n; i++) {
+        const gp_XYZ d = pts[nbrs.Value((int)i) - 1].XYZ() - c;
+        for (int r = 1; r <= 3; r++)
+            for (int s = r; s <= 3; s++)
+                cov(r, s) += d.Coord(r) * d.Coord(s);
+    }
+    for (int r = 1; r <= 3; r++)
+        for (int s = 1; s < r; s++)
+            cov(r, s) = cov(s, r);
+
+    math_Jacobi jacobi(cov);
+    if (!jacobi.IsDone()) return false;
+    int iMin = 1;
+    for (int i = 2; i <= 3; i++) if (jacobi.Value(i) < jacobi.Value(iMin)) iMin = i;
+    math_Vector v(1, 3);
+    jacobi.Vector(iMin, v);
+    gp_XYZ nrm(v(1), v(2), v(3));
+    const double mod = nrm.Modulus();
+    if (mod < gp::Resolution()) return false;
+    outNormal = nrm / mod;
+
+    const double trace = jacobi.Value(1) + jacobi.Value(2) + jacobi.Value(3);
+    outCurvature = trace > gp::Resolution() ? std::max(0.0, jacobi.Value(iMin)) / trace : 0.0;
+    return true;
+}
+
+int32_t OCCTKDTreeEstimateNormals(OCCTKDTreeRef tree, int32_t k,
+                                  const double* viewpoint,
+                                  float* outNormals, float* outCurvature) {
+    if (!tree || !outNormals || k < 3 || tree->tree.IsEmpty()) return -1;
+    const int32_t count = (int32_t)tree->points.size();
+    const bool orient = viewpoint != nullptr;
+    const gp_XYZ eye = orient ? gp_XYZ(viewpoint[0], viewpoint[1], viewpoint[2]) : gp_XYZ();
+    std::vector<uint8_t> ok(count, 0);
+
+    occtParallelChunks(count, [&](int32_t begin, int32_t end) {
+        // Per-chunk scratch: reused for every query in the range.
+        NCollection_Array1<size_t> indices(1, k);
+        NCollection_Array1<double> distances(1, k);
+        for (int32_t i = begin; i < end; i++) {
+            gp_XYZ nrm(0, 0, 0);
+            double curv = -1.0;
+            try {
+                const size_t found = tree->tree.KNearestPoints(tree->points[i], (size_t)k,
+                                                               indices, distances);
+                if (kdPcaNormal(tree->points, indices, found, nrm, curv)) {
+                    if (orient && nrm.Dot(eye - tree->points[i].XYZ()) < 0) nrm.Reverse();
+                    ok[i] = 1;
+                } else {
+                    nrm.SetCoord(0, 0, 0);
+                    curv = -1.0;
+                }
+            } catch (...) {
+                nrm.SetCoord(0, 0, 0);
+                curv = -1.0;
+            }
+            outNormals[i*3]   = (float)nrm.X();
+            outNormals[i*3+1] = (float)nrm.Y();
+            outNormals[i*3+2] = (float)nrm.Z();
+            if (outCurvature) outCurvature[i] = (float)curv;
+        }
+    });
+
+    int32_t valid = 0;
+    for (uint8_t b : ok) valid += b;
+    return valid;
+}
+
+int32_t OCCTKDTreeStatisticalOutliers(OCCTKDTreeRef tree, int32_t k, double stdRatio,
+                                      uint8_t* outInlierMask) {
+    if (!tree || !outInlierMask || k < 1 || stdRatio < 0 || tree->tree.IsEmpty()) return -1;
+    const int32_t count = (int32_t)tree->points.size();
+    // k + 1 because the query point is its own nearest neighbour at distance 0.
+    const int32_t kq = k + 1;
+    std::vector<double> meanDist(count, -1.0);
+
+    occtParallelChunks(count, [&](int32_t begin, int32_t end) {
+        NCollection_Array1<size_t> indices(1, kq);
+        NCollection_Array1<double> distances(1, kq);
+        for (int32_t i = begin; i < end; i++) {
+            try {
+                const size_t found = tree->tree.KNearestPoints(tree->points[i], (size_t)kq,
+                                                               indices, distances);
+                double sum = 0;
+                int32_t n = 0;
+                for (size_t j = 1; j <= found; j++) {
+                    if (indices.Value((int)j) - 1 == (size_t)i) continue;
+                    sum += std::sqrt(distances.Value((int)j));
+                    n++;
+                }
+                if (n > 0) meanDist[i] = sum / n;
+            } catch (...) {}
+        }
+    });
+
+    double sum = 0, sumSq = 0;
+    int32_t n = 0;
+    for (double d : meanDist) {
+        if (d < 0) continue;
+        sum += d; sumSq += d * d; n++;
+    }
+    if (n == 0) {
+        std::fill(outInlierMask, outInlierMask + count, (uint8_t)0);
+        return 0;
+    }
+    const double mean = sum / n;
+    const double stddev = std::sqrt(std::max(0.0, sumSq / n - mean * mean));
+    const double limit = mean + stdRatio * stddev;
+
+    int32_t inliers = 0;
+    for (int32_t i = 0; i < count; i++) {
+        const bool in = meanDist[i] >= 0 && meanDist[i] <= limit;
+        outInlierMask[i] = in ? 1 : 0;
+        inliers += in ? 1 : 0;
+    }
+    return inliers;
+}
+
+namespace {
+struct VoxelKey {
+    int64_t x, y, z;
+    bool operator==(const VoxelKey& o) const { return x == o.x && y == o.y && z == o.z; }
+};
+struct VoxelKeyHash {
+    size_t operator()(const VoxelKey& k) const {
+        // Large primes (Teschner et al. spatial hash).
+        return (size_t)((k.x * 73856093) ^ (k.y * 19349663) ^ (k.z * 83492791));
+    }
+};
+}
+
+int32_t OCCTPointSetVoxelDownsample(const double* coords, int32_t count, double voxelSize,
+                                    float* outCoords, int32_t* outVoxelOfPoint) {
+    if (!coords || count <= 0 || !outCoords || !(voxelSize > 0)) return -1;
+    try {
+        double minX = coords[0], minY = coords[1], minZ = coords[2];
+        for (int32_t i = 1; i < count; i++) {
+            minX = std::min(minX, coords[i*3]);
+            minY = std::min(minY, coords[i*3+1]);
+            minZ = std::min(minZ, coords[i*3+2]);
+        }
+        const double inv = 1.0 / voxelSize;
+
+        std::unordered_map<VoxelKey, int32_t, VoxelKeyHash> voxelIndex;
+        voxelIndex.reserve((size_t)count);
+        std::vector<gp_XYZ> sums;
+        std::vector<int32_t> counts;
+        for (int32_t i = 0; i < count; i++) {
+            const gp_XYZ p(coords[i*3], coords[i*3+1], coords[i*3+2]);
+            const VoxelKey key{ (int64_t)std::floor((p.X() - minX) * inv),
+                                (int64_t)std::floor((p.Y() - minY) * inv),
+                                (int64_t)std::floor((p.Z() - minZ) * inv) };
+            auto it = voxelIndex.find(key);
+            int32_t v;
+            if (it == voxelIndex.end()) {
+                v = (int32_t)sums.size();
+                voxelIndex.emplace(key, v);
+                sums.push_back(p);
+                counts.push_back(1);
+            } else {
+                v = it->second;
+                sums[v] += p;
+                counts[v]++;
+            }
+            if (outVoxelOfPoint) outVoxelOfPoint[i] = v;
+        }
+
+        const int32_t nbVoxels = (int32_t)sums.size();
+        for (int32_t v = 0; v < nbVoxels; v++) {
+            const gp_XYZ c = sums[v] / (double)counts[v];
+            outCoords[v*3]   = (float)c.X();
+            outCoords[v*3+1] = (float)c.Y();
+            outCoords[v*3+2] = (float)c.Z();
+        }
+        return nbVoxels;
+    } catch (...) {
+        return -1;
+    }
+}
+
 // MARK: - Polynomial Solvers (v0.29.0)
 
 #include <math_DirectPolynomialRoots.hxx>
@@ -2496,8 +2696,7 @@ int32_t OCCTShapeRaycast(
     
     try {
         // Build face index map for looking up face indices
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         
         // Create ray
         gp_Pnt origin(originX, originY, originZ);
@@ -2560,3 +2759,673 @@ int32_t OCCTShapeRaycast(
     }
 }
 
+
+// MARK: - Dynamic AABB Tree (broad-phase box queries)
+//
+// Classic dynamic bounding-volume tree (surface-area-heuristic insertion + AVL-style
+// rotations, as in Box2D's b2DynamicTree). Nodes live in one vector and are linked by
+// index; freed nodes are chained through `parent`. Leaves hold a fat box; the tight box
+// of each proxy is kept separately so queries report exact box overlaps.
+
+#include <BRepBndLib.hxx>
+#include <Bnd_Box.hxx>
+#include <array>
+
+typedef std::array<double, 6> OCCTAABB;
+
+struct OCCTAABBTree {
+    struct Node {
+        OCCTAABB box;           // fat box for leaves, union of children otherwise
+        int32_t parent = -1;    // next free node when on the free list
+        int32_t child1 = -1;
+        int32_t child2 = -1;
+        int32_t height = -1;    // 0 = leaf, -1 = free
+        int32_t proxy = -1;     // leaves only
+        bool isLeaf() const { return child1 < 0; }
+    };
+
+    std::vector<Node> nodes;
+    int32_t root = -1;
+    int32_t freeList = -1;
+    double margin = 0;
+
+    std::vector<int32_t> proxyNode;   // proxy → leaf node, -1 when not live
+    std::vector<OCCTAABB> tight;      // proxy → tight box
+    std::vector<int32_t> freeProxies;
+    int32_t liveCount = 0;
+
+    // CSR cache from OCCTAABBTreeComputePairs; invalidated by every edit.
+    bool pairsValid = false;
+    std::vector<int32_t> pairOffsets;
+    std::vector<int32_t> pairPartners;
+};
+
+static bool aabbValid(const double* b) {
+    for (int i = 0; i < 6; i++) if (!std::isfinite(b[i])) return false;
+    return b[0] <= b[3] && b[1] <= b[4] && b[2] <= b[5];
+}
+
+static OCCTAABB aabbUnion(const OCCTAABB& a, const OCCTAABB& b) {
+    return { std::min(a[0], b[0]), std::min(a[1], b[1]), std::min(a[2], b[2]),
+             std::max(a[3], b[3]), std::max(a[4], b[4]), std::max(a[5], b[5]) };
+}
+
+// Surface area (the SAH cost metric).
+static double aabbArea(const OCCTAABB& b) {
+    const double dx = b[3] - b[0], dy = b[4] - b[1], dz = b[5] - b[2];
+    return 2.0 * (dx * dy + dy * dz + dz * dx);
+}
+
+static bool aabbOverlap(const OCCTAABB& a, const OCCTAABB& b) {
+    return a[0] <= b[3] && b[0] <= a[3] &&
+           a[1] <= b[4] && b[1] <= a[4] &&
+           a[2] <= b[5] && b[2] <= a[5];
+}
+
+static bool aabbContains(const OCCTAABB& outer, const OCCTAABB& inner) {
+    return outer[0] <= inner[0] && outer[1] <= inner[1] && outer[2] <= inner[2] &&
+           outer[3] >= inner[3] && outer[4] >= inner[4] && outer[5] >= inner[5];
+}
+
+// Slab test of the segment o + t·d, t ∈ [0, tMax]. Writes the entry parameter.
+static bool aabbRay(const OCCTAABB& b, const double o[3], const double d[3],
+                    double tMax, double& tEnter) {
+    double t0 = 0.0, t1 = tMax;
+    for (int k = 0; k < 3; k++) {
+        if (std::abs(d[k]) < 1e-300) {
+            if (o[k] < b[k] || o[k] > b[k + 3]) return false;
+            continue;
+        }
+        const double inv = 1.0 / d[k];
+        double tn = (b[k] - o[k]) * inv;
+        double tf = (b[k + 3] - o[k]) * inv;
+        if (tn > tf) std::swap(tn, tf);
+        t0 = std::max(t0, tn);
+        t1 = std::min(t1, tf);
+        if (t0 > t1) return false;
+    }
+    tEnter = t0;
+    return true;
+}
+
+static int32_t aabbAllocateNode(OCCTAABBTree& t) {
+    if (t.freeList < 0) {
+        t.nodes.emplace_back();
+        return (int32_t)t.nodes.size() - 1;
+    }
+    const int32_t id = t.freeList;
+    t.freeList = t.nodes[id].parent;
+    t.nodes[id] = OCCTAABBTree::Node();
+    return id;
+}
+
+static void aabbFreeNode(OCCTAABBTree& t, int32_t id) {
+    t.nodes[id].parent = t.freeList;
+    t.nodes[id].height = -1;
+    t.freeList = id;
+}
+
+// Single left/right rotation at iA when its children's heights differ by more than 1.
+// Returns the index of the new subtree root.
+static int32_t aabbBalance(OCCTAABBTree& t, int32_t iA) {
+    auto& n = t.nodes;
+    if (n[iA].isLeaf() || n[iA].height < 2) return iA;
+
+    const int32_t iB = n[iA].child1;
+    const int32_t iC = n[iA].child2;
+    const int32_t balance = n[iC].height - n[iB].height;
+
+    auto relinkParent = [&](int32_t oldChild, int32_t newChild) {
+        const int32_t p = n[newChild].parent;
+        if (p < 0) { t.root = newChild; return; }
+        if (n[p].child1 == oldChild) n[p].child1 = newChild;
+        else n[p].child2 = newChild;
+    };
+
+    if (balance > 1) {          // rotate C up
+        const int32_t iF = n[iC].child1;
+        const int32_t iG = n[iC].child2;
+        n[iC].child1 = iA;
+        n[iC].parent = n[iA].parent;
+        n[iA].parent = iC;
+        relinkParent(iA, iC);
+        const bool keepF = n[iF].height > n[iG].height;
+        const int32_t up = keepF ? iF : iG;     // stays under C
+        const int32_t down = keepF ? iG : iF;   // moves under A
+        n[iC].child2 = up;
+        n[iA].child2 = down;
+        n[down].parent = iA;
+        n[iA].box = aabbUnion(n[iB].box, n[down].box);
+        n[iC].box = aabbUnion(n[iA].box, n[up].box);
+        n[iA].height = 1 + std::max(n[iB].height, n[down].height);
+        n[iC].height = 1 + std::max(n[iA].height, n[up].height);
+        return iC;
+    }
+    if (balance < -1) {         // rotate B up
+        const int32_t iD = n[iB].child1;
+        const int32_t iE = n[iB].child2;
+        n[iB].child1 = iA;
+        n[iB].parent = n[iA].parent;
+        n[iA].parent = iB;
+        relinkParent(iA, iB);
+        const bool keepD = n[iD].height > n[iE].height;
+        const int32_t up = keepD ? iD : iE;
+        const int32_t down = keepD ? iE : iD;
+        n[iB].child2 = up;
+        n[iA].child1 = down;
+        n[down].parent = iA;
+        n[iA].box = aabbUnion(n[iC].box, n[down].box);
+        n[iB].box = aabbUnion(n[iA].box, n[up].box);
+        n[iA].height = 1 + std::max(n[iC].height, n[down].height);
+        n[iB].height = 1 + std::max(n[iA].height, n[up].height);
+        return iB;
+    }
+    return iA;
+}
+
+// Refit boxes/heights from `index` to the root, rebalancing on the way.
+static void aabbRefitUp(OCCTAABBTree& t, int32_t index) {
+    while (index >= 0) {
+        index = aabbBalance(t, index);
+        auto& node = t.nodes[index];
+        const auto& c1 = t.nodes[node.child1];
+        const auto& c2 = t.nodes[node.child2];
+        node.height = 1 + std::max(c1.height, c2.height);
+        node.box = aabbUnion(c1.box, c2.box);
+        index = node.parent;
+    }
+}
+
+static void aabbInsertLeaf(OCCTAABBTree& t, int32_t leaf) {
+    if (t.root < 0) {
+        t.root = leaf;
+        t.nodes[leaf].parent = -1;
+        return;
+    }
+
+    // Descend choosing the child with the lowest SAH cost increase.
+    const OCCTAABB leafBox = t.nodes[leaf].box;
+    int32_t index = t.root;
+    while (!t.nodes[index].isLeaf()) {
+        const auto& node = t.nodes[index];
+        const double area = aabbArea(node.box);
+        const double combinedArea = aabbArea(aabbUnion(node.box, leafBox));
+        const double cost = 2.0 * combinedArea;
+        const double inheritance = 2.0 * (combinedArea - area);
+
+        auto childCost = [&](int32_t c) {
+            const auto& child = t.nodes[c];
+            const double merged = aabbArea(aabbUnion(leafBox, child.box));
+            return (child.isLeaf() ? merged : merged - aabbArea(child.box)) + inheritance;
+        };
+        const double cost1 = childCost(node.child1);
+        const double cost2 = childCost(node.child2);
+        if (cost < cost1 && cost < cost2) break;
+        index = cost1 < cost2 ? node.child1 : node.child2;
+    }
+
+    const int32_t sibling = index;
+    const int32_t newParent = aabbAllocateNode(t);   // may reallocate t.nodes
+    const int32_t oldParent = t.nodes[sibling].parent;
+    auto& np = t.nodes[newParent];
+    np.parent = oldParent;
+    np.box = aabbUnion(leafBox, t.nodes[sibling].box);
+    np.height = t.nodes[sibling].height + 1;
+    np.child1 = sibling;
+    np.child2 = leaf;
+    if (oldParent >= 0) {
+        if (t.nodes[oldParent].child1 == sibling) t.nodes[oldParent].child1 = newParent;
+        else t.nodes[oldParent].child2 = newParent;
+    } else {
+        t.root = newParent;
+    }
+    t.nodes[sibling].parent = newParent;
+    t.nodes[leaf].parent = newParent;
+
+    aabbRefitUp(t, t.nodes[leaf].parent);
+}
+
+static void aabbRemoveLeaf(OCCTAABBTree& t, int32_t leaf) {
+    if (leaf == t.root) {
+        t.root = -1;
+        return;
+    }
+    const int32_t parent = t.nodes[leaf].parent;
+    const int32_t grand = t.nodes[parent].parent;
+    const int32_t sibling = t.nodes[parent].child1 == leaf ? t.nodes[parent].child2
+                                                           : t.nodes[parent].child1;
+    if (grand >= 0) {
+        if (t.nodes[grand].child1 == parent) t.nodes[grand].child1 = sibling;
+        else t.nodes[grand].child2 = sibling;
+        t.nodes[sibling].parent = grand;
+        aabbFreeNode(t, parent);
+        aabbRefitUp(t, grand);
+    } else {
+        t.root = sibling;
+        t.nodes[sibling].parent = -1;
+        aabbFreeNode(t, parent);
+    }
+}
+
+static OCCTAABB aabbFatten(const OCCTAABB& b, double m) {
+    return { b[0] - m, b[1] - m, b[2] - m, b[3] + m, b[4] + m, b[5] + m };
+}
+
+// Inserts a proxy with a caller-chosen id (used by the bulk constructors) or the next
+// free id when `proxy < 0`. Returns the proxy id.
+static int32_t aabbInsertProxy(OCCTAABBTree& t, const OCCTAABB& box, int32_t proxy = -1) {
+    if (proxy < 0) {
+        if (!t.freeProxies.empty()) {
+            proxy = t.freeProxies.back();
+            t.freeProxies.pop_back();
+        } else {
+            proxy = (int32_t)t.proxyNode.size();
+        }
+    }
+    if (proxy >= (int32_t)t.proxyNode.size()) {
+        t.proxyNode.resize(proxy + 1, -1);
+        t.tight.resize(proxy + 1);
+    }
+    const int32_t leaf = aabbAllocateNode(t);
+    t.nodes[leaf].box = aabbFatten(box, t.margin);
+    t.nodes[leaf].height = 0;
+    t.nodes[leaf].proxy = proxy;
+    t.proxyNode[proxy] = leaf;
+    t.tight[proxy] = box;
+    t.liveCount++;
+    t.pairsValid = false;
+    aabbInsertLeaf(t, leaf);
+    return proxy;
+}
+
+// Visits every live proxy whose tight box overlaps `box`.
+template <typename Visit>
+static void aabbVisitOverlaps(const OCCTAABBTree& t, const OCCTAABB& box,
+                              std::vector<int32_t>& stack, const Visit& visit) {
+    if (t.root < 0) return;
+    stack.clear();
+    stack.push_back(t.root);
+    while (!stack.empty()) {
+        const int32_t id = stack.back();
+        stack.pop_back();
+        const auto& node = t.nodes[id];
+        if (!aabbOverlap(node.box, box)) continue;
+        if (node.isLeaf()) {
+            if (aabbOverlap(t.tight[node.proxy], box)) visit(node.proxy);
+        } else {
+            stack.push_back(node.child1);
+            stack.push_back(node.child2);
+        }
+    }
+}
+
+OCCTAABBTreeRef OCCTAABBTreeCreate(double margin) {
+    if (!(margin >= 0)) return nullptr;
+    try {
+        auto* t = new OCCTAABBTree();
+        t->margin = margin;
+        return t;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OCCTAABBTreeRef OCCTAABBTreeCreateFromBoxes(const double* boxes, int32_t count, double margin) {
+    if (!boxes || count < 0 || !(margin >= 0)) return nullptr;
+    for (int32_t i = 0; i < count; i++) if (!aabbValid(boxes + i * 6)) return nullptr;
+    try {
+        auto* t = new OCCTAABBTree();
+        t->margin = margin;
+        t->nodes.reserve((size_t)count * 2);
+        for (int32_t i = 0; i < count; i++) {
+            const double* b = boxes + i * 6;
+            aabbInsertProxy(*t, { b[0], b[1], b[2], b[3], b[4], b[5] }, i);
+        }
+        return t;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+OCCTAABBTreeRef OCCTAABBTreeCreateFromShapes(const OCCTShapeRef* shapes, int32_t count,
+                                             double margin, bool useTriangulation) {
+    if (!shapes || count < 0 || !(margin >= 0)) return nullptr;
+    try {
+        // Bounding boxes in parallel: BRepBndLib builds its own adaptors per call.
+        std::vector<OCCTAABB> boxes(count);
+        std::vector<uint8_t> valid(count, 0);
+        occtParallelChunks(count, [&](int32_t begin, int32_t end) {
+            for (int32_t i = begin; i < end; i++) {
+                if (!shapes[i] || shapes[i]->shape.IsNull()) continue;
+                try {
+                    Bnd_Box bb;
+                    BRepBndLib::Add(shapes[i]->shape, bb, useTriangulation);
+                    if (bb.IsVoid()) continue;
+                    auto& b = boxes[i];
+                    bb.Get(b[0], b[1], b[2], b[3], b[4], b[5]);
+                    valid[i] = aabbValid(b.data()) ? 1 : 0;
+                } catch (...) {}
+            }
+        });
+
+        auto* t = new OCCTAABBTree();
+        t->margin = margin;
+        t->nodes.reserve((size_t)count * 2);
+        t->proxyNode.assign(count, -1);
+        t->tight.resize(count);
+        for (int32_t i = 0; i < count; i++) {
+            if (valid[i]) aabbInsertProxy(*t, boxes[i], i);
+        }
+        return t;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTAABBTreeRelease(OCCTAABBTreeRef tree) {
+    delete tree;
+}
+
+int32_t OCCTAABBTreeInsert(OCCTAABBTreeRef tree, const double* box) {
+    if (!tree || !box || !aabbValid(box)) return -1;
+    try {
+        return aabbInsertProxy(*tree, { box[0], box[1], box[2], box[3], box[4], box[5] });
+    } catch (...) {
+        return -1;
+    }
+}
+
+bool OCCTAABBTreeRemove(OCCTAABBTreeRef tree, int32_t proxy) {
+    if (!tree || proxy < 0 || proxy >= (int32_t)tree->proxyNode.size()) return false;
+    const int32_t leaf = tree->proxyNode[proxy];
+    if (leaf < 0) return false;
+    aabbRemoveLeaf(*tree, leaf);
+    aabbFreeNode(*tree, leaf);
+    tree->proxyNode[proxy] = -1;
+    tree->freeProxies.push_back(proxy);
+    tree->liveCount--;
+    tree->pairsValid = false;
+    return true;
+}
+
+int32_t OCCTAABBTreeUpdate(OCCTAABBTreeRef tree, int32_t proxy, const double* box) {
+    if (!tree || !box || !aabbValid(box)) return -1;
+    if (proxy < 0 || proxy >= (int32_t)tree->proxyNode.size()) return -1;
+    const int32_t leaf = tree->proxyNode[proxy];
+    if (leaf < 0) return -1;
+    try {
+        const OCCTAABB b = { box[0], box[1], box[2], box[3], box[4], box[5] };
+        tree->tight[proxy] = b;
+        tree->pairsValid = false;
+        if (aabbContains(tree->nodes[leaf].box, b)) return 0;
+        aabbRemoveLeaf(*tree, leaf);
+        tree->nodes[leaf].box = aabbFatten(b, tree->margin);
+        aabbInsertLeaf(*tree, leaf);
+        return 1;
+    } catch (...) {
+        return -1;
+    }
+}
+
+int32_t OCCTAABBTreeProxyCapacity(OCCTAABBTreeRef tree) {
+    return tree ? (int32_t)tree->proxyNode.size() : 0;
+}
+
+int32_t OCCTAABBTreeCount(OCCTAABBTreeRef tree) {
+    return tree ? tree->liveCount : 0;
+}
+
+int32_t OCCTAABBTreeHeight(OCCTAABBTreeRef tree) {
+    if (!tree || tree->root < 0) return -1;
+    return tree->nodes[tree->root].height;
+}
+
+bool OCCTAABBTreeGetBox(OCCTAABBTreeRef tree, int32_t proxy, double* outBox) {
+    if (!tree || !outBox || proxy < 0 || proxy >= (int32_t)tree->proxyNode.size()) return false;
+    if (tree->proxyNode[proxy] < 0) return false;
+    std::copy(tree->tight[proxy].begin(), tree->tight[proxy].end(), outBox);
+    return true;
+}
+
+int32_t OCCTAABBTreeQueryBox(OCCTAABBTreeRef tree, const double* box,
+                             int32_t* outProxies, int32_t maxResults) {
+    if (!tree || !box || !outProxies || !aabbValid(box)) return 0;
+    try {
+        const OCCTAABB q = { box[0], box[1], box[2], box[3], box[4], box[5] };
+        std::vector<int32_t> stack;
+        int32_t total = 0;
+        aabbVisitOverlaps(*tree, q, stack, [&](int32_t proxy) {
+            if (total < maxResults) outProxies[total] = proxy;
+            total++;
+        });
+        return total;
+    } catch (...) {
+        return 0;
+    }
+}
+
+int32_t OCCTAABBTreeQueryRay(OCCTAABBTreeRef tree,
+                             double ox, double oy, double oz,
+                             double dx, double dy, double dz,
+                             double maxDistance,
+                             int32_t* outProxies, double* outEntryT, int32_t maxResults) {
+    if (!tree || !outProxies || tree->root < 0 || !(maxDistance >= 0)) return 0;
+    try {
+        const double o[3] = { ox, oy, oz };
+        const double d[3] = { dx, dy, dz };
+        std::vector<std::pair<double, int32_t>> hits;
+        std::vector<int32_t> stack;
+        stack.push_back(tree->root);
+        while (!stack.empty()) {
+            const int32_t id = stack.back();
+            stack.pop_back();
+            const auto& node = tree->nodes[id];
+            double t = 0;
+            if (!aabbRay(node.box, o, d, maxDistance, t)) continue;
+            if (node.isLeaf()) {
+                if (aabbRay(tree->tight[node.proxy], o, d, maxDistance, t))
+                    hits.emplace_back(t, node.proxy);
+            } else {
+                stack.push_back(node.child1);
+                stack.push_back(node.child2);
+            }
+        }
+        std::sort(hits.begin(), hits.end());
+        const int32_t n = std::min((int32_t)hits.size(), maxResults);
+        for (int32_t i = 0; i < n; i++) {
+            outProxies[i] = hits[i].second;
+            if (outEntryT) outEntryT[i] = hits[i].first;
+        }
+        return (int32_t)hits.size();
+    } catch (...) {
+        return 0;
+    }
+}
+
+int32_t OCCTAABBTreeComputePairs(OCCTAABBTreeRef tree, bool parallel) {
+    if (!tree) return -1;
+    try {
+        const int32_t capacity = (int32_t)tree->proxyNode.size();
+        std::vector<int32_t> counts(capacity, 0);
+
+        // Two passes over the same traversal (count, then fill): the counts size the
+        // output up front, so each proxy writes its own slice and the order is deterministic.
+        occtParallelChunks(capacity, [&](int32_t begin, int32_t end) {
+            std::vector<int32_t> stack;
+            for (int32_t a = begin; a < end; a++) {
+                if (tree->proxyNode[a] < 0) continue;
+                int32_t n = 0;
+                aabbVisitOverlaps(*tree, tree->tight[a], stack, [&](int32_t b) { if (b > a) n++; });
+                counts[a] = n;
+            }
+        }, parallel);
+
+        tree->pairOffsets.assign(capacity + 1, 0);
+        for (int32_t a = 0; a < capacity; a++)
+            tree->pairOffsets[a + 1] = tree->pairOffsets[a] + counts[a];
+        tree->pairPartners.assign(tree->pairOffsets[capacity], 0);
+
+        occtParallelChunks(capacity, [&](int32_t begin, int32_t end) {
+            std::vector<int32_t> stack;
+            for (int32_t a = begin; a < end; a++) {
+                if (counts[a] == 0) continue;
+                int32_t* dst = tree->pairPartners.data() + tree->pairOffsets[a];
+                int32_t n = 0;
+                aabbVisitOverlaps(*tree, tree->tight[a], stack, [&](int32_t b) { if (b > a) dst[n++] = b; });
+                std::sort(dst, dst + n);
+            }
+        }, parallel);
+
+        tree->pairsValid = true;
+        return tree->pairOffsets[capacity];
+    } catch (...) {
+        tree->pairsValid = false;
+        return -1;
+    }
+}
+
+bool OCCTAABBTreeGetPairs(OCCTAABBTreeRef tree, int32_t* outOffsets, int32_t* outPartners) {
+    if (!tree || !outOffsets || !outPartners || !tree->pairsValid) return false;
+    std::copy(tree->pairOffsets.begin(), tree->pairOffsets.end(), outOffsets);
+    std::copy(tree->pairPartners.begin(), tree->pairPartners.end(), outPartners);
+    return true;
+}
+
+// MARK: - Batch Bounding Volumes
+
+#include <BRep_Tool.hxx>
+#include <Bnd_OBB.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TopExp_Explorer.hxx>
+
+static void bvFillOBB(const Bnd_OBB& obb, OCCTOrientedBoundingBox& out) {
+    const gp_XYZ c = obb.Center(), x = obb.XDirection(), y = obb.YDirection(), z = obb.ZDirection();
+    out.centerX = c.X(); out.centerY = c.Y(); out.centerZ = c.Z();
+    out.xDirX = x.X(); out.xDirY = x.Y(); out.xDirZ = x.Z();
+    out.yDirX = y.X(); out.yDirY = y.Y(); out.yDirZ = y.Z();
+    out.zDirX = z.X(); out.zDirY = z.Y(); out.zDirZ = z.Z();
+    out.halfX = obb.XHSize(); out.halfY = obb.YHSize(); out.halfZ = obb.ZHSize();
+}
+
+// Mesh nodes of every face plus the slack between mesh and shape (largest recorded
+// deflection + largest vertex tolerance). Returns false if some face has no mesh.
+static bool bvMeshNodes(const TopoDS_Shape& shape, std::vector<gp_XYZ>& nodes, double& slack) {
+    double deflection = 0, tolerance = 0;
+    for (TopExp_Explorer fx(shape, TopAbs_FACE); fx.More(); fx.Next()) {
+        TopLoc_Location loc;
+        Handle(Poly_Triangulation) tri = BRep_Tool::Triangulation(TopoDS::Face(fx.Current()), loc);
+        if (tri.IsNull()) return false;
+        const gp_Trsf trsf = loc.Transformation();
+        for (int i = 1; i <= tri->NbNodes(); i++) nodes.push_back(tri->Node(i).Transformed(trsf).XYZ());
+        deflection = std::max(deflection, tri->Deflection());
+    }
+    for (TopExp_Explorer vx(shape, TopAbs_VERTEX); vx.More(); vx.Next()) {
+        tolerance = std::max(tolerance, BRep_Tool::Tolerance(TopoDS::Vertex(vx.Current())));
+    }
+    slack = deflection + tolerance;
+    return !nodes.empty();
+}
+
+// OBB from mesh nodes: the optimal search runs only on the nodes that are extreme along
+// a fixed set of directions (all of them lie on the convex hull), then the extents are
+// recomputed over every node so the box still encloses the whole mesh.
+static bool bvHullOBB(const TopoDS_Shape& shape, Bnd_OBB& obb) {
+    std::vector<gp_XYZ> nodes;
+    double slack = 0;
+    if (!bvMeshNodes(shape, nodes, slack)) return false;
+
+    static const int kDirections = 64;
+    std::vector<int32_t> extreme;
+    extreme.reserve(kDirections);
+    for (int k = 0; k < kDirections; k++) {
+        // Fibonacci sphere.
+        const double zk = 1.0 - (2.0 * k + 1.0) / kDirections;
+        const double r = std::sqrt(std::max(0.0, 1.0 - zk * zk));
+        const double phi = k * M_PI * (3.0 - std::sqrt(5.0));
+        const gp_XYZ dir(r * std::cos(phi), r * std::sin(phi), zk);
+        int32_t best = 0;
+        double bestDot = -1e300;
+        for (int32_t i = 0; i < (int32_t)nodes.size(); i++) {
+            const double d = nodes[i].Dot(dir);
+            if (d > bestDot) { bestDot = d; best = i; }
+        }
+        extreme.push_back(best);
+    }
+    std::sort(extreme.begin(), extreme.end());
+    extreme.erase(std::unique(extreme.begin(), extreme.end()), extreme.end());
+
+    TColgp_Array1OfPnt hull(1, (int)extreme.size());
+    for (int i = 0; i < (int)extreme.size(); i++) hull.SetValue(i + 1, gp_Pnt(nodes[extreme[i]]));
+    Bnd_OBB axes;
+    axes.ReBuild(hull, nullptr, Standard_True);
+    if (axes.IsVoid()) return false;
+
+    const gp_XYZ dirs[3] = { axes.XDirection(), axes.YDirection(), axes.ZDirection() };
+    double lo[3] = { 1e300, 1e300, 1e300 }, hi[3] = { -1e300, -1e300, -1e300 };
+    for (const gp_XYZ& p : nodes) {
+        for (int a = 0; a < 3; a++) {
+            const double d = p.Dot(dirs[a]);
+            lo[a] = std::min(lo[a], d);
+            hi[a] = std::max(hi[a], d);
+        }
+    }
+    gp_XYZ center(0, 0, 0);
+    for (int a = 0; a < 3; a++) center += dirs[a] * (0.5 * (lo[a] + hi[a]));
+    obb = Bnd_OBB(gp_Pnt(center), gp_Dir(dirs[0]), gp_Dir(dirs[1]), gp_Dir(dirs[2]),
+                  0.5 * (hi[0] - lo[0]) + slack, 0.5 * (hi[1] - lo[1]) + slack, 0.5 * (hi[2] - lo[2]) + slack);
+    return true;
+}
+
+int32_t OCCTShapesComputeBoundingVolumes(const OCCTShapeRef* shapes, int32_t count, uint32_t volumes,
+                                         OCCTOBBMode obbMode, bool useTriangulation,
+                                         OCCTBoundingVolumes* out, bool parallel) {
+    if (!shapes || !out || count < 0) return -1;
+    std::atomic<int32_t> done{0};
+    occtParallelChunks(count, [&](int32_t begin, int32_t end) {
+        int32_t nbDone = 0;
+        for (int32_t i = begin; i < end; i++) {
+            OCCTBoundingVolumes& r = out[i];
+            r = OCCTBoundingVolumes();
+            if (!shapes[i] || shapes[i]->shape.IsNull()) continue;
+            const TopoDS_Shape& shape = shapes[i]->shape;
+            if (volumes & OCCTBoundingVolumeAABB) {
+                try {
+                    Bnd_Box box;
+                    BRepBndLib::Add(shape, box, useTriangulation);
+                    if (!box.IsVoid()) {
+                        box.Get(r.aabbMin[0], r.aabbMin[1], r.aabbMin[2], r.aabbMax[0], r.aabbMax[1], r.aabbMax[2]);
+                        r.valid |= OCCTBoundingVolumeAABB;
+                    }
+                } catch (...) {}
+            }
+            if (volumes & OCCTBoundingVolumeOptimalAABB) {
+                try {
+                    Bnd_Box box;
+                    BRepBndLib::AddOptimal(shape, box, useTriangulation, Standard_True);
+                    if (!box.IsVoid()) {
+                        box.Get(r.optimalMin[0], r.optimalMin[1], r.optimalMin[2],
+                                r.optimalMax[0], r.optimalMax[1], r.optimalMax[2]);
+                        r.valid |= OCCTBoundingVolumeOptimalAABB;
+                    }
+                } catch (...) {}
+            }
+            if (volumes & OCCTBoundingVolumeOBB) {
+                try {
+                    Bnd_OBB obb;
+                    // The hull mode needs a mesh; without one it falls back to the PCA box.
+                    if (obbMode != OCCTOBBModeHull || !useTriangulation || !bvHullOBB(shape, obb)) {
+                        obb = Bnd_OBB();
+                        BRepBndLib::AddOBB(shape, obb, useTriangulation, obbMode == OCCTOBBModeOptimal, Standard_True);
+                    }
+                    if (!obb.IsVoid()) {
+                        bvFillOBB(obb, r.obb);
+                        r.valid |= OCCTBoundingVolumeOBB;
+                    }
+                } catch (...) {}
+            }
+            if (r.valid) nbDone++;
+        }
+        done += nbDone;
+    }, parallel);
+    return done.load();
+}
@@ -95,6 +95,7 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
 
@@ -971,8 +972,7 @@ bool OCCTShapeFindPlane(OCCTShapeRef shape, double tolerance,
 int32_t OCCTShapeGetSubShapeCount(OCCTShapeRef shape, int32_t type) {
     if (!shape) return 0;
     try {
-        TopTools_IndexedMapOfShape map;
-        TopExp::MapShapes(shape->shape, static_cast<TopAbs_ShapeEnum>(type), map);
+        const TopTools_IndexedMapOfShape& map = shape->subShapes(static_cast<TopAbs_ShapeEnum>(type));
         return map.Extent();
     } catch (...) {
         return 0;
@@ -982,8 +982,7 @@ int32_t OCCTShapeGetSubShapeCount(OCCTShapeRef shape, int32_t type) {
 OCCTShapeRef OCCTShapeGetSubShapeByTypeIndex(OCCTShapeRef shape, int32_t type, int32_t index) {
     if (!shape || index < 0) return nullptr;
     try {
-        TopTools_IndexedMapOfShape map;
-        TopExp::MapShapes(shape->shape, static_cast<TopAbs_ShapeEnum>(type), map);
+        const TopTools_IndexedMapOfShape& map = shape->subShapes(static_cast<TopAbs_ShapeEnum>(type));
         if (index >= map.Extent()) return nullptr;
         return new OCCTShape(map(index + 1)); // OCCT uses 1-based indexing
     } catch (...) {
@@ -1993,8 +1992,7 @@ bool OCCTEdgeCommonVertex(OCCTShapeRef edge1, OCCTShapeRef edge2,
 
 int32_t OCCTEdgeFaceAdjacency(OCCTShapeRef shape, int32_t* adjacentFaceCounts) {
     try {
-        NCollection_IndexedDataMap<TopoDS_Shape, TopTools_ListOfShape, TopTools_ShapeMapHasher> map;
-        TopExp::MapShapesAndUniqueAncestors(shape->shape, TopAbs_EDGE, TopAbs_FACE, map);
+        const TopTools_IndexedDataMapOfShapeListOfShape& map = shape->edgeFaces();
         int32_t count = (int32_t)map.Extent();
         if (adjacentFaceCounts) {
             for (int i = 1; i <= count; i++) {
@@ -2007,8 +2005,7 @@ int32_t OCCTEdgeFaceAdjacency(OCCTShapeRef shape, int32_t* adjacentFaceCounts) {
 
 int32_t OCCTVertexEdgeAdjacency(OCCTShapeRef shape, int32_t* adjacentEdgeCounts) {
     try {
-        NCollection_IndexedDataMap<TopoDS_Shape, TopTools_ListOfShape, TopTools_ShapeMapHasher> map;
-        TopExp::MapShapesAndUniqueAncestors(shape->shape, TopAbs_VERTEX, TopAbs_EDGE, map);
+        const TopTools_IndexedDataMapOfShapeListOfShape& map = shape->vertexEdges();
         int32_t count = (int32_t)map.Extent();
         if (adjacentEdgeCounts) {
             for (int i = 1; i <= count; i++) {
@@ -2022,15 +2019,13 @@ int32_t OCCTVertexEdgeAdjacency(OCCTShapeRef shape, int32_t* adjacentEdgeCounts)
 int32_t OCCTEdgeAdjacentFaces(OCCTShapeRef shape, OCCTShapeRef edge,
                               int32_t* faceIndices, int32_t maxFaces) {
     try {
-        NCollection_IndexedDataMap<TopoDS_Shape, TopTools_ListOfShape, TopTools_ShapeMapHasher> map;
-        TopExp::MapShapesAndUniqueAncestors(shape->shape, TopAbs_EDGE, TopAbs_FACE, map);
+        const TopTools_IndexedDataMapOfShapeListOfShape& map = shape->edgeFaces();
         // Find the edge in the map
         TopoDS_Edge e = TopoDS::Edge(edge->shape);
         int edgeIdx = map.FindIndex(e);
         if (edgeIdx == 0) return 0;
         // Build face index map for lookup
-        NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         const TopTools_ListOfShape& faces = map(edgeIdx);
         int32_t count = 0;
         for (auto it = faces.cbegin(); it != faces.cend() && count < maxFaces; ++it) {
@@ -2044,13 +2039,11 @@ int32_t OCCTEdgeAdjacentFaces(OCCTShapeRef shape, OCCTShapeRef edge,
 int32_t OCCTVertexAdjacentEdges(OCCTShapeRef shape, OCCTShapeRef vertex,
                                 int32_t* edgeIndices, int32_t maxEdges) {
     try {
-        NCollection_IndexedDataMap<TopoDS_Shape, TopTools_ListOfShape, TopTools_ShapeMapHasher> map;
-        TopExp::MapShapesAndUniqueAncestors(shape->shape, TopAbs_VERTEX, TopAbs_EDGE, map);
+        const TopTools_IndexedDataMapOfShapeListOfShape& map = shape->vertexEdges();
         TopoDS_Vertex v = TopoDS::Vertex(vertex->shape);
         int vertIdx = map.FindIndex(v);
         if (vertIdx == 0) return 0;
-        NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
         const TopTools_ListOfShape& edges = map(vertIdx);
         int32_t count = 0;
         for (auto it = edges.cbegin(); it != edges.cend() && count < maxEdges; ++it) {
@@ -2086,8 +2079,7 @@ int32_t OCCTAnalyseEdgeConcavity(OCCTShapeRef shape, double angle, int32_t* edge
     try {
         BRepOffset_Analyse analyse(shape->shape, angle);
         if (!analyse.IsDone()) return 0;
-        NCollection_IndexedMap<TopoDS_Shape, TopTools_ShapeMapHasher> edges;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edges);
+        const TopTools_IndexedMapOfShape& edges = shape->subShapes(TopAbs_EDGE);
         int32_t count = (int32_t)edges.Extent();
         if (edgeTypes) {
             for (int i = 1; i <= count; i++) {
@@ -2319,6 +2311,7 @@ int32_t OCCTShapeGetOrientation(OCCTShapeRef shape) {
 void OCCTShapeSetOrientation(OCCTShapeRef shape, int32_t orientation) {
     if (!shape) return;
     shape->shape.Orientation(static_cast<TopAbs_Orientation>(orientation));
+    shape->invalidateIndex();  // cached sub-shapes carry the composed orientation
 }
 
 OCCTShapeRef OCCTShapeReversed(OCCTShapeRef shape) {
@@ -2633,6 +2626,7 @@ void OCCTShapeSetLocation(OCCTShapeRef shape, const double* matrix12) {
         gp_Trsf t = trsfFromMatrix12(matrix12);
         TopLoc_Location loc(t);
         shape->shape.Location(loc);
+        shape->invalidateIndex();
     } catch (...) {}
 }
 
@@ -2931,6 +2925,7 @@ bool OCCTBuilderAdd(OCCTShapeRef parent, OCCTShapeRef child) {
     try {
         TopoDS_Builder builder;
         builder.Add(parent->shape, child->shape);
+        parent->invalidateIndex();
         return true;
     } catch (...) { return false; }
 }
@@ -2940,6 +2935,7 @@ bool OCCTBuilderRemove(OCCTShapeRef parent, OCCTShapeRef child) {
     try {
         TopoDS_Builder builder;
         builder.Remove(parent->shape, child->shape);
+        parent->invalidateIndex();
         return true;
     } catch (...) { return false; }
 }
@@ -2949,7 +2945,9 @@ bool OCCTBRepLibOrientClosedSolid(OCCTShapeRef shape) {
     if (!shape) return false;
     try {
         TopoDS_Solid solid = TopoDS::Solid(shape->shape);
-        return BRepLib::OrientClosedSolid(solid);
+        const bool ok = BRepLib::OrientClosedSolid(solid);
+        shape->invalidateIndex();  // shells are re-oriented inside the shared TShape
+        return ok;
     } catch (...) { return false; }
 }
 
@@ -3059,8 +3057,7 @@ bool OCCTShapeIsClosed(OCCTShapeRef shape) {
 int32_t OCCTShapeUniqueSubShapeCount(OCCTShapeRef shape, int32_t type) {
     if (!shape) return 0;
     try {
-        TopTools_IndexedMapOfShape map;
-        TopExp::MapShapes(shape->shape, (TopAbs_ShapeEnum)type, map);
+        const TopTools_IndexedMapOfShape& map = shape->subShapes((TopAbs_ShapeEnum)type);
         return (int32_t)map.Extent();
     } catch (...) { return 0; }
 }
@@ -4189,8 +4186,7 @@ int32_t OCCTShapeGetFaceCount(OCCTShapeRef shape) {
     if (!shape) return 0;
     
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         return faceMap.Extent();
     } catch (...) {
         return 0;
@@ -4201,8 +4197,7 @@ OCCTFaceRef OCCTShapeGetFaceAtIndex(OCCTShapeRef shape, int32_t index) {
     if (!shape || index < 0) return nullptr;
     
     try {
-        TopTools_IndexedMapOfShape faceMap;
-        TopExp::MapShapes(shape->shape, TopAbs_FACE, faceMap);
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
         
         if (index >= faceMap.Extent()) return nullptr;
         
@@ -4219,8 +4214,7 @@ int32_t OCCTShapeGetTotalEdgeCount(OCCTShapeRef shape) {
     if (!shape) return 0;
     
     try {
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
         return edgeMap.Extent();
     } catch (...) {
         return 0;
@@ -4231,8 +4225,7 @@ OCCTEdgeRef OCCTShapeGetEdgeAtIndex(OCCTShapeRef shape, int32_t index) {
     if (!shape || index < 0) return nullptr;
     
     try {
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
         
         if (index >= edgeMap.Extent()) return nullptr;
         
@@ -4336,3 +4329,130 @@ void OCCTEdgeGetEndpoints(OCCTEdgeRef edge, double* startX, double* startY, doub
     }
 }
 
+
+// MARK: - Bulk topology export
+
+#include <memory>
+
+// Flat, index-based topology of one shape. All indices are 0-based positions in
+// the shape's cached IndexedMaps (OCCTShape::subShapes), so they agree with the
+// index-based calls (OCCTShapeGetFaceAtIndex, …).
+struct OCCTTopologyTables {
+    int32_t nbFaces = 0, nbWires = 0, nbEdges = 0, nbVertices = 0;
+    std::vector<int32_t> tables[OCCTTopologyTableCount];
+    std::vector<double> vertexCoords;
+};
+
+OCCTTopologyTablesRef OCCTShapeExportTopology(OCCTShapeRef shape) {
+    if (!shape) return nullptr;
+    try {
+        const TopTools_IndexedMapOfShape& faceMap = shape->subShapes(TopAbs_FACE);
+        const TopTools_IndexedMapOfShape& wireMap = shape->subShapes(TopAbs_WIRE);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
+        const TopTools_IndexedMapOfShape& vertexMap = shape->subShapes(TopAbs_VERTEX);
+
+        std::unique_ptr<OCCTTopologyTables> topo(new OCCTTopologyTables());
+        topo->nbFaces = faceMap.Extent();
+        topo->nbWires = wireMap.Extent();
+        topo->nbEdges = edgeMap.Extent();
+        topo->nbVertices = vertexMap.Extent();
+        auto& t = topo->tables;
+
+        // Face → wires, outer wire first.
+        t[OCCTTopologyTableFaceWireOffsets].reserve(topo->nbFaces + 1);
+        t[OCCTTopologyTableFaceWireOffsets].push_back(0);
+        for (int32_t f = 1; f <= topo->nbFaces; f++) {
+            const TopoDS_Face& face = TopoDS::Face(faceMap(f));
+            const TopoDS_Wire outer = BRepTools::OuterWire(face);
+            const int32_t outerIndex = outer.IsNull() ? 0 : wireMap.FindIndex(outer);
+            if (outerIndex > 0) t[OCCTTopologyTableFaceWires].push_back(outerIndex - 1);
+            for (TopoDS_Iterator it(face); it.More(); it.Next()) {
+                if (it.Value().ShapeType() != TopAbs_WIRE) continue;
+                const int32_t w = wireMap.FindIndex(it.Value());
+                if (w > 0 && w != outerIndex) t[OCCTTopologyTableFaceWires].push_back(w - 1);
+            }
+            t[OCCTTopologyTableFaceWireOffsets].push_back((int32_t)t[OCCTTopologyTableFaceWires].size());
+        }
+
+        // Wire → edges in stored order, with each edge's orientation in the wire.
+        t[OCCTTopologyTableWireEdgeOffsets].reserve(topo->nbWires + 1);
+        t[OCCTTopologyTableWireEdgeOffsets].push_back(0);
+        for (int32_t w = 1; w <= topo->nbWires; w++) {
+            for (TopoDS_Iterator it(wireMap(w)); it.More(); it.Next()) {
+                const int32_t e = edgeMap.FindIndex(it.Value());
+                if (e == 0) continue;
+                t[OCCTTopologyTableWireEdges].push_back(e - 1);
+                t[OCCTTopologyTableWireEdgeOrientations].push_back((int32_t)it.Value().Orientation());
+            }
+            t[OCCTTopologyTableWireEdgeOffsets].push_back((int32_t)t[OCCTTopologyTableWireEdges].size());
+        }
+
+        // Edge → (first, last) vertex of the FORWARD edge; -1 when missing.
+        t[OCCTTopologyTableEdgeVertices].resize(2 * topo->nbEdges, -1);
+        for (int32_t e = 1; e <= topo->nbEdges; e++) {
+            TopoDS_Vertex v1, v2;
+            TopExp::Vertices(TopoDS::Edge(edgeMap(e).Oriented(TopAbs_FORWARD)), v1, v2);
+            if (!v1.IsNull()) t[OCCTTopologyTableEdgeVertices][2 * (e - 1)] = vertexMap.FindIndex(v1) - 1;
+            if (!v2.IsNull()) t[OCCTTopologyTableEdgeVertices][2 * (e - 1) + 1] = vertexMap.FindIndex(v2) - 1;
+        }
+
+        // Edge → faces and vertex → edges from the cached ancestor maps.
+        auto fillAncestors = [](const TopTools_IndexedMapOfShape& keys,
+                                const TopTools_IndexedDataMapOfShapeListOfShape& ancestors,
+                                const TopTools_IndexedMapOfShape& targets,
+                                std::vector<int32_t>& offsets, std::vector<int32_t>& values) {
+            offsets.reserve(keys.Extent() + 1);
+            offsets.push_back(0);
+            for (int32_t k = 1; k <= keys.Extent(); k++) {
+                const int32_t a = ancestors.FindIndex(keys(k));
+                if (a > 0) {
+                    for (TopTools_ListOfShape::Iterator it(ancestors(a)); it.More(); it.Next()) {
+                        const int32_t i = targets.FindIndex(it.Value());
+                        if (i > 0) values.push_back(i - 1);
+                    }
+                }
+                offsets.push_back((int32_t)values.size());
+            }
+        };
+        fillAncestors(edgeMap, shape->edgeFaces(), faceMap,
+                      t[OCCTTopologyTableEdgeFaceOffsets], t[OCCTTopologyTableEdgeFaces]);
+        fillAncestors(vertexMap, shape->vertexEdges(), edgeMap,
+                      t[OCCTTopologyTableVertexEdgeOffsets], t[OCCTTopologyTableVertexEdges]);
+
+        topo->vertexCoords.resize(3 * topo->nbVertices);
+        for (int32_t v = 1; v <= topo->nbVertices; v++) {
+            const gp_Pnt p = BRep_Tool::Pnt(TopoDS::Vertex(vertexMap(v)));
+            topo->vertexCoords[3 * (v - 1)] = p.X();
+            topo->vertexCoords[3 * (v - 1) + 1] = p.Y();
+            topo->vertexCoords[3 * (v - 1) + 2] = p.Z();
+        }
+        return topo.release();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void OCCTTopologyTablesRelease(OCCTTopologyTablesRef topo) {
+    delete topo;
+}
+
+void OCCTTopologyTablesGetCounts(OCCTTopologyTablesRef topo, int32_t* outFaces, int32_t* outWires,
+                                 int32_t* outEdges, int32_t* outVertices) {
+    if (!topo) return;
+    if (outFaces) *outFaces = topo->nbFaces;
+    if (outWires) *outWires = topo->nbWires;
+    if (outEdges) *outEdges = topo->nbEdges;
+    if (outVertices) *outVertices = topo->nbVertices;
+}
+
+int32_t OCCTTopologyTablesGet(OCCTTopologyTablesRef topo, OCCTTopologyTable table, int32_t* outValues) {
+    if (!topo || table < 0 || table >= OCCTTopologyTableCount) return -1;
+    const std::vector<int32_t>& values = topo->tables[table];
+    if (outValues) std::copy(values.begin(), values.end(), outValues);
+    return (int32_t)values.size();
+}
+
+void OCCTTopologyTablesGetVertexCoords(OCCTTopologyTablesRef topo, double* outCoords) {
+    if (!topo || !outCoords) return;
+    std::copy(topo->vertexCoords.begin(), topo->vertexCoords.end(), outCoords);
+}
@@ -410,8 +410,7 @@ bool OCCTShapeGetEdgeMesh(OCCTShapeRef shape, double deflection, OCCTEdgeMeshDat
 
         // Use indexed map to get unique edges (TopExp_Explorer visits each edge
         // once per adjacent face, causing duplicates)
-        TopTools_IndexedMapOfShape edgeMap;
-        TopExp::MapShapes(shape->shape, TopAbs_EDGE, edgeMap);
+        const TopTools_IndexedMapOfShape& edgeMap = shape->subShapes(TopAbs_EDGE);
 
         for (int ei = 1; ei <= edgeMap.Extent(); ei++) {
             TopoDS_Edge edge = TopoDS::Edge(edgeMap(ei));
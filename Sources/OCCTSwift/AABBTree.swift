@@ -0,0 +1,170 @@
+import Foundation
+import simd
+import OCCTBridge
+
+/// A dynamic axis-aligned bounding-box tree for broad-phase overlap queries.
+///
+/// Unlike ``BoundSortBox`` (a static `Bnd_BoundSortBox`), items can be inserted, moved
+/// and removed without rebuilding. Each item is a *proxy* with a stable integer id. The
+/// tree stores a "fat" box grown by `margin`, so small motions don't touch the hierarchy.
+/// Queries are answered against the exact (tight) boxes.
+///
+/// ## Example
+///
+/// ```swift
+/// let tree = AABBTree(shapes: parts, margin: 0.5)!
+/// // Move part 3 and find what it now touches.
+/// tree.update(3, min: newMin, max: newMax)
+/// let touching = tree.query(min: newMin, max: newMax)
+/// // Every overlapping pair in the assembly.
+/// let pairs = tree.overlappingPairs()
+/// ```
+public final class AABBTree: @unchecked Sendable {
+    internal let handle: OCCTAABBTreeRef
+
+    /// Create an empty tree.
+    ///
+    /// - Parameter margin: Fattening added on every side of each stored box (≥ 0)
+    public init?(margin: Double = 0) {
+        guard let h = OCCTAABBTreeCreate(margin) else { return nil }
+        self.handle = h
+    }
+
+    /// Build a tree from boxes. Proxy `i` is `boxes[i]`.
+    ///
+    /// - Returns: nil if `margin` is negative or any box has `min > max`
+    public init?(boxes: [(min: SIMD3<Double>, max: SIMD3<Double>)], margin: Double = 0) {
+        let flat = boxes.flatMap { [$0.min.x, $0.min.y, $0.min.z, $0.max.x, $0.max.y, $0.max.z] }
+        guard let h = boxes.isEmpty ? OCCTAABBTreeCreate(margin) : flat.withUnsafeBufferPointer({ buf in
+            OCCTAABBTreeCreateFromBoxes(buf.baseAddress!, Int32(boxes.count), margin)
+        }) else { return nil }
+        self.handle = h
+    }
+
+    /// Build a tree from the bounding boxes of `shapes`, computed in parallel.
+    /// Proxy `i` is `shapes[i]`; empty shapes get no proxy.
+    ///
+    /// - Parameters:
+    ///   - margin: Fattening added on every side of each stored box
+    ///   - useTriangulation: Use existing meshes for tighter, faster boxes when present
+    public init?(shapes: [Shape], margin: Double = 0, useTriangulation: Bool = true) {
+        let handles: [OCCTShapeRef?] = shapes.map { $0.handle }
+        guard let h = shapes.isEmpty ? OCCTAABBTreeCreate(margin) : handles.withUnsafeBufferPointer({ buf in
+            OCCTAABBTreeCreateFromShapes(buf.baseAddress!, Int32(shapes.count), margin, useTriangulation)
+        }) else { return nil }
+        self.handle = h
+    }
+
+    deinit {
+        OCCTAABBTreeRelease(handle)
+    }
+
+    // MARK: - Editing
+
+    /// Number of live proxies.
+    public var count: Int { Int(OCCTAABBTreeCount(handle)) }
+
+    /// One past the highest proxy id handed out.
+    public var proxyCapacity: Int { Int(OCCTAABBTreeProxyCapacity(handle)) }
+
+    /// Height of the hierarchy (-1 when empty).
+    public var height: Int { Int(OCCTAABBTreeHeight(handle)) }
+
+    /// Insert a box and return its proxy id, or nil if the box is invalid.
+    @discardableResult
+    public func insert(min: SIMD3<Double>, max: SIMD3<Double>) -> Int? {
+        let box = [min.x, min.y, min.z, max.x, max.y, max.z]
+        let id = OCCTAABBTreeInsert(handle, box)
+        return id >= 0 ? Int(id) : nil
+    }
+
+    /// Remove a proxy. Returns false if it is not live.
+    @discardableResult
+    public func remove(_ proxy: Int) -> Bool {
+        OCCTAABBTreeRemove(handle, Int32(proxy))
+    }
+
+    /// Outcome of ``update(_:min:max:)``.
+    public enum UpdateResult: Sendable {
+        /// The new box is still inside the stored fat box; the hierarchy was not touched.
+        case withinMargin
+        /// The proxy was re-inserted with a new fat box.
+        case reinserted
+        /// The proxy is not live or the box is invalid.
+        case invalid
+    }
+
+    /// Move a proxy to a new box.
+    @discardableResult
+    public func update(_ proxy: Int, min: SIMD3<Double>, max: SIMD3<Double>) -> UpdateResult {
+        let box = [min.x, min.y, min.z, max.x, max.y, max.z]
+        switch OCCTAABBTreeUpdate(handle, Int32(proxy), box) {
+        case 0: return .withinMargin
+        case 1: return .reinserted
+        default: return .invalid
+        }
+    }
+
+    /// The tight box of a live proxy.
+    public func box(_ proxy: Int) -> (min: SIMD3<Double>, max: SIMD3<Double>)? {
+        var b = [Double](repeating: 0, count: 6)
+        guard OCCTAABBTreeGetBox(handle, Int32(proxy), &b) else { return nil }
+        return (SIMD3(b[0], b[1], b[2]), SIMD3(b[3], b[4], b[5]))
+    }
+
+    // MARK: - Queries
+
+    /// Proxies whose box overlaps the query box.
+    public func query(min: SIMD3<Double>, max: SIMD3<Double>) -> [Int] {
+        let box = [min.x, min.y, min.z, max.x, max.y, max.z]
+        var capacity = 64
+        while true {
+            var out = [Int32](repeating: 0, count: capacity)
+            let total = Int(OCCTAABBTreeQueryBox(handle, box, &out, Int32(capacity)))
+            if total <= capacity { return out.prefix(total).map { Int($0) } }
+            capacity = total
+        }
+    }
+
+    /// Proxies whose box is crossed by the segment `origin + t·direction`, `t ∈ [0, maxDistance]`,
+    /// sorted by entry parameter.
+    public func raycast(origin: SIMD3<Double>, direction: SIMD3<Double>,
+                        maxDistance: Double = .greatestFiniteMagnitude) -> [(proxy: Int, t: Double)] {
+        var capacity = 64
+        while true {
+            var out = [Int32](repeating: 0, count: capacity)
+            var ts = [Double](repeating: 0, count: capacity)
+            let total = Int(OCCTAABBTreeQueryRay(handle, origin.x, origin.y, origin.z,
+                                                 direction.x, direction.y, direction.z,
+                                                 maxDistance, &out, &ts, Int32(capacity)))
+            if total <= capacity { return (0..<total).map { (Int(out[$0]), ts[$0]) } }
+            capacity = total
+        }
+    }
+
+    /// All overlapping proxy pairs in CSR form: the partners of proxy `a` (all `> a`) are
+    /// `partners[offsets[a] ..< offsets[a + 1]]`.
+    ///
+    /// - Parameter parallel: Traverse the tree for each proxy on OCCT's thread pool
+    public func overlappingPairsCSR(parallel: Bool = true) -> (offsets: [Int32], partners: [Int32])? {
+        let n = OCCTAABBTreeComputePairs(handle, parallel)
+        guard n >= 0 else { return nil }
+        var offsets = [Int32](repeating: 0, count: proxyCapacity + 1)
+        var partners = [Int32](repeating: 0, count: Int(n))
+        guard OCCTAABBTreeGetPairs(handle, &offsets, &partners) else { return nil }
+        return (offsets, partners)
+    }
+
+    /// All overlapping proxy pairs `(a, b)` with `a < b`.
+    public func overlappingPairs(parallel: Bool = true) -> [(Int, Int)] {
+        guard let csr = overlappingPairsCSR(parallel: parallel) else { return [] }
+        var pairs: [(Int, Int)] = []
+        pairs.reserveCapacity(csr.partners.count)
+        for a in 0..<(csr.offsets.count - 1) {
+            for k in Int(csr.offsets[a])..<Int(csr.offsets[a + 1]) {
+                pairs.append((a, Int(csr.partners[k])))
+            }
+        }
+        return pairs
+    }
+}
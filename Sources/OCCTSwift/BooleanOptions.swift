@@ -0,0 +1,152 @@
+import Foundation
+import OCCTBridge
+
+/// Performance and robustness options accepted by every boolean, section and splitter.
+///
+/// The default value matches OCCT's own defaults (plus the usual ``Shape/defaultBooleanTimeout``
+/// watchdog); ``fast`` turns on the thread pool and OBB pre-filtering, which usually pays off
+/// for operands with many faces or many tools.
+///
+/// ```swift
+/// var opts = BooleanOptions.fast
+/// opts.glue = .shift                 // operands only touch along coincident faces
+/// let merged = base.union(boss, options: opts)
+/// ```
+public struct BooleanOptions: Sendable, Equatable {
+    /// Run intersection and building on OCCT's thread pool.
+    public var parallel: Bool
+    /// Skip sub-shape pairs whose oriented bounding boxes don't overlap.
+    public var useOBB: Bool
+    /// Never modify the input shapes (e.g. tolerances); touched sub-shapes are copied.
+    public var nonDestructive: Bool
+    /// Check input solids for inversion. Turning it off saves a classification per solid
+    /// when the inputs are known to be well oriented.
+    public var checkInverted: Bool
+    /// Glue mode for coincident-face arguments.
+    public var glue: Shape.BooleanGlue
+    /// Fuzzy tolerance; `0` keeps OCCT's default.
+    public var fuzzyValue: Double
+    /// Wall-clock bound in seconds; `0`/negative = unbounded.
+    public var timeout: Double
+
+    public init(parallel: Bool = false, useOBB: Bool = false, nonDestructive: Bool = false,
+                checkInverted: Bool = true, glue: Shape.BooleanGlue = .off, fuzzyValue: Double = 0,
+                timeout: Double = Shape.defaultBooleanTimeout) {
+        self.parallel = parallel
+        self.useOBB = useOBB
+        self.nonDestructive = nonDestructive
+        self.checkInverted = checkInverted
+        self.glue = glue
+        self.fuzzyValue = fuzzyValue
+        self.timeout = timeout
+    }
+
+    /// Parallel with OBB pre-filtering; everything else at its default.
+    public static let fast = BooleanOptions(parallel: true, useOBB: true)
+
+    internal var bridged: OCCTBooleanOptions {
+        var o = OCCTBooleanOptionsDefault()
+        o.runParallel = parallel
+        o.useOBB = useOBB
+        o.nonDestructive = nonDestructive
+        o.checkInverted = checkInverted
+        o.glue = glue.rawValue
+        o.fuzzyValue = fuzzyValue
+        o.timeoutSeconds = timeout
+        return o
+    }
+}
+
+extension Shape {
+    /// The boolean-family algorithms accepted by ``boolean(_:objects:tools:options:)``.
+    public enum BooleanAlgorithm: UInt32, Sendable {
+        case fuse = 0
+        case cut = 1
+        case common = 2
+        case section = 3
+        case split = 4
+        /// General fuse: objects and tools are all arguments, split against each other.
+        case generalFuse = 5
+        /// Tools minus objects.
+        case cutReversed = 6
+    }
+
+    /// Run any boolean, section or splitter over groups of shapes with explicit options.
+    ///
+    /// - Returns: The result, or nil on failure or timeout
+    public static func boolean(_ algorithm: BooleanAlgorithm, objects: [Shape], tools: [Shape],
+                               options: BooleanOptions = BooleanOptions()) -> Shape? {
+        guard !objects.isEmpty else { return nil }
+        var opts = options.bridged
+        let objectRefs: [OCCTShapeRef?] = objects.map { $0.handle }
+        let toolRefs: [OCCTShapeRef?] = tools.map { $0.handle }
+        let result = objectRefs.withUnsafeBufferPointer { obj in
+            toolRefs.withUnsafeBufferPointer { tl in
+                OCCTShapeBooleanWithOptions(OCCTBooleanOp(rawValue: algorithm.rawValue),
+                                            obj.baseAddress, Int32(objects.count),
+                                            tl.baseAddress, Int32(tools.count), &opts)
+            }
+        }
+        guard let h = result else { return nil }
+        return Shape(handle: h)
+    }
+
+    /// ``boolean(_:objects:tools:options:)`` that keeps the builder for per-input history.
+    public static func booleanWithFullHistory(_ algorithm: BooleanAlgorithm, objects: [Shape], tools: [Shape],
+                                              options: BooleanOptions = BooleanOptions())
+        -> (result: Shape, history: ShapeHistoryRef)? {
+        guard !objects.isEmpty else { return nil }
+        var opts = options.bridged
+        var resultRef: OCCTShapeRef?
+        let objectRefs: [OCCTShapeRef?] = objects.map { $0.handle }
+        let toolRefs: [OCCTShapeRef?] = tools.map { $0.handle }
+        let history = objectRefs.withUnsafeBufferPointer { obj in
+            toolRefs.withUnsafeBufferPointer { tl in
+                OCCTBooleanWithOptionsAndHistory(OCCTBooleanOp(rawValue: algorithm.rawValue),
+                                                 obj.baseAddress, Int32(objects.count),
+                                                 tl.baseAddress, Int32(tools.count), &opts, &resultRef)
+            }
+        }
+        guard let history, let resultRef else { return nil }
+        return (Shape(handle: resultRef), ShapeHistoryRef(history))
+    }
+
+    /// Union with explicit ``BooleanOptions``.
+    public func union(_ other: Shape, options: BooleanOptions) -> Shape? {
+        Shape.boolean(.fuse, objects: [self], tools: [other], options: options)
+    }
+
+    /// Subtraction with explicit ``BooleanOptions``.
+    public func subtracting(_ other: Shape, options: BooleanOptions) -> Shape? {
+        Shape.boolean(.cut, objects: [self], tools: [other], options: options)
+    }
+
+    /// Intersection with explicit ``BooleanOptions``.
+    public func intersection(_ other: Shape, options: BooleanOptions) -> Shape? {
+        Shape.boolean(.common, objects: [self], tools: [other], options: options)
+    }
+
+    /// Multi-tool subtraction with explicit ``BooleanOptions``.
+    public func subtracting(all tools: [Shape], options: BooleanOptions) -> Shape? {
+        guard !tools.isEmpty else { return nil }
+        return Shape.boolean(.cut, objects: [self], tools: tools, options: options)
+    }
+
+    /// Section curves with explicit ``BooleanOptions``.
+    public func section(with other: Shape, options: BooleanOptions) -> Shape? {
+        Shape.boolean(.section, objects: [self], tools: [other], options: options)
+    }
+
+    /// Split by any number of tools with explicit ``BooleanOptions``. The result is a
+    /// compound of the pieces.
+    public func split(by tools: [Shape], options: BooleanOptions) -> Shape? {
+        guard !tools.isEmpty else { return nil }
+        return Shape.boolean(.split, objects: [self], tools: tools, options: options)
+    }
+
+    /// ``fuseAll(_:)`` with explicit ``BooleanOptions``.
+    public static func fuseAll(_ shapes: [Shape], options: BooleanOptions) -> Shape? {
+        guard shapes.count >= 2 else { return nil }
+        return boolean(.generalFuse, objects: shapes, tools: [], options: options)
+    }
+}
@@ -0,0 +1,65 @@
+import Foundation
+import OCCTBridge
+
+/// Several boolean results from one intersection pass over the same operands.
+///
+/// Intersecting the operands (OCCT's pave filler) is the expensive part of a boolean
+/// and does not depend on the operation. A session intersects once; each requested
+/// union, difference, intersection, section or split is then only the cheap build step.
+///
+/// ```swift
+/// let session = BooleanSession(objects: [body], tools: [pocket], options: .fast)!
+/// let kept    = session.result(.cut)
+/// let removed = session.result(.common)
+/// let seam    = session.result(.section)
+/// ```
+public final class BooleanSession: @unchecked Sendable {
+    internal let handle: OCCTBooleanSessionRef
+
+    /// Intersect `objects` against `tools` once.
+    ///
+    /// - Parameter options: Apply to the intersection and to every later build
+    /// - Returns: nil if `objects` is empty or the intersection fails or times out
+    public init?(objects: [Shape], tools: [Shape], options: BooleanOptions = BooleanOptions()) {
+        guard !objects.isEmpty else { return nil }
+        var opts = options.bridged
+        let objectRefs: [OCCTShapeRef?] = objects.map { $0.handle }
+        let toolRefs: [OCCTShapeRef?] = tools.map { $0.handle }
+        let session = objectRefs.withUnsafeBufferPointer { obj in
+            toolRefs.withUnsafeBufferPointer { tl in
+                OCCTBooleanSessionCreate(obj.baseAddress, Int32(objects.count),
+                                         tl.baseAddress, Int32(tools.count), &opts)
+            }
+        }
+        guard let session else { return nil }
+        self.handle = session
+    }
+
+    /// Two-operand convenience.
+    public convenience init?(_ object: Shape, _ tool: Shape, options: BooleanOptions = BooleanOptions()) {
+        self.init(objects: [object], tools: [tool], options: options)
+    }
+
+    deinit {
+        OCCTBooleanSessionRelease(handle)
+    }
+
+    /// Whether the intersection reported warnings (results may be incomplete).
+    public var hasWarnings: Bool { OCCTBooleanSessionHasWarnings(handle) }
+
+    /// Build one operation from the shared intersection data.
+    public func result(_ algorithm: Shape.BooleanAlgorithm) -> Shape? {
+        guard let h = OCCTBooleanSessionResult(handle, OCCTBooleanOp(rawValue: algorithm.rawValue)) else { return nil }
+        return Shape(handle: h)
+    }
+
+    /// ``result(_:)`` with per-input history. The history stays valid after the session
+    /// is released.
+    public func resultWithHistory(_ algorithm: Shape.BooleanAlgorithm) -> (result: Shape, history: ShapeHistoryRef)? {
+        var resultRef: OCCTShapeRef?
+        guard let history = OCCTBooleanSessionResultWithHistory(handle, OCCTBooleanOp(rawValue: algorithm.rawValue),
+                                                                &resultRef),
+              let resultRef else { return nil }
+        return (Shape(handle: resultRef), ShapeHistoryRef(history))
+    }
+}
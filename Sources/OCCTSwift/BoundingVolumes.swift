@@ -0,0 +1,89 @@
+import Foundation
+import simd
+import OCCTBridge
+
+/// Axis-aligned and oriented bounding volumes of one shape, from
+/// ``Shape/boundingVolumes(of:_:obbMode:useTriangulation:parallel:)``.
+public struct BoundingVolumes: Sendable {
+    /// Which volumes to compute.
+    public struct Kind: OptionSet, Sendable {
+        public let rawValue: UInt32
+        public init(rawValue: UInt32) { self.rawValue = rawValue }
+
+        public static let aabb        = Kind(rawValue: OCCTBoundingVolumeAABB.rawValue)
+        /// Tight axis-aligned box (`BRepBndLib::AddOptimal`).
+        public static let optimalAABB = Kind(rawValue: OCCTBoundingVolumeOptimalAABB.rawValue)
+        public static let obb         = Kind(rawValue: OCCTBoundingVolumeOBB.rawValue)
+        public static let all         = Kind(rawValue: OCCTBoundingVolumeAll.rawValue)
+    }
+
+    /// How oriented boxes are fitted.
+    public enum OBBMode: Sendable {
+        /// Principal-axis box (fast)
+        case pca
+        /// OCCT's optimal search over the whole shape (tightest, slowest)
+        case optimal
+        /// Optimal search over the convex-hull extremes of the mesh nodes; close to
+        /// `.optimal` at a fraction of the cost. Shapes without a mesh fall back to `.pca`.
+        case hull
+
+        var bridged: OCCTOBBMode {
+            switch self {
+            case .pca: return OCCTOBBModePCA
+            case .optimal: return OCCTOBBModeOptimal
+            case .hull: return OCCTOBBModeHull
+            }
+        }
+    }
+
+    public let aabb: (min: SIMD3<Double>, max: SIMD3<Double>)?
+    public let optimalAABB: (min: SIMD3<Double>, max: SIMD3<Double>)?
+    public let obb: OrientedBoundingBox?
+}
+
+extension Shape {
+    /// Compute bounding volumes for many shapes in one parallel pass.
+    ///
+    /// - Parameters:
+    ///   - shapes: Shapes to bound
+    ///   - kinds: Which volumes to compute
+    ///   - obbMode: How oriented boxes are fitted
+    ///   - useTriangulation: Use existing meshes when present (required by `.hull`)
+    ///   - parallel: Spread shapes over OCCT's thread pool
+    /// - Returns: One entry per shape; nil where nothing could be computed
+    public static func boundingVolumes(of shapes: [Shape], _ kinds: BoundingVolumes.Kind = .all,
+                                       obbMode: BoundingVolumes.OBBMode = .pca,
+                                       useTriangulation: Bool = true,
+                                       parallel: Bool = true) -> [BoundingVolumes?] {
+        guard !shapes.isEmpty else { return [] }
+        let handles: [OCCTShapeRef?] = shapes.map { $0.handle }
+        var raw = [OCCTBoundingVolumes](repeating: OCCTBoundingVolumes(), count: shapes.count)
+        let n = handles.withUnsafeBufferPointer { buf in
+            OCCTShapesComputeBoundingVolumes(buf.baseAddress!, Int32(shapes.count), kinds.rawValue,
+                                             obbMode.bridged, useTriangulation, &raw, parallel)
+        }
+        guard n >= 0 else { return Array(repeating: nil, count: shapes.count) }
+        return raw.map { r in
+            let valid = BoundingVolumes.Kind(rawValue: r.valid)
+            guard !valid.isEmpty else { return nil }
+            let o = r.obb
+            return BoundingVolumes(
+                aabb: valid.contains(.aabb)
+                    ? (SIMD3(r.aabbMin.0, r.aabbMin.1, r.aabbMin.2), SIMD3(r.aabbMax.0, r.aabbMax.1, r.aabbMax.2))
+                    : nil,
+                optimalAABB: valid.contains(.optimalAABB)
+                    ? (SIMD3(r.optimalMin.0, r.optimalMin.1, r.optimalMin.2),
+                       SIMD3(r.optimalMax.0, r.optimalMax.1, r.optimalMax.2))
+                    : nil,
+                obb: valid.contains(.obb)
+                    ? OrientedBoundingBox(
+                        center: SIMD3(o.centerX, o.centerY, o.centerZ),
+                        xDirection: SIMD3(o.xDirX, o.xDirY, o.xDirZ),
+                        yDirection: SIMD3(o.yDirX, o.yDirY, o.yDirZ),
+                        zDirection: SIMD3(o.zDirX, o.zDirY, o.zDirZ),
+                        halfSizes: SIMD3(o.halfX, o.halfY, o.halfZ))
+                    : nil
+            )
+        }
+    }
+}
@@ -0,0 +1,118 @@
+import Foundation
+import simd
+import OCCTBridge
+
+/// Minimum distance between two shapes under many relative placements.
+///
+/// ``ShapeDistance`` rebuilds `BRepExtrema_DistShapeShape` from scratch for every pair.
+/// The engine meshes and bounds both shapes once; each query places `shape2` with a rigid
+/// transform, finds the face pairs whose meshes could hold the minimum with a dual BVH
+/// traversal, and runs exact extrema on those pairs only. ``isCloser(than:placement:)``
+/// usually answers from the mesh bound alone.
+///
+/// Placements are 12-element row-major 3×4 matrices, as in ``Shape/located(matrix:)``,
+/// applied to `shape2` in `shape1`'s frame.
+///
+/// ## Example
+///
+/// ```swift
+/// let engine = DistanceEngine(gripper, fixture)!
+/// for pose in trajectory {
+///     if engine.isCloser(than: 0.5, placement: pose) == true { return .collision }
+/// }
+/// ```
+public final class DistanceEngine: @unchecked Sendable {
+    internal let handle: OCCTDistanceEngineRef
+
+    /// Closest points of one query, in `shape1`'s frame.
+    public struct Result: Sendable {
+        public let distance: Double
+        /// Face of `shape1` carrying ``point1`` (`subShape(type: .face, index:)`)
+        public let face1: Int
+        /// Face of `shape2` carrying ``point2``
+        public let face2: Int
+        public let point1: SIMD3<Double>
+        public let point2: SIMD3<Double>
+    }
+
+    /// Lifetime counters.
+    public struct Stats: Sendable {
+        public let queries: Int
+        /// Threshold queries decided without exact extrema
+        public let decidedByMesh: Int
+        /// Face pairs that needed exact extrema
+        public let exactFacePairs: Int
+    }
+
+    /// Preprocess two shapes.
+    ///
+    /// - Parameter deflection: Mesh deflection for the lower bound (nil = 0.5% of each
+    ///   shape's bounding-box diagonal). Results are exact regardless.
+    /// - Returns: nil if either shape has no faces
+    public init?(_ shape1: Shape, _ shape2: Shape, deflection: Double? = nil) {
+        guard let h = OCCTDistanceEngineCreate(shape1.handle, shape2.handle, deflection ?? 0) else { return nil }
+        self.handle = h
+    }
+
+    deinit {
+        OCCTDistanceEngineRelease(handle)
+    }
+
+    /// Exact minimum distance with `shape2` at `placement` (nil = as given).
+    public func distance(placement: [Double]? = nil) -> Result? {
+        if let placement, placement.count != 12 { return nil }
+        var r = OCCTDistanceResult()
+        let ok: Bool
+        if let placement {
+            ok = placement.withUnsafeBufferPointer { buf in
+                OCCTDistanceEngineCompute(handle, buf.baseAddress, &r)
+            }
+        } else {
+            ok = OCCTDistanceEngineCompute(handle, nil, &r)
+        }
+        guard ok else { return nil }
+        return Result(distance: r.distance, face1: Int(r.face1), face2: Int(r.face2),
+                      point1: SIMD3(r.x1, r.y1, r.z1), point2: SIMD3(r.x2, r.y2, r.z2))
+    }
+
+    /// Whether the shapes are closer than `threshold` with `shape2` at `placement`.
+    ///
+    /// - Returns: nil on failure (non-rigid placement, `threshold` ≤ 0)
+    public func isCloser(than threshold: Double, placement: [Double]? = nil) -> Bool? {
+        if let placement, placement.count != 12 { return nil }
+        let closer: Int32
+        if let placement {
+            closer = placement.withUnsafeBufferPointer { buf in
+                OCCTDistanceEngineIsCloserThan(handle, buf.baseAddress, threshold)
+            }
+        } else {
+            closer = OCCTDistanceEngineIsCloserThan(handle, nil, threshold)
+        }
+        switch closer {
+        case 1: return true
+        case 0: return false
+        default: return nil
+        }
+    }
+
+    /// Distances for many placements.
+    ///
+    /// - Parameter parallel: Spread placements over OCCT's thread pool
+    /// - Returns: One entry per placement; nil where the query failed
+    public func distances(placements: [[Double]], parallel: Bool = true) -> [Double?] {
+        guard !placements.isEmpty else { return [] }
+        guard placements.allSatisfy({ $0.count == 12 }) else {
+            return Array(repeating: nil, count: placements.count)
+        }
+        let flat = placements.flatMap { $0 }
+        var out = [Double](repeating: -1, count: placements.count)
+        OCCTDistanceEngineComputeBatch(handle, flat, Int32(placements.count), &out, parallel)
+        return out.map { $0 >= 0 ? $0 : nil }
+    }
+
+    public var stats: Stats {
+        let s = OCCTDistanceEngineGetStats(handle)
+        return Stats(queries: Int(s.queries), decidedByMesh: Int(s.decidedByMesh),
+                     exactFacePairs: Int(s.exactFacePairs))
+    }
+}
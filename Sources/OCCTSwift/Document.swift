@@ -12172,12 +12172,18 @@ extension Shape {
     }
 
     /// Add child shape into this shape using TopoDS_Builder.
+    ///
+    /// Edits this shape in place. Other `Shape` values sharing its topology — a shape this
+    /// one was taken from as a sub-shape, or sub-shapes taken from it — keep their old
+    /// sub-shape indices; fetch them again before using index-based calls.
     @discardableResult
     public func builderAdd(_ child: Shape) -> Bool {
         OCCTBuilderAdd(handle, child.handle)
     }
 
     /// Remove child shape from this shape using TopoDS_Builder.
+    ///
+    /// Edits in place, with the same caveat as ``builderAdd(_:)``.
     @discardableResult
     public func builderRemove(_ child: Shape) -> Bool {
         OCCTBuilderRemove(handle, child.handle)
@@ -12456,6 +12462,8 @@ extension Shape {
 extension Shape {
 
     /// Orient a closed solid so that face normals point outward.
+    ///
+    /// Edits in place, with the same caveat as ``builderAdd(_:)``.
     @discardableResult
     public func orientClosedSolid() -> Bool {
         OCCTBRepLibOrientClosedSolid(handle)
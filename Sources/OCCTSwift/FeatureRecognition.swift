@@ -65,6 +65,10 @@ public struct AAGEdge: Sendable {
 
     /// Number of shared edges between the faces
     public let sharedEdgeCount: Int
+
+    /// Interior dihedral angle at the shared edge, in radians
+    /// (< π convex, π smooth, > π concave)
+    public let dihedralAngle: Double
 }
 
 /// Attributed Adjacency Graph for feature recognition
@@ -87,14 +91,22 @@ public final class AAG: @unchecked Sendable {
     public private(set) var adjacencyList: [[Int: Int]] = []
 
     /// Create an AAG from a shape
-    public init(shape: Shape) {
+    ///
+    /// - Parameters:
+    ///   - shape: The shape to analyse
+    ///   - smoothAngle: Face normals closer than this (radians) make a smooth edge
+    ///   - parallel: Classify edge convexity on OCCT's thread pool
+    public init(shape: Shape, smoothAngle: Double = 0.01, parallel: Bool = true) {
         self.shape = shape
-        buildGraph()
+        buildGraph(smoothAngle: smoothAngle, parallel: parallel)
     }
 
-    private func buildGraph() {
-        let faces = shape.faces()
-        let faceCount = faces.count
+    private func buildGraph(smoothAngle: Double, parallel: Bool) {
+        // Nodes use the shape's face index map (``Shape/face(at:)``), the same indices
+        // the native pass reports arcs in; an explorer walk would repeat shared faces.
+        let faceCount = shape.subShapeCount(ofType: .face)
+        let faces = (0..<faceCount).compactMap { shape.face(at: $0) }
+        guard faces.count == faceCount else { return }
 
         // Initialize adjacency list
         adjacencyList = Array(repeating: [:], count: faceCount)
@@ -115,52 +127,35 @@ public final class AAG: @unchecked Sendable {
             nodes.append(node)
         }
 
-        // Build edges by checking all face pairs for adjacency
-        for i in 0..<faceCount {
-            for j in (i+1)..<faceCount {
-                let face1 = faces[i]
-                let face2 = faces[j]
-
-                // Check if adjacent
-                if OCCTFacesAreAdjacent(shape.handle, face1.handle, face2.handle) {
-                    // Get shared edge count and convexity
-                    var sharedEdges: [OCCTEdgeRef?] = Array(repeating: nil, count: 10)
-                    let edgeCount = OCCTFaceGetSharedEdges(
-                        shape.handle, face1.handle, face2.handle,
-                        &sharedEdges, 10
-                    )
-
-                    // Get convexity from first shared edge
-                    var convexity: EdgeConvexity = .smooth
-                    if edgeCount > 0, let firstEdge = sharedEdges[0] {
-                        let occtConvexity = OCCTEdgeGetConvexity(
-                            shape.handle, firstEdge,
-                            face1.handle, face2.handle
-                        )
-                        convexity = EdgeConvexity(fromOCCT: occtConvexity)
-
-                        // Release edges
-                        for k in 0..<Int(edgeCount) {
-                            if let edge = sharedEdges[k] {
-                                OCCTEdgeRelease(edge)
-                            }
-                        }
-                    }
-
-                    let edgeIndex = edges.count
-                    let edge = AAGEdge(
-                        face1Index: i,
-                        face2Index: j,
-                        convexity: convexity,
-                        sharedEdgeCount: Int(edgeCount)
-                    )
-                    edges.append(edge)
-
-                    // Update adjacency list (bidirectional)
-                    adjacencyList[i][j] = edgeIndex
-                    adjacencyList[j][i] = edgeIndex
-                }
-            }
+        // Adjacency, convexity and dihedral angles come from one native pass over
+        // the shape's edge→face incidences.
+        guard let data = OCCTShapeBuildAAG(shape.handle, smoothAngle, parallel) else { return }
+        defer { OCCTAAGDataRelease(data) }
+
+        let arcCount = Int(OCCTAAGDataArcCount(data))
+        guard arcCount > 0 else { return }
+        var arcFaces = [Int32](repeating: 0, count: 2 * arcCount)
+        var convexity = [Int32](repeating: 0, count: arcCount)
+        var angles = [Double](repeating: 0, count: arcCount)
+        var sharedEdges = [Int32](repeating: 0, count: arcCount)
+        OCCTAAGDataGetArcs(data, &arcFaces, &convexity, &angles, &sharedEdges)
+
+        edges.reserveCapacity(arcCount)
+        for a in 0..<arcCount {
+            let i = Int(arcFaces[2 * a]), j = Int(arcFaces[2 * a + 1])
+            guard i < faceCount, j < faceCount else { continue }
+            let edgeIndex = edges.count
+            edges.append(AAGEdge(
+                face1Index: i,
+                face2Index: j,
+                convexity: EdgeConvexity(rawValue: convexity[a]) ?? .smooth,
+                sharedEdgeCount: Int(sharedEdges[a]),
+                dihedralAngle: angles[a]
+            ))
+
+            // Update adjacency list (bidirectional)
+            adjacencyList[i][j] = edgeIndex
+            adjacencyList[j][i] = edgeIndex
         }
     }
 
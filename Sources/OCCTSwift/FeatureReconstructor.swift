@@ -190,7 +190,8 @@ public struct FeatureReconstructor: Sendable {
             case unresolvedRef(String)
             case unsupported(String)
         }
-        public enum Stage: String, Sendable { case additive, subtractive, finishing, annotation }
+        /// Evaluation stages, in evaluation order.
+        public enum Stage: String, Sendable, CaseIterable { case additive, subtractive, finishing, annotation }
         public let featureID: String
         public let reason: Reason
         public let stage: Stage
@@ -231,58 +232,47 @@ public struct FeatureReconstructor: Sendable {
             ctx.namedShapes[inputBodySentinel] = inputBody
         }
 
-        // Stage 1: additive
-        for spec in specs {
-            switch spec {
-            case .revolve(let r):
-                applyRevolve(r, ctx: &ctx)
-            case .extrude(let e):
-                applyExtrude(e, ctx: &ctx)
-            case .boolean(let b) where b.op == .union:
-                applyBoolean(b, stage: .additive, ctx: &ctx)
-            default: break
-            }
+        for stage in Skipped.Stage.allCases {
+            applyStage(stage, specs: specs, ctx: &ctx)
         }
 
-        // Stage 2: subtractive
-        for spec in specs {
-            switch spec {
-            case .hole(let h):
-                applyHole(h, ctx: &ctx)
-            case .boolean(let b) where b.op == .subtract || b.op == .intersect:
-                applyBoolean(b, stage: .subtractive, ctx: &ctx)
-            default: break
-            }
-        }
+        return BuildResult(shape: ctx.current, fulfilled: ctx.fulfilled,
+                           skipped: ctx.skipped, annotations: ctx.annotations,
+                           histories: ctx.histories)
+    }
 
-        // Stage 3: finishing
-        for spec in specs {
-            switch spec {
-            case .fillet(let f):
-                applyFillet(f, ctx: &ctx)
-            case .chamfer(let c):
-                applyChamfer(c, ctx: &ctx)
-            default: break
-            }
+    /// Stage a spec is evaluated in.
+    static func stage(of spec: FeatureSpec) -> Skipped.Stage {
+        switch spec {
+        case .revolve, .extrude:       return .additive
+        case .boolean(let b):          return b.op == .union ? .additive : .subtractive
+        case .hole:                    return .subtractive
+        case .fillet, .chamfer:        return .finishing
+        case .thread:                  return .annotation
         }
+    }
 
-        // Stage 4: annotation
-        for spec in specs {
-            if case .thread(let t) = spec {
+    /// Run one stage's specs, in order, one feature at a time.
+    static func applyStage(_ stage: Skipped.Stage, specs: [FeatureSpec], ctx: inout BuildContext) {
+        for spec in specs where self.stage(of: spec) == stage {
+            switch spec {
+            case .revolve(let r):  applyRevolve(r, ctx: &ctx)
+            case .extrude(let e):  applyExtrude(e, ctx: &ctx)
+            case .hole(let h):     applyHole(h, ctx: &ctx)
+            case .boolean(let b):  applyBoolean(b, stage: stage, ctx: &ctx)
+            case .fillet(let f):   applyFillet(f, ctx: &ctx)
+            case .chamfer(let c):  applyChamfer(c, ctx: &ctx)
+            case .thread(let t):
                 ctx.annotations.append(Annotation(
                     kind: .thread(spec: t.spec, holeRef: t.holeRef, length: t.length),
                     featureID: t.id ?? "thread"))
                 if let id = t.id { ctx.fulfilled.append(id) }
             }
         }
-
-        return BuildResult(shape: ctx.current, fulfilled: ctx.fulfilled,
-                           skipped: ctx.skipped, annotations: ctx.annotations,
-                           histories: ctx.histories)
     }
 
     /// Internal state carried through the staged dispatch.
-    fileprivate struct BuildContext {
+    struct BuildContext {
         var current: Shape? = nil
         var fulfilled: [String] = []
         var skipped: [Skipped] = []
@@ -296,15 +286,30 @@ public struct FeatureReconstructor: Sendable {
 
     // MARK: - Stage handlers
 
-    private static func applyRevolve(_ r: FeatureSpec.Revolve, ctx: inout BuildContext) {
+    /// Revolve profile in the XZ plane.
+    static func revolveProfile(_ r: FeatureSpec.Revolve) -> [SIMD3<Double>] {
+        r.profilePoints2D.map { SIMD3<Double>($0.x, 0, $0.y) }
+    }
+
+    /// Extrude profile placed on its sketch plane.
+    static func extrudeProfile(_ e: FeatureSpec.Extrude) -> [SIMD3<Double>] {
+        let placement = Placement(origin: e.planeOrigin, normal: e.planeNormal)
+        return e.profilePoints2D.map {
+            placement.origin + $0.x * placement.xAxis + $0.y * placement.yAxis
+        }
+    }
+
+    /// Drill depth when a hole spec leaves it open.
+    static let defaultHoleDepth = 100.0
+
+    static func applyRevolve(_ r: FeatureSpec.Revolve, ctx: inout BuildContext) {
         guard r.profilePoints2D.count >= 3 else {
             recordSkip(ctx: &ctx, id: r.id,
                        reason: .underDetermined("revolve profile needs ≥3 points"),
                        stage: .additive)
             return
         }
-        let pts3D = r.profilePoints2D.map { SIMD3<Double>($0.x, 0, $0.y) }
-        guard let wire = Wire.polygon3D(pts3D, closed: true) else {
+        guard let wire = Wire.polygon3D(revolveProfile(r), closed: true) else {
             recordSkip(ctx: &ctx, id: r.id,
                        reason: .occtFailure("wire construction failed"),
                        stage: .additive)
@@ -323,18 +328,14 @@ public struct FeatureReconstructor: Sendable {
         absorbAdditive(body, id: r.id, ctx: &ctx)
     }
 
-    private static func applyExtrude(_ e: FeatureSpec.Extrude, ctx: inout BuildContext) {
+    static func applyExtrude(_ e: FeatureSpec.Extrude, ctx: inout BuildContext) {
         guard e.profilePoints2D.count >= 3 else {
             recordSkip(ctx: &ctx, id: e.id,
                        reason: .underDetermined("extrude profile needs ≥3 points"),
                        stage: .additive)
             return
         }
-        let placement = Placement(origin: e.planeOrigin, normal: e.planeNormal)
-        let pts3D = e.profilePoints2D.map {
-            placement.origin + $0.x * placement.xAxis + $0.y * placement.yAxis
-        }
-        guard let wire = Wire.polygon3D(pts3D, closed: true) else {
+        guard let wire = Wire.polygon3D(extrudeProfile(e), closed: true) else {
             recordSkip(ctx: &ctx, id: e.id,
                        reason: .occtFailure("wire construction failed"),
                        stage: .additive)
@@ -351,14 +352,14 @@ public struct FeatureReconstructor: Sendable {
         absorbAdditive(body, id: e.id, ctx: &ctx)
     }
 
-    private static func applyHole(_ h: FeatureSpec.Hole, ctx: inout BuildContext) {
+    static func applyHole(_ h: FeatureSpec.Hole, ctx: inout BuildContext) {
         guard let target = ctx.current else {
             recordSkip(ctx: &ctx, id: h.id,
                        reason: .underDetermined("no target shape"),
                        stage: .subtractive)
             return
         }
-        let depth = h.depth ?? 100.0
+        let depth = h.depth ?? defaultHoleDepth
         guard let drill = Shape.cylinder(at: h.axisPoint,
                                           direction: h.axisDirection,
                                           radius: h.diameter / 2,
@@ -386,7 +387,7 @@ public struct FeatureReconstructor: Sendable {
         }
     }
 
-    private static func applyBoolean(_ b: FeatureSpec.Boolean,
+    static func applyBoolean(_ b: FeatureSpec.Boolean,
                                      stage: Skipped.Stage,
                                      ctx: inout BuildContext) {
         guard let left = ctx.namedShapes[b.leftID] else {
@@ -438,7 +439,7 @@ public struct FeatureReconstructor: Sendable {
         }
     }
 
-    private static func applyFillet(_ f: FeatureSpec.Fillet, ctx: inout BuildContext) {
+    static func applyFillet(_ f: FeatureSpec.Fillet, ctx: inout BuildContext) {
         guard let target = ctx.current else {
             recordSkip(ctx: &ctx, id: f.id,
                        reason: .underDetermined("no target shape"),
@@ -518,7 +519,7 @@ public struct FeatureReconstructor: Sendable {
         }
     }
 
-    private static func applyChamfer(_ c: FeatureSpec.Chamfer, ctx: inout BuildContext) {
+    static func applyChamfer(_ c: FeatureSpec.Chamfer, ctx: inout BuildContext) {
         guard let target = ctx.current else {
             recordSkip(ctx: &ctx, id: c.id,
                        reason: .underDetermined("no target shape"),
@@ -628,7 +629,7 @@ public struct FeatureReconstructor: Sendable {
 
     // MARK: - Utilities
 
-    private static func recordSkip(ctx: inout BuildContext,
+    static func recordSkip(ctx: inout BuildContext,
                                     id: String?,
                                     reason: Skipped.Reason,
                                     stage: Skipped.Stage) {
@@ -636,7 +637,7 @@ public struct FeatureReconstructor: Sendable {
         ctx.skipped.append(Skipped(featureID: id, reason: reason, stage: stage))
     }
 
-    private static func absorbAdditive(_ body: Shape, id: String?, ctx: inout BuildContext) {
+    static func absorbAdditive(_ body: Shape, id: String?, ctx: inout BuildContext) {
         // First additive feature → just seed `current` (no fusion happened).
         // Later additive features → fuse into existing current; capture history
         // when an id is set so selections originating in either operand can be
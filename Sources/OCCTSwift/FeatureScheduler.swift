@@ -0,0 +1,327 @@
+import Foundation
+import simd
+import OCCTBridge
+
+// MARK: - FeatureScheduler
+//
+// Batched, incremental evaluation of FeatureSpec lists, on top of the staged
+// dispatch in FeatureReconstructor. Same stages, same results; two changes in
+// how the work is done:
+//
+//   - Independent features are batched. An additive stage made only of
+//     revolves / extrudes, or a subtractive stage made only of holes, builds
+//     all of its tool bodies in one parallel bridge call
+//     (OCCTFeatureToolsBuild) and applies them with one multi-tool boolean,
+//     instead of one boolean per feature on an ever-growing shape. Stages
+//     that mix in named-shape booleans, and the finishing / annotation
+//     stages, run through FeatureReconstructor.applyStage unchanged.
+//
+//   - Results are cached along a dependency chain. Each stage's output is
+//     keyed by its own specs plus the stage it was built on, and each tool
+//     body by its spec. Rebuilding after an edit reuses every stage upstream
+//     of the edit and every tool body whose spec did not change.
+//
+// Cached shapes feed later booleans again, so every boolean here runs
+// non-destructively: OCCT never adjusts tolerances on a cached input in place.
+
+/// Batched, incremental feature evaluation.
+///
+/// Produces the same ``FeatureReconstructor/BuildResult`` as
+/// ``FeatureReconstructor/build(from:inputBody:)``. Keep one scheduler per edited
+/// part and call ``build(from:inputBody:parallel:)`` after every edit; only what
+/// the edit invalidates is rebuilt.
+///
+/// Batched features share one boolean, so every id in a batch maps to the same
+/// ``ShapeHistoryRef`` in ``FeatureReconstructor/BuildResult/histories``.
+///
+/// ```swift
+/// let scheduler = FeatureScheduler()
+/// var specs = part.features
+/// let first = scheduler.build(from: specs, inputBody: blank)
+/// specs[7] = .hole(movedHole)
+/// let second = scheduler.build(from: specs, inputBody: blank)   // re-cuts holes only
+/// ```
+public final class FeatureScheduler: @unchecked Sendable {
+    /// Work done by the last build.
+    public struct Statistics: Sendable, Equatable {
+        public var toolsBuilt = 0
+        public var toolsReused = 0
+        public var stagesBuilt = 0
+        public var stagesReused = 0
+    }
+
+    private typealias Stage = FeatureReconstructor.Skipped.Stage
+    private typealias BuildContext = FeatureReconstructor.BuildContext
+
+    private struct StageKey: Hashable {
+        let stage: Stage
+        let specs: [FeatureSpec]
+        let parent: Int
+    }
+
+    private struct StageNode {
+        let id: Int
+        let ctx: BuildContext
+    }
+
+    private let lock = NSLock()
+    private var tools: [FeatureSpec: Shape] = [:]
+    private var stages: [StageKey: StageNode] = [:]
+    private var rootBody: Shape?
+    private var rootID = 0
+    private var nextID = 1
+    private var statistics = Statistics()
+
+    public init() {}
+
+    /// Work done by the most recent ``build(from:inputBody:parallel:)``.
+    public var lastStatistics: Statistics {
+        lock.lock(); defer { lock.unlock() }
+        return statistics
+    }
+
+    /// Drop every cached stage and tool body.
+    public func invalidate() {
+        lock.lock(); defer { lock.unlock() }
+        tools.removeAll()
+        stages.removeAll()
+        rootBody = nil
+        rootID = nextID
+        nextID += 1
+    }
+
+    /// Evaluate `specs`, reusing whatever the previous build left valid.
+    ///
+    /// - Parameters:
+    ///   - inputBody: Starting body, as in ``FeatureReconstructor/build(from:inputBody:)``.
+    ///     Compared by identity: pass the same `Shape` instance to reuse cached stages.
+    ///   - parallel: Build tool bodies and booleans on OCCT's thread pool
+    public func build(from specs: [FeatureSpec], inputBody: Shape? = nil,
+                      parallel: Bool = true) -> FeatureReconstructor.BuildResult {
+        lock.lock(); defer { lock.unlock() }
+        statistics = Statistics()
+
+        if inputBody !== rootBody {
+            rootBody = inputBody
+            rootID = nextID
+            nextID += 1
+        }
+
+        var ctx = BuildContext()
+        if let inputBody {
+            ctx.current = inputBody
+            ctx.namedShapes[FeatureReconstructor.inputBodySentinel] = inputBody
+        }
+
+        // Only what this build touches survives into the next one.
+        var liveStages: [StageKey: StageNode] = [:]
+        var liveTools: [FeatureSpec: Shape] = [:]
+        var parent = rootID
+        for stage in Stage.allCases {
+            let stageSpecs = specs.filter { FeatureReconstructor.stage(of: $0) == stage }
+            let key = StageKey(stage: stage, specs: stageSpecs, parent: parent)
+            if let node = stages[key] {
+                ctx = node.ctx
+                statistics.stagesReused += 1
+                liveStages[key] = node
+                // A reused stage still owns its tool bodies for the next edit.
+                for spec in stageSpecs { if let t = tools[spec] { liveTools[spec] = t } }
+                parent = node.id
+                continue
+            }
+            apply(stage, specs: stageSpecs, ctx: &ctx, liveTools: &liveTools, parallel: parallel)
+            let node = StageNode(id: nextID, ctx: ctx)
+            nextID += 1
+            statistics.stagesBuilt += 1
+            liveStages[key] = node
+            parent = node.id
+        }
+        stages = liveStages
+        tools = liveTools
+
+        return FeatureReconstructor.BuildResult(shape: ctx.current, fulfilled: ctx.fulfilled,
+                                                skipped: ctx.skipped, annotations: ctx.annotations,
+                                                histories: ctx.histories)
+    }
+
+    // MARK: - Stages
+
+    private func options(parallel: Bool) -> BooleanOptions {
+        BooleanOptions(parallel: parallel, useOBB: parallel, nonDestructive: true)
+    }
+
+    private func apply(_ stage: Stage, specs: [FeatureSpec], ctx: inout BuildContext,
+                       liveTools: inout [FeatureSpec: Shape], parallel: Bool) {
+        switch stage {
+        case .additive where specs.count > 1 && specs.allSatisfy(isToolFeature):
+            applyAdditiveBatch(specs, ctx: &ctx, liveTools: &liveTools, parallel: parallel)
+        case .subtractive where specs.count > 1 && specs.allSatisfy(isToolFeature) && ctx.current != nil:
+            applyHoleBatch(specs, ctx: &ctx, liveTools: &liveTools, parallel: parallel)
+        default:
+            FeatureReconstructor.applyStage(stage, specs: specs, ctx: &ctx)
+        }
+    }
+
+    private func isToolFeature(_ spec: FeatureSpec) -> Bool {
+        switch spec {
+        case .revolve, .extrude, .hole: return true
+        default:                        return false
+        }
+    }
+
+    /// Revolves and extrudes: one fuse of every body into the current shape.
+    private func applyAdditiveBatch(_ specs: [FeatureSpec], ctx: inout BuildContext,
+                                    liveTools: inout [FeatureSpec: Shape], parallel: Bool) {
+        let bodies = toolBodies(specs, stage: .additive, ctx: &ctx, liveTools: &liveTools, parallel: parallel)
+        var operands = zip(bodies, specs).compactMap { body, spec in body.map { ($0, spec.id) } }
+        guard !operands.isEmpty else { return }
+
+        // With no input body the first feature seeds the shape, as in the sequential build.
+        if ctx.current == nil {
+            let (seed, id) = operands.removeFirst()
+            FeatureReconstructor.absorbAdditive(seed, id: id, ctx: &ctx)
+        }
+        guard !operands.isEmpty, let object = ctx.current else { return }
+
+        guard let r = Shape.booleanWithFullHistory(.fuse, objects: [object], tools: operands.map { $0.0 },
+                                                   options: options(parallel: parallel)) else {
+            // Batch failed as a whole: one union per feature, as in the sequential build.
+            for (body, id) in operands { FeatureReconstructor.absorbAdditive(body, id: id, ctx: &ctx) }
+            return
+        }
+        ctx.current = r.result
+        for (body, id) in operands {
+            guard let id else { continue }
+            ctx.fulfilled.append(id)
+            ctx.namedShapes[id] = body    // the feature's own body, not the fused result
+            ctx.histories[id] = r.history
+        }
+    }
+
+    /// Holes: one multi-tool cut of every drill.
+    private func applyHoleBatch(_ specs: [FeatureSpec], ctx: inout BuildContext,
+                                liveTools: inout [FeatureSpec: Shape], parallel: Bool) {
+        guard let target = ctx.current else { return }
+        let drills = toolBodies(specs, stage: .subtractive, ctx: &ctx, liveTools: &liveTools, parallel: parallel)
+        let built = drills.compactMap { $0 }
+        guard !built.isEmpty else { return }
+        guard let r = Shape.booleanWithFullHistory(.cut, objects: [target], tools: built,
+                                                   options: options(parallel: parallel)) else {
+            // Batch failed as a whole: one cut per hole, as in the sequential build.
+            for (drill, spec) in zip(drills, specs) where drill != nil {
+                if case .hole(let h) = spec { FeatureReconstructor.applyHole(h, ctx: &ctx) }
+            }
+            return
+        }
+        ctx.current = r.result
+        for (drill, spec) in zip(drills, specs) {
+            guard let id = spec.id, drill != nil else { continue }
+            ctx.fulfilled.append(id)
+            ctx.namedShapes[id] = r.result
+            ctx.histories[id] = r.history
+        }
+    }
+
+    // MARK: - Tool bodies
+
+    /// Tool body per spec, from the cache or built in one parallel bridge call.
+    /// Specs that cannot be built are recorded as skipped and come back nil.
+    private func toolBodies(_ specs: [FeatureSpec], stage: Stage, ctx: inout BuildContext,
+                            liveTools: inout [FeatureSpec: Shape],
+                            parallel: Bool) -> [Shape?] {
+        var bodies = [Shape?](repeating: nil, count: specs.count)
+        var pending: [(index: Int, tool: OCCTFeatureTool)] = []
+        var wires: [Wire] = []
+
+        for (i, spec) in specs.enumerated() {
+            if let cached = tools[spec] ?? liveTools[spec] {
+                bodies[i] = cached
+                liveTools[spec] = cached
+                statistics.toolsReused += 1
+                continue
+            }
+            switch toolDescriptor(spec) {
+            case .success(let (tool, wire)):
+                if let wire { wires.append(wire) }
+                pending.append((i, tool))
+            case .failure(let skip):
+                FeatureReconstructor.recordSkip(ctx: &ctx, id: spec.id, reason: skip.reason, stage: stage)
+            }
+        }
+
+        if !pending.isEmpty {
+            let descriptors = pending.map { $0.tool }
+            var out = [OCCTShapeRef?](repeating: nil, count: pending.count)
+            withExtendedLifetime(wires) {
+                _ = OCCTFeatureToolsBuild(descriptors, Int32(descriptors.count), &out, parallel)
+            }
+            for (k, p) in pending.enumerated() {
+                let spec = specs[p.index]
+                guard let h = out[k] else {
+                    FeatureReconstructor.recordSkip(ctx: &ctx, id: spec.id,
+                                                    reason: .occtFailure(failureMessage(spec)), stage: stage)
+                    continue
+                }
+                let body = Shape(handle: h)
+                bodies[p.index] = body
+                liveTools[spec] = body
+                statistics.toolsBuilt += 1
+            }
+        }
+        return bodies
+    }
+
+    private struct ToolSkip: Error {
+        let reason: FeatureReconstructor.Skipped.Reason
+    }
+
+    private func toolDescriptor(_ spec: FeatureSpec) -> Result<(OCCTFeatureTool, Wire?), ToolSkip> {
+        var tool = OCCTFeatureTool()
+        switch spec {
+        case .revolve(let r):
+            guard r.profilePoints2D.count >= 3 else {
+                return .failure(ToolSkip(reason: .underDetermined("revolve profile needs ≥3 points")))
+            }
+            guard let wire = Wire.polygon3D(FeatureReconstructor.revolveProfile(r), closed: true) else {
+                return .failure(ToolSkip(reason: .occtFailure("wire construction failed")))
+            }
+            tool.kind = OCCTFeatureToolRevolution
+            tool.profile = wire.handle
+            tool.origin = (r.axisOrigin.x, r.axisOrigin.y, r.axisOrigin.z)
+            tool.direction = (r.axisDirection.x, r.axisDirection.y, r.axisDirection.z)
+            tool.extent = r.angleDeg * .pi / 180
+            return .success((tool, wire))
+        case .extrude(let e):
+            guard e.profilePoints2D.count >= 3 else {
+                return .failure(ToolSkip(reason: .underDetermined("extrude profile needs ≥3 points")))
+            }
+            guard let wire = Wire.polygon3D(FeatureReconstructor.extrudeProfile(e), closed: true) else {
+                return .failure(ToolSkip(reason: .occtFailure("wire construction failed")))
+            }
+            let n = simd_normalize(e.planeNormal)
+            tool.kind = OCCTFeatureToolExtrusion
+            tool.profile = wire.handle
+            tool.direction = (n.x, n.y, n.z)
+            tool.extent = e.length
+            return .success((tool, wire))
+        case .hole(let h):
+            tool.kind = OCCTFeatureToolCylinder
+            tool.origin = (h.axisPoint.x, h.axisPoint.y, h.axisPoint.z)
+            tool.direction = (h.axisDirection.x, h.axisDirection.y, h.axisDirection.z)
+            tool.radius = h.diameter / 2
+            tool.extent = h.depth ?? FeatureReconstructor.defaultHoleDepth
+            return .success((tool, nil))
+        default:
+            return .failure(ToolSkip(reason: .unsupported("not a tool feature")))
+        }
+    }
+
+    private func failureMessage(_ spec: FeatureSpec) -> String {
+        switch spec {
+        case .revolve: return "revolve failed"
+        case .extrude: return "extrude failed"
+        case .hole:    return "drill cylinder failed"
+        default:       return "tool body failed"
+        }
+    }
+}
@@ -0,0 +1,119 @@
+import Foundation
+import OCCTBridge
+
+/// Faces or edges grouped by a quantized canonical key of their analytic geometry.
+///
+/// Planes, cylinders, cones, spheres and tori (for faces) and lines and circles (for edges)
+/// are reduced to a canonical form and quantized in cells of the linear and angular
+/// tolerance. Elements with the same group lie on the same geometry up to those tolerances
+/// — the same-domain candidates that `unified()` and ``TopologyGraph/deduplicate()`` look
+/// for — found in one hash pass rather than by comparing every pair.
+///
+/// Values that straddle a cell edge can land in neighbouring groups, so a group is a
+/// candidate set, not a proof.
+public struct GeometryGroups: Sendable {
+    /// Group of each element in index order; nil for elements without an analytic key.
+    public let groupIDs: [Int?]
+    /// Number of distinct groups.
+    public let groupCount: Int
+
+    /// Groups with at least two members, each listing element indices in ascending order.
+    public var candidates: [[Int]] {
+        var members = [[Int]](repeating: [], count: groupCount)
+        for (i, g) in groupIDs.enumerated() { if let g { members[g].append(i) } }
+        return members.filter { $0.count > 1 }
+    }
+
+    internal init?(_ fill: (UnsafeMutablePointer<Int32>?, UnsafeMutablePointer<Int32>?) -> Int32) {
+        let count = Int(fill(nil, nil))
+        guard count >= 0 else { return nil }
+        var raw = [Int32](repeating: -1, count: count)
+        var groups: Int32 = 0
+        if count > 0 {
+            guard raw.withUnsafeMutableBufferPointer({ fill($0.baseAddress, &groups) }) == count else { return nil }
+        }
+        groupIDs = raw.map { $0 >= 0 ? Int($0) : nil }
+        groupCount = Int(groups)
+    }
+}
+
+extension Shape {
+    /// Group faces by the canonical key of their surface.
+    ///
+    /// - Parameters:
+    ///   - linearTolerance: Cell size for positions and radii
+    ///   - angularTolerance: Cell size for axis directions and cone angles
+    ///   - parallel: Compute the keys on OCCT's thread pool
+    public func faceGeometryGroups(linearTolerance: Double = 1e-6, angularTolerance: Double = 1e-9,
+                                   parallel: Bool = true) -> GeometryGroups? {
+        GeometryGroups { out, count in
+            OCCTShapeGeometricHashFaces(handle, linearTolerance, angularTolerance, out, count, parallel)
+        }
+    }
+
+    /// Group edges by the canonical key of their 3D curve. Degenerated edges have no group.
+    public func edgeGeometryGroups(linearTolerance: Double = 1e-6, angularTolerance: Double = 1e-9,
+                                   parallel: Bool = true) -> GeometryGroups? {
+        GeometryGroups { out, count in
+            OCCTShapeGeometricHashEdges(handle, linearTolerance, angularTolerance, out, count, parallel)
+        }
+    }
+
+    /// ``unified(unifyEdges:unifyFaces:concatBSplines:)`` restricted by a geometric-hash pass.
+    ///
+    /// Top-level parts of a compound that share no edges go through UnifySameDomain one by
+    /// one, and only when the hash finds adjacent faces or chained edges that could merge;
+    /// the rest pass through untouched. Worthwhile on large assemblies where most parts are
+    /// already clean.
+    ///
+    /// - Returns: The unified shape and the number of parts that needed unifying, or nil on failure
+    public func unifiedHashed(unifyEdges: Bool = true,
+                              unifyFaces: Bool = true,
+                              concatBSplines: Bool = true,
+                              linearTolerance: Double = 1e-6,
+                              angularTolerance: Double = 1e-9,
+                              parallel: Bool = true) -> (shape: Shape, unifiedParts: Int)? {
+        var parts: Int32 = 0
+        guard let result = OCCTShapeUnifySameDomainHashed(handle, unifyEdges, unifyFaces, concatBSplines,
+                                                          linearTolerance, angularTolerance,
+                                                          &parts, parallel) else {
+            return nil
+        }
+        return (Shape(handle: result), Int(parts))
+    }
+}
+
+extension TopologyGraph {
+    /// Group graph faces by the canonical key of their surface. Removed faces have no group.
+    public func faceGeometryGroups(linearTolerance: Double = 1e-6, angularTolerance: Double = 1e-9,
+                                   parallel: Bool = true) -> GeometryGroups? {
+        GeometryGroups { out, count in
+            OCCTBRepGraphHashFaceSurfaces(handle, linearTolerance, angularTolerance, out, count, parallel)
+        }
+    }
+
+    /// Group graph edges by the canonical key of their 3D curve. Removed and curveless edges
+    /// have no group.
+    public func edgeGeometryGroups(linearTolerance: Double = 1e-6, angularTolerance: Double = 1e-9,
+                                   parallel: Bool = true) -> GeometryGroups? {
+        GeometryGroups { out, count in
+            OCCTBRepGraphHashEdgeCurves(handle, linearTolerance, angularTolerance, out, count, parallel)
+        }
+    }
+
+    /// ``deduplicate()`` that skips the full pass when the geometric hash shows nothing to
+    /// merge: all geometry analytic, no two distinct surfaces or curves with keys in the same
+    /// or a neighbouring cell, and no axis close enough to the sign threshold to flip.
+    ///
+    /// - Returns: The deduplication result and whether the full pass was skipped
+    @discardableResult
+    public func deduplicate(linearTolerance: Double,
+                            angularTolerance: Double = 1e-9) -> (result: DeduplicateResult, skipped: Bool) {
+        var skipped = false
+        let r = OCCTBRepGraphDeduplicateHashed(handle, linearTolerance, angularTolerance, &skipped)
+        return (DeduplicateResult(canonicalSurfaces: Int(r.canonicalSurfaces),
+                                  canonicalCurves: Int(r.canonicalCurves),
+                                  surfaceRewrites: Int(r.surfaceRewrites),
+                                  curveRewrites: Int(r.curveRewrites)), skipped)
+    }
+}
@@ -0,0 +1,114 @@
+import Foundation
+import simd
+import OCCTBridge
+
+/// All-pairs interference and clearance checking for an assembly.
+///
+/// Shapes are triangulated and bounded once at construction; each ``run(clearance:exact:useOBB:parallel:)``
+/// then goes broad phase (``AABBTree`` over the cached boxes, optional OBB filter),
+/// mid phase (`BRepExtrema_ShapeProximity` on the cached meshes) and, when `exact` is set,
+/// refines the overlapping faces with `BRepExtrema_DistShapeShape`. Pair tasks run in parallel.
+///
+/// Compared with calling ``Shape/proximityFaces(with:tolerance:deflection:)`` for every pair, the
+/// shapes are meshed once instead of once per pair, and far-apart pairs never reach the
+/// mesh test.
+///
+/// ## Example
+///
+/// ```swift
+/// let engine = InterferenceEngine(shapes: parts, deflection: 0.1)!
+/// for hit in engine.run(clearance: 0.5) ?? [] where hit.kind == .intersecting {
+///     print("part \(hit.shape1) clashes with part \(hit.shape2)")
+/// }
+/// ```
+public final class InterferenceEngine: @unchecked Sendable {
+    internal let handle: OCCTInterferenceEngineRef
+
+    /// Classification of a reported pair.
+    public enum Kind: Int32, Sendable {
+        /// Boundaries touch or cross.
+        case intersecting = 1
+        /// Apart, but closer than the requested clearance.
+        case clearance = 2
+        /// One shape lies entirely inside the other (a solid).
+        case contained = 3
+    }
+
+    /// One interfering or under-clearance pair, `shape1 < shape2`.
+    public struct Result: Sendable {
+        public let shape1: Int
+        public let shape2: Int
+        public let kind: Kind
+        /// Minimum distance (0 for intersecting / contained pairs).
+        public let distance: Double
+        /// Witness point on `shape1`.
+        public let point1: SIMD3<Double>
+        /// Witness point on `shape2`.
+        public let point2: SIMD3<Double>
+        /// Overlapping face pairs found by the mesh test.
+        public let facePairCount: Int
+        /// true when distance and witnesses come from the exact B-Rep, false for a mesh estimate.
+        public let isExact: Bool
+    }
+
+    /// Per-phase counters of the last run.
+    public struct Stats: Sendable {
+        /// AABB overlaps (boxes grown by the clearance).
+        public let broadPhasePairs: Int
+        /// Pairs dropped by the OBB test.
+        public let obbRejected: Int
+        /// Pairs with at least one face pair within tolerance on the mesh.
+        public let midPhasePairs: Int
+        public let reportedPairs: Int
+    }
+
+    /// Create an engine over `shapes`. Result indices refer to positions in this array.
+    ///
+    /// - Parameter deflection: Linear deflection used to triangulate shapes without a finer mesh
+    public init?(shapes: [Shape], deflection: Double = 0.1) {
+        // One nil slot keeps baseAddress non-nil for an empty input.
+        let handles: [OCCTShapeRef?] = shapes.isEmpty ? [nil] : shapes.map { $0.handle }
+        guard let h = handles.withUnsafeBufferPointer({ buf in
+            OCCTInterferenceEngineCreate(buf.baseAddress!, Int32(shapes.count), deflection)
+        }) else { return nil }
+        self.handle = h
+    }
+
+    deinit {
+        OCCTInterferenceEngineRelease(handle)
+    }
+
+    /// Find every pair that intersects, is contained, or is closer than `clearance`.
+    ///
+    /// - Parameters:
+    ///   - clearance: Required gap (0 reports only intersecting / contained pairs)
+    ///   - exact: Refine mesh hits on the B-Rep; otherwise distances are mesh estimates
+    ///   - useOBB: Add an oriented-box test after the axis-aligned broad phase
+    ///   - parallel: Run pair tasks on OCCT's thread pool
+    /// - Returns: Pairs sorted by `(shape1, shape2)` (empty when nothing interferes), or nil
+    ///   on error, e.g. a negative clearance
+    public func run(clearance: Double = 0, exact: Bool = true,
+                    useOBB: Bool = true, parallel: Bool = true) -> [Result]? {
+        let n = OCCTInterferenceEngineRun(handle, clearance, exact, useOBB, parallel)
+        guard n >= 0 else { return nil }
+        guard n > 0 else { return [] }
+        var raw = [OCCTInterferencePair](repeating: OCCTInterferencePair(), count: Int(n))
+        let written = Int(OCCTInterferenceEngineGetPairs(handle, &raw, n))
+        return raw.prefix(written).map { p in
+            Result(shape1: Int(p.shape1), shape2: Int(p.shape2),
+                   kind: Kind(rawValue: p.kind) ?? .intersecting,
+                   distance: p.distance,
+                   point1: SIMD3(p.p1.0, p.p1.1, p.p1.2),
+                   point2: SIMD3(p.p2.0, p.p2.1, p.p2.2),
+                   facePairCount: Int(p.facePairCount),
+                   isExact: p.exact)
+        }
+    }
+
+    /// Counters from the last ``run(clearance:exact:useOBB:parallel:)``.
+    public var stats: Stats {
+        let s = OCCTInterferenceEngineGetStats(handle)
+        return Stats(broadPhasePairs: Int(s.broadPhasePairs), obbRejected: Int(s.obbRejected),
+                     midPhasePairs: Int(s.midPhasePairs), reportedPairs: Int(s.reportedPairs))
+    }
+}
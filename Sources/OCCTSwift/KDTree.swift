@@ -28,6 +28,9 @@ import OCCTBridge
 public final class KDTree: @unchecked Sendable {
     internal let handle: OCCTKDTreeRef
 
+    /// Number of points the tree was built from.
+    public let count: Int
+
     /// Build a KD-tree from an array of 3D points.
     ///
     /// - Parameter points: The points to index
@@ -37,6 +40,7 @@ public final class KDTree: @unchecked Sendable {
         let coords = points.flatMap { [$0.x, $0.y, $0.z] }
         guard let h = OCCTKDTreeBuild(coords, Int32(points.count)) else { return nil }
         self.handle = h
+        self.count = points.count
     }
 
     deinit {
@@ -101,4 +105,69 @@ public final class KDTree: @unchecked Sendable {
                                          &indices, Int32(maxResults)))
         return (0..<n).map { Int(indices[$0]) }
     }
+
+    // MARK: - Point-Cloud Processing
+
+    /// Per-point normals and curvature from ``estimateNormals(k:viewpoint:)``.
+    public struct NormalEstimate: Sendable {
+        /// Unit normal per input point; `.zero` where the neighbourhood was degenerate.
+        public let normals: [SIMD3<Float>]
+        /// Surface variation λmin / (λ0 + λ1 + λ2) per point, in [0, 1/3];
+        /// `-1` where no normal could be estimated.
+        public let curvature: [Float]
+        /// Number of points that received a valid normal.
+        public let validCount: Int
+    }
+
+    /// Estimate a normal and curvature for every point by PCA of its k nearest neighbours.
+    ///
+    /// Runs in parallel across points on OCCT's thread pool.
+    ///
+    /// - Parameters:
+    ///   - k: Neighbourhood size, including the point itself (minimum 3)
+    ///   - viewpoint: If given, each normal is flipped to face this point (e.g. the scanner
+    ///     position). Without it the normal sign is arbitrary.
+    /// - Returns: Normals and curvature indexed like the tree's points, or nil on bad input
+    public func estimateNormals(k: Int = 16, viewpoint: SIMD3<Double>? = nil) -> NormalEstimate? {
+        guard k >= 3 else { return nil }
+        var flat = [Float](repeating: 0, count: count * 3)
+        var curvature = [Float](repeating: -1, count: count)
+        let valid: Int32
+        if let vp = viewpoint {
+            let eye = [vp.x, vp.y, vp.z]
+            valid = OCCTKDTreeEstimateNormals(handle, Int32(k), eye, &flat, &curvature)
+        } else {
+            valid = OCCTKDTreeEstimateNormals(handle, Int32(k), nil, &flat, &curvature)
+        }
+        guard valid >= 0 else { return nil }
+        let normals = (0..<count).map { SIMD3(flat[$0 * 3], flat[$0 * 3 + 1], flat[$0 * 3 + 2]) }
+        return NormalEstimate(normals: normals, curvature: curvature, validCount: Int(valid))
+    }
+
+    /// Statistical outlier removal.
+    ///
+    /// A point is an inlier when its mean distance to its `k` nearest neighbours is at most
+    /// `stdRatio` standard deviations above the mean over the whole cloud.
+    ///
+    /// - Returns: One flag per tree point (`true` = inlier), or nil on bad input
+    public func statisticalInliers(k: Int = 8, stdRatio: Double = 2.0) -> [Bool]? {
+        guard k >= 1, stdRatio >= 0 else { return nil }
+        var mask = [UInt8](repeating: 0, count: count)
+        guard OCCTKDTreeStatisticalOutliers(handle, Int32(k), stdRatio, &mask) >= 0 else { return nil }
+        return mask.map { $0 != 0 }
+    }
+
+    /// Voxel-grid downsampling: one centroid per occupied cube of edge `voxelSize`.
+    ///
+    /// Does not need a tree; output order follows the first point that hit each voxel.
+    ///
+    /// - Returns: Voxel centroids, or nil if `points` is empty or `voxelSize` is not positive
+    public static func voxelDownsample(_ points: [SIMD3<Double>], voxelSize: Double) -> [SIMD3<Float>]? {
+        guard !points.isEmpty, voxelSize > 0 else { return nil }
+        let coords = points.flatMap { [$0.x, $0.y, $0.z] }
+        var out = [Float](repeating: 0, count: points.count * 3)
+        let n = Int(OCCTPointSetVoxelDownsample(coords, Int32(points.count), voxelSize, &out, nil))
+        guard n >= 0 else { return nil }
+        return (0..<n).map { SIMD3(out[$0 * 3], out[$0 * 3 + 1], out[$0 * 3 + 2]) }
+    }
 }
@@ -0,0 +1,112 @@
+import Foundation
+import OCCTBridge
+
+/// Stable IDs for the sub-shapes of a shape as it goes through modelling operations.
+///
+/// Create the index on the starting shape, then call ``apply(_:result:)`` after each
+/// operation with the history it produced. An ID keeps pointing at its sub-shape through
+/// modifications, maps to several sub-shapes after a split and to none once deleted. New
+/// sub-shapes get fresh IDs that remember the ID they were generated from. Resolving an
+/// ID to a current sub-shape index is a hash lookup, so replaying a feature tree can turn
+/// thousands of recorded selectors into indices without any geometric search.
+///
+/// ## Example
+///
+/// ```swift
+/// let naming = NamingIndex(shape: block)!
+/// let topEdge = naming.id(of: .edge, index: 3)!
+/// let (cut, history) = block.subtractedWithFullHistory(slot)!
+/// naming.apply(history, result: cut)
+/// let edges = naming.resolve(topEdge)   // indices into cut.edges(), [] if the cut removed it
+/// ```
+public final class NamingIndex: @unchecked Sendable {
+    internal let handle: OCCTNamingIndexRef
+
+    /// A stable sub-shape ID.
+    public struct ID: Hashable, Sendable, Codable {
+        public let rawValue: Int64
+        public init(rawValue: Int64) { self.rawValue = rawValue }
+    }
+
+    /// Start tracking `shape`.
+    ///
+    /// - Parameter kinds: Sub-shape kinds to track
+    public init?(shape: Shape, kinds: Set<ShapeType> = [.face, .edge, .vertex]) {
+        let mask = kinds.reduce(UInt32(0)) { $1.rawValue >= 0 ? $0 | (1 << UInt32($1.rawValue)) : $0 }
+        guard mask != 0, let h = OCCTNamingIndexCreate(shape.handle, mask) else { return nil }
+        self.handle = h
+    }
+
+    deinit {
+        OCCTNamingIndexRelease(handle)
+    }
+
+    // MARK: - Updating
+
+    /// Fold an operation with a retained builder into the index; `result` becomes current.
+    @discardableResult
+    public func apply(_ history: ShapeHistoryRef, result: Shape) -> Bool {
+        OCCTNamingIndexApplyBuilderHistory(handle, history.handle, result.handle)
+    }
+
+    /// Fold a `BRepTools_History` into the index; `result` becomes current.
+    @discardableResult
+    public func apply(_ history: Shape.History, result: Shape) -> Bool {
+        OCCTNamingIndexApplyHistory(handle, history.historyRef, result.handle)
+    }
+
+    // MARK: - Queries
+
+    /// Number of IDs issued so far.
+    public var idCount: Int { Int(OCCTNamingIndexIDCount(handle)) }
+
+    /// The shape the IDs currently resolve against.
+    public var currentShape: Shape? {
+        OCCTNamingIndexCurrentShape(handle).map(Shape.init(handle:))
+    }
+
+    /// ID of current sub-shape `index` of `kind`.
+    public func id(of kind: ShapeType, index: Int) -> ID? {
+        let id = OCCTNamingIndexIDOf(handle, Int32(kind.rawValue), Int32(index))
+        return id > 0 ? ID(rawValue: id) : nil
+    }
+
+    /// IDs of all current sub-shapes of `kind`, in index order.
+    public func ids(of kind: ShapeType) -> [ID?] {
+        let n = Int(OCCTNamingIndexIDsOfKind(handle, Int32(kind.rawValue), nil))
+        guard n > 0 else { return [] }
+        var raw = [Int64](repeating: 0, count: n)
+        OCCTNamingIndexIDsOfKind(handle, Int32(kind.rawValue), &raw)
+        return raw.map { $0 > 0 ? ID(rawValue: $0) : nil }
+    }
+
+    /// Current sub-shape indices of an ID: several after a split, empty once deleted,
+    /// nil if the ID is unknown.
+    public func resolve(_ id: ID) -> [Int]? {
+        let n = OCCTNamingIndexResolve(handle, id.rawValue, nil, 0)
+        guard n >= 0 else { return nil }
+        var out = [Int32](repeating: 0, count: Int(n))
+        if n > 0 { OCCTNamingIndexResolve(handle, id.rawValue, &out, n) }
+        return out.map { Int($0) }
+    }
+
+    /// First current sub-shape index for each ID (nil if deleted or unknown).
+    public func resolveFirst(_ ids: [ID]) -> [Int?] {
+        guard !ids.isEmpty else { return [] }
+        var out = [Int32](repeating: -1, count: ids.count)
+        OCCTNamingIndexResolveFirst(handle, ids.map { $0.rawValue }, Int32(ids.count), &out)
+        return out.map { $0 >= 0 ? Int($0) : nil }
+    }
+
+    /// Kind of the sub-shapes an ID names.
+    public func kind(of id: ID) -> ShapeType? {
+        let k = OCCTNamingIndexKindOf(handle, id.rawValue)
+        return k >= 0 ? ShapeType(rawValue: Int(k)) : nil
+    }
+
+    /// ID that `id`'s sub-shape was generated from (e.g. the edge a fillet face came from).
+    public func parent(of id: ID) -> ID? {
+        let p = OCCTNamingIndexParentOf(handle, id.rawValue)
+        return p > 0 ? ID(rawValue: p) : nil
+    }
+}
@@ -0,0 +1,103 @@
+import Foundation
+import simd
+import OCCTBridge
+
+/// Approximate booleans on meshes, for interactive feedback while a tool is dragged.
+///
+/// Both solids are meshed and indexed once. Each ``compute(_:placement:refinement:parallel:)``
+/// places the tool with a rigid transform, classifies every triangle of each mesh against
+/// the other, and returns the triangles that bound the result. Triangles crossing the other
+/// surface are split a few times, so the seam is only as accurate as `refinement` allows,
+/// and the result is a triangle soup rather than a closed mesh. Run the exact boolean
+/// (e.g. `Shape.subtracting(_:)`) once the placement is final.
+///
+/// Placements are 12-element row-major 3×4 matrices, as in ``Shape/located(matrix:)``,
+/// applied to `tool` in `object`'s frame.
+///
+/// ## Example
+///
+/// ```swift
+/// let preview = PreviewBoolean(part, cutter)!
+/// // On every drag event:
+/// let mesh = preview.compute(.cut, placement: pose)
+/// // On mouse-up:
+/// let exact = part.subtracting(cutter.located(matrix: pose)!)
+/// ```
+public final class PreviewBoolean: @unchecked Sendable {
+    internal let handle: OCCTPreviewBooleanRef
+
+    /// Operations the preview supports.
+    public enum Operation: Sendable {
+        case union
+        case intersection
+        /// object − tool
+        case subtraction
+        /// tool − object
+        case reversedSubtraction
+
+        var bridged: OCCTBooleanOp {
+            switch self {
+            case .union: return OCCTBooleanOpFuse
+            case .intersection: return OCCTBooleanOpCommon
+            case .subtraction: return OCCTBooleanOpCut
+            case .reversedSubtraction: return OCCTBooleanOpCutReversed
+            }
+        }
+    }
+
+    /// Lifetime counters.
+    public struct Stats: Sendable {
+        public let queries: Int
+        /// Triangles decided by the bounding-box test alone
+        public let trianglesCulled: Int
+        /// Triangles classified whole
+        public let trianglesClassified: Int
+        /// Triangles that crossed the other surface and were refined
+        public let trianglesSplit: Int
+    }
+
+    /// Mesh and index both solids.
+    ///
+    /// - Parameter deflection: Mesh deflection (nil = 0.5% of each shape's bounding-box diagonal)
+    /// - Returns: nil unless both shapes mesh into closed triangle sets
+    public init?(_ object: Shape, _ tool: Shape, deflection: Double? = nil) {
+        guard let h = OCCTPreviewBooleanCreate(object.handle, tool.handle, deflection ?? 0) else { return nil }
+        self.handle = h
+    }
+
+    deinit {
+        OCCTPreviewBooleanRelease(handle)
+    }
+
+    /// Number of faces of the object. In results, a `faceIndex` below this is an object
+    /// face; tool face `j` appears as `objectFaceCount + j`.
+    public var objectFaceCount: Int { Int(OCCTPreviewBooleanObjectFaceCount(handle)) }
+
+    /// Approximate `object op tool` with the tool at `placement` (nil = as given).
+    ///
+    /// - Parameters:
+    ///   - refinement: Split levels (0–4) for triangles crossing the other surface
+    ///   - parallel: Classify triangles on OCCT's thread pool
+    /// - Returns: Mesh in the object's frame, or nil for a non-rigid placement
+    public func compute(_ operation: Operation, placement: [Double]? = nil,
+                        refinement: Int = 2, parallel: Bool = true) -> Mesh? {
+        if let placement, placement.count != 12 { return nil }
+        let h: OCCTMeshRef?
+        if let placement {
+            h = placement.withUnsafeBufferPointer { buf in
+                OCCTPreviewBooleanCompute(handle, operation.bridged, buf.baseAddress,
+                                          Int32(clamping: refinement), parallel)
+            }
+        } else {
+            h = OCCTPreviewBooleanCompute(handle, operation.bridged, nil, Int32(clamping: refinement), parallel)
+        }
+        guard let h else { return nil }
+        return Mesh(handle: h)
+    }
+
+    public var stats: Stats {
+        let s = OCCTPreviewBooleanGetStats(handle)
+        return Stats(queries: Int(s.queries), trianglesCulled: Int(s.trianglesCulled),
+                     trianglesClassified: Int(s.trianglesClassified), trianglesSplit: Int(s.trianglesSplit))
+    }
+}
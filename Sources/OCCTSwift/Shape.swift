@@ -491,6 +491,45 @@ public final class Shape: @unchecked Sendable {
         return Shape(handle: handle)
     }
 
+    /// Loft through many sections by resampling them, for stacks too long for
+    /// ``loft(profiles:solid:)`` (blades, threads: hundreds of sections).
+    ///
+    /// Each section is sampled at uniform arc length, start points and winding are lined
+    /// up, and one bicubic B-spline surface is skinned through the grid. Sampling,
+    /// alignment and the curve interpolations run in parallel. Sharp corners inside a
+    /// section are rounded to the sample spacing.
+    ///
+    /// - Parameters:
+    ///   - profiles: At least 2 wires, all closed or all open
+    ///   - solid: Cap the ends with planar faces (closed, planar sections only)
+    ///   - samples: Points per section; more follows the sections more closely
+    ///   - parallel: Run on OCCT's thread pool
+    /// - Returns: A solid, or the lofted face for open sections or `solid: false`
+    public static func loftResampled(profiles: [Wire], solid: Bool = true,
+                                     samples: Int = 64, parallel: Bool = true) -> Shape? {
+        guard profiles.count >= 2 else { return nil }
+        let handles: [OCCTWireRef] = profiles.map { $0.handle }
+        guard let handle = handles.withUnsafeBufferPointer({ buffer in
+            OCCTShapeCreateLoftResampled(buffer.baseAddress!, Int32(profiles.count), solid,
+                                         Int32(clamping: samples), parallel)
+        }) else { return nil }
+        return Shape(handle: handle)
+    }
+
+    /// Sweep `profile` along `spine` by lofting through `stations` placed copies of it.
+    ///
+    /// `profile` is given where the spine starts and is carried along a
+    /// rotation-minimizing frame, so it does not twist about the spine. See
+    /// ``loftResampled(profiles:solid:samples:parallel:)`` for the surface it builds.
+    public static func sweepResampled(profile: Wire, along spine: Wire, stations: Int = 100,
+                                      solid: Bool = true, samples: Int = 64,
+                                      parallel: Bool = true) -> Shape? {
+        guard let handle = OCCTShapeCreateSweepResampled(profile.handle, spine.handle,
+                                                         Int32(clamping: stations), solid,
+                                                         Int32(clamping: samples), parallel) else { return nil }
+        return Shape(handle: handle)
+    }
+
     // MARK: - Boolean Operations
 
     /// Glue mode for boolean operations (`BOPAlgo_GlueEnum`).
@@ -1589,12 +1628,26 @@ public final class Shape: @unchecked Sendable {
         return Shape(handle: h)
     }
 
+    /// How ``linearPattern(direction:spacing:count:mode:)`` and
+    /// ``circularPattern(axisPoint:axisDirection:count:angle:mode:)`` produce their instances.
+    public enum PatternMode: UInt32, Sendable {
+        /// Every instance is a deep copy of the geometry.
+        case copy = 0
+        /// Every instance is the original geometry under a different location. Memory
+        /// stays constant in the instance count; a 1,000-tooth pattern is one tooth.
+        case instanced = 1
+        /// Instanced, then fused into one shape by a single multi-argument boolean.
+        /// Disjoint instances skip the boolean.
+        case fused = 2
+    }
+
     /// Create a linear pattern of the shape
     ///
     /// - Parameters:
     ///   - direction: Direction of the pattern
     ///   - spacing: Distance between copies
     ///   - count: Number of copies (including original)
+    ///   - mode: Deep copies (default), shared-geometry instances, or a fused result
     ///
     /// - Returns: Compound containing all copies, or nil on failure
     ///
@@ -1604,10 +1657,12 @@ public final class Shape: @unchecked Sendable {
     /// let hole = Shape.cylinder(radius: 3, height: 10)
     /// let rowOfHoles = hole.linearPattern(direction: SIMD3(20, 0, 0), spacing: 20, count: 5)
     /// ```
-    public func linearPattern(direction: SIMD3<Double>, spacing: Double, count: Int) -> Shape? {
-        guard let handle = OCCTShapeLinearPattern(self.handle,
-                                                   direction.x, direction.y, direction.z,
-                                                   spacing, Int32(count)) else {
+    public func linearPattern(direction: SIMD3<Double>, spacing: Double, count: Int,
+                              mode: PatternMode = .copy) -> Shape? {
+        guard let handle = OCCTShapeLinearPatternEx(self.handle,
+                                                    direction.x, direction.y, direction.z,
+                                                    spacing, Int32(count),
+                                                    OCCTPatternMode(rawValue: mode.rawValue)) else {
             return nil
         }
         return Shape(handle: handle)
@@ -1629,6 +1684,7 @@ public final class Shape: @unchecked Sendable {
     ///   - axisDirection: Direction of the rotation axis
     ///   - count: Number of copies (including original)
     ///   - angle: Total angle to span in radians (0 for full circle)
+    ///   - mode: Deep copies (default), shared-geometry instances, or a fused result
     ///
     /// - Returns: Compound containing all copies, or nil on failure
     ///
@@ -1645,11 +1701,13 @@ public final class Shape: @unchecked Sendable {
     /// )
     /// let drilled = flange.subtracting(tools!)
     /// ```
-    public func circularPattern(axisPoint: SIMD3<Double>, axisDirection: SIMD3<Double>, count: Int, angle: Double = 0) -> Shape? {
-        guard let handle = OCCTShapeCircularPattern(self.handle,
-                                                     axisPoint.x, axisPoint.y, axisPoint.z,
-                                                     axisDirection.x, axisDirection.y, axisDirection.z,
-                                                     Int32(count), angle) else {
+    public func circularPattern(axisPoint: SIMD3<Double>, axisDirection: SIMD3<Double>, count: Int, angle: Double = 0,
+                                mode: PatternMode = .copy) -> Shape? {
+        guard let handle = OCCTShapeCircularPatternEx(self.handle,
+                                                      axisPoint.x, axisPoint.y, axisPoint.z,
+                                                      axisDirection.x, axisDirection.y, axisDirection.z,
+                                                      Int32(count), angle,
+                                                      OCCTPatternMode(rawValue: mode.rawValue)) else {
             return nil
         }
         return Shape(handle: handle)
@@ -1659,7 +1717,7 @@ public final class Shape: @unchecked Sendable {
     /// copies from this body in one operation.
     ///
     /// This is the feature-aware companion to
-    /// ``circularPattern(axisPoint:axisDirection:count:angle:)``. Where the plain
+    /// ``circularPattern(axisPoint:axisDirection:count:angle:mode:)``. Where the plain
     /// pattern duplicates the *body*, this one duplicates the *tool* `count` times
     /// around the axis and subtracts the resulting compound from `self`. It is the
     /// natural primitive for a bolt circle: build one hole tool, then pattern it.
@@ -1755,8 +1813,8 @@ public final class Shape: @unchecked Sendable {
 
     /// Get a sub-shape by type and 0-based index.
     ///
-    /// Uses `TopExp::MapShapes` to enumerate sub-shapes of the given type,
-    /// then returns the one at the specified index as a `Shape` handle.
+    /// Indices follow `TopExp::MapShapes` order. The map is built once per shape and
+    /// cached, so walking every sub-shape is linear rather than quadratic.
     ///
     /// - Parameters:
     ///   - type: The topological type (e.g., `.face`, `.edge`, `.vertex`)
@@ -1778,6 +1836,48 @@ public final class Shape: @unchecked Sendable {
         return (0..<count).compactMap { subShape(type: type, index: $0) }
     }
 
+    /// Bytes held by this shape's cached sub-shape index maps (estimate).
+    ///
+    /// Index-based calls — ``subShape(type:index:)``, fillet/chamfer by edge index,
+    /// adjacency queries — share these maps instead of rebuilding one per call.
+    public var indexCacheBytes: Int {
+        Int(OCCTShapeIndexCacheBytesForShape(handle))
+    }
+
+    /// Bytes held by the sub-shape index caches of all live shapes (estimate).
+    public static var indexCacheTotalBytes: Int {
+        Int(OCCTShapeIndexCacheBytes())
+    }
+
+    /// Free this shape's cached sub-shape index maps. They are rebuilt on the next
+    /// index-based call.
+    public func dropIndexCache() {
+        OCCTShapeIndexCacheDrop(handle)
+    }
+
+    /// Wrapper allocation counters of the bridge's handle pool.
+    public struct WrapperPoolStats: Sendable {
+        /// Shape/face/edge/wire wrappers allocated
+        public let allocations: Int
+        /// Allocations served from a recycled block
+        public let poolHits: Int
+        /// Wrappers released
+        public let releases: Int
+    }
+
+    /// Handle-pool counters since process start, or nil when the bridge was built
+    /// without `OCCT_WRAPPER_POOL_STATS` (set `OCCTSWIFT_POOL_STATS=1` when building).
+    public static var wrapperPoolStats: WrapperPoolStats? {
+        var allocations: Int64 = 0, hits: Int64 = 0, releases: Int64 = 0
+        guard OCCTWrapperPoolGetStats(&allocations, &hits, &releases) else { return nil }
+        return WrapperPoolStats(allocations: Int(allocations), poolHits: Int(hits), releases: Int(releases))
+    }
+
+    /// Return the calling thread's recycled wrapper blocks to the heap.
+    public static func trimWrapperPool() {
+        OCCTWrapperPoolTrim()
+    }
+
     // MARK: - Bounds
 
     /// Get the axis-aligned bounding box of the shape.
@@ -1865,6 +1965,70 @@ public final class Shape: @unchecked Sendable {
         return wires
     }
 
+    /// Cross-section of one level from ``sectionWires(atZ:tolerance:faces:parallel:)``.
+    public struct SectionLevel: Sendable {
+        /// Distance of the plane from the origin along the normal (the Z height for Z slices)
+        public let offset: Double
+        /// Contours at this level; empty where the plane misses the shape
+        public let wires: [Wire]
+        /// Planar faces bounded by ``wires`` (holes included), when requested
+        public let faces: Shape?
+    }
+
+    /// Section the shape at many Z heights in one pass.
+    ///
+    /// Equivalent to calling ``sectionWiresAtZ(_:tolerance:)`` per height, but face bounds
+    /// are computed once, each level only sections the faces that span it, and the levels
+    /// run concurrently.
+    ///
+    /// ## Example: Layer contours for printing
+    ///
+    /// ```swift
+    /// let layers = part.sectionWires(atZ: stride(from: 0.1, to: 50, by: 0.2).map { $0 })
+    /// for layer in layers where !layer.wires.isEmpty { ... }
+    /// ```
+    ///
+    /// - Parameters:
+    ///   - heights: Z levels, in any order; results follow the same order
+    ///   - tolerance: Tolerance for connecting edges into wires
+    ///   - faces: Also build the planar faces of each level
+    ///   - parallel: Section the levels on OCCT's thread pool
+    public func sectionWires(atZ heights: [Double], tolerance: Double = 1e-6,
+                             faces: Bool = false, parallel: Bool = true) -> [SectionLevel] {
+        sectionWires(origin: .zero, normal: SIMD3(0, 0, 1), offsets: heights,
+                     tolerance: tolerance, faces: faces, parallel: parallel)
+    }
+
+    /// Section the shape at many parallel planes in one pass.
+    ///
+    /// Plane `i` passes through `origin + offsets[i] · normalize(normal)`.
+    public func sectionWires(origin: SIMD3<Double>, normal: SIMD3<Double>, offsets: [Double],
+                             tolerance: Double = 1e-6, faces: Bool = false,
+                             parallel: Bool = true) -> [SectionLevel] {
+        guard !offsets.isEmpty else { return [] }
+        var counts = [Int32](repeating: 0, count: offsets.count)
+        var faceHandles = [OCCTShapeRef?](repeating: nil, count: offsets.count)
+        var total: Int32 = 0
+        let o = [origin.x, origin.y, origin.z], n = [normal.x, normal.y, normal.z]
+        let wireArray = faces
+            ? OCCTShapeSectionWiresAtLevels(handle, o, n, offsets, Int32(offsets.count), tolerance,
+                                            &counts, &faceHandles, &total, parallel)
+            : OCCTShapeSectionWiresAtLevels(handle, o, n, offsets, Int32(offsets.count), tolerance,
+                                            &counts, nil, &total, parallel)
+        // Wire objects take ownership of the handles; only the container is freed here.
+        defer { if let wireArray { OCCTFreeWireArrayOnly(wireArray) } }
+
+        var next = 0
+        return offsets.indices.map { l in
+            var wires: [Wire] = []
+            for _ in 0..<Int(counts[l]) {
+                if let w = wireArray?[next] { wires.append(Wire(handle: w)) }
+                next += 1
+            }
+            return SectionLevel(offset: offsets[l], wires: wires, faces: faceHandles[l].map { Shape(handle: $0) })
+        }
+    }
+
     /// Get points along an edge at the given index.
     ///
     /// Points are sampled uniformly along the edge curve from start to end.
@@ -4470,6 +4634,49 @@ extension Shape {
         guard let h = result else { return nil }
         return Shape(handle: h)
     }
+
+    /// Subtract many tools in one boolean pass.
+    ///
+    /// Equivalent to `tools.reduce(self) { $0 - $1 }`, but all tools go into a single
+    /// `BRepAlgoAPI_Cut` (run in parallel, OBB pre-filtering on), so each tool is intersected
+    /// with the object once instead of re-running a full boolean on a growing intermediate.
+    /// Drilling a plate with hundreds of holes is the typical case.
+    ///
+    /// - Parameters:
+    ///   - tools: Shapes to remove from `self`
+    ///   - fuzzyValue: Tolerance-based fuzzy value; `0` keeps OCCT's default
+    ///   - glue: Glue mode for coincident-face arguments. See ``BooleanGlue``.
+    ///   - timeout: Wall-clock bound in seconds; `0`/negative = unbounded
+    /// - Returns: The cut shape, or nil on failure or timeout
+    ///
+    /// ```swift
+    /// let holes = centers.compactMap { Shape.cylinder(at: $0, bottomZ: -1, radius: 2, height: 12) }
+    /// let plate = slab.subtracting(all: holes)
+    /// ```
+    public func subtracting(all tools: [Shape], fuzzyValue: Double = 0, glue: BooleanGlue = .off,
+                            timeout: Double = Shape.defaultBooleanTimeout) -> Shape? {
+        guard !tools.isEmpty else { return nil }
+        let handles: [OCCTShapeRef?] = tools.map { $0.handle }
+        let result = handles.withUnsafeBufferPointer { buffer in
+            OCCTShapeSubtractMulti(handle, buffer.baseAddress, Int32(tools.count), fuzzyValue, glue.rawValue, timeout)
+        }
+        guard let h = result else { return nil }
+        return Shape(handle: h)
+    }
+
+    /// The part of this shape inside any of `tools`, computed in one boolean pass.
+    ///
+    /// Same options as ``subtracting(all:fuzzyValue:glue:timeout:)``.
+    public func intersection(any tools: [Shape], fuzzyValue: Double = 0, glue: BooleanGlue = .off,
+                             timeout: Double = Shape.defaultBooleanTimeout) -> Shape? {
+        guard !tools.isEmpty else { return nil }
+        let handles: [OCCTShapeRef?] = tools.map { $0.handle }
+        let result = handles.withUnsafeBufferPointer { buffer in
+            OCCTShapeCommonMultiTool(handle, buffer.baseAddress, Int32(tools.count), fuzzyValue, glue.rawValue, timeout)
+        }
+        guard let h = result else { return nil }
+        return Shape(handle: h)
+    }
 }
 
 // MARK: - Multi-Offset Wire (v0.35.0)
@@ -4674,9 +4881,9 @@ public struct ShapeHistoryRecord: Sendable {
 /// selection IDs across boolean / split mutations (e.g. OCCTMCP's
 /// `remap_selection`, parametric editors that want feature replay).
 public final class ShapeHistoryRef: @unchecked Sendable {
-    fileprivate let handle: OCCTBooleanHistoryRef
+    internal let handle: OCCTBooleanHistoryRef
 
-    fileprivate init(_ handle: OCCTBooleanHistoryRef) {
+    internal init(_ handle: OCCTBooleanHistoryRef) {
         self.handle = handle
     }
 
@@ -6525,9 +6732,9 @@ extension Shape {
                 if let edgeRef = OCCTShapeGetEdgeAtIndex(ref, 0) {
                     edges.append(Edge(handle: edgeRef, index: i))
                 }
-                OCCTShapeRelease(ref)
             }
         }
+        OCCTShapeReleaseArray(&buffer, count)
         return edges
     }
 
@@ -6549,9 +6756,9 @@ extension Shape {
                 if let edgeRef = OCCTShapeGetEdgeAtIndex(ref, 0) {
                     edges.append(Edge(handle: edgeRef, index: i))
                 }
-                OCCTShapeRelease(ref)
             }
         }
+        OCCTShapeReleaseArray(&buffer, count)
         return edges
     }
 
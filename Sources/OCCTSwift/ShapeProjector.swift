@@ -0,0 +1,81 @@
+import Foundation
+import simd
+import OCCTBridge
+
+/// Projects many points onto a shape, reusing one preprocessed copy of it.
+///
+/// The shape is meshed once and its face triangles are put in a BVH. For each point the
+/// BVH narrows the search to the faces whose mesh could still hold the closest point, and
+/// only those are solved exactly (`Extrema_GenExtPS`, initialised once per face and
+/// worker). Points are spread over OCCT's thread pool.
+///
+/// ## Example
+///
+/// ```swift
+/// let projector = ShapeProjector(shape: part)!
+/// for hit in projector.project(scanPoints) where hit != nil {
+///     print(hit!.distance, hit!.faceIndex)
+/// }
+/// ```
+public final class ShapeProjector: @unchecked Sendable {
+    internal let handle: OCCTShapeProjectorRef
+
+    /// Closest point of the shape to one query point.
+    public struct Projection: Sendable {
+        /// Distance from the query point to ``point``
+        public let distance: Double
+        /// Face index (`subShape(type: .face, index:)`)
+        public let faceIndex: Int
+        /// Surface parameters of ``point`` on that face
+        public let uv: SIMD2<Double>
+        /// Foot point on the shape
+        public let point: SIMD3<Double>
+        /// True if the closest point lies on the face boundary rather than its interior
+        public let onBoundary: Bool
+    }
+
+    /// Preprocess a shape for projection.
+    ///
+    /// - Parameter deflection: Mesh deflection used for candidate selection
+    ///   (nil = 0.5% of the bounding-box diagonal). Results are exact regardless;
+    ///   a coarser mesh only widens the candidate set.
+    public init?(shape: Shape, deflection: Double? = nil) {
+        guard let h = OCCTShapeProjectorCreate(shape.handle, deflection ?? 0) else { return nil }
+        self.handle = h
+    }
+
+    deinit {
+        OCCTShapeProjectorRelease(handle)
+    }
+
+    /// Number of faces of the shape.
+    public var faceCount: Int { Int(OCCTShapeProjectorFaceCount(handle)) }
+
+    /// Project points onto the shape.
+    ///
+    /// - Parameters:
+    ///   - points: Query points
+    ///   - maxDistance: Points farther than this get nil (nil = unlimited)
+    ///   - parallel: Use OCCT's thread pool
+    /// - Returns: One entry per point; nil where no projection was found
+    public func project(_ points: [SIMD3<Double>], maxDistance: Double? = nil,
+                        parallel: Bool = true) -> [Projection?] {
+        guard !points.isEmpty else { return [] }
+        let coords = points.flatMap { [$0.x, $0.y, $0.z] }
+        var raw = [OCCTPointProjection](repeating: OCCTPointProjection(), count: points.count)
+        guard OCCTShapeProjectorProject(handle, coords, Int32(points.count), maxDistance ?? 0,
+                                        &raw, parallel) >= 0 else {
+            return Array(repeating: nil, count: points.count)
+        }
+        return raw.map { r in
+            guard r.status >= 0, r.face >= 0 else { return nil }
+            return Projection(distance: r.distance, faceIndex: Int(r.face), uv: SIMD2(r.u, r.v),
+                              point: SIMD3(r.x, r.y, r.z), onBoundary: r.status == 1)
+        }
+    }
+
+    /// Project one point onto the shape.
+    public func project(_ point: SIMD3<Double>, maxDistance: Double? = nil) -> Projection? {
+        project([point], maxDistance: maxDistance, parallel: false)[0]
+    }
+}
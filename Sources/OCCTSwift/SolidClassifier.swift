@@ -0,0 +1,75 @@
+import Foundation
+import simd
+import OCCTBridge
+
+/// A point-in-solid classifier that is built once and reused for many points.
+///
+/// ``Shape/classify(point:tolerance:)`` rebuilds OCCT's solid explorer (face bounding-box
+/// tree and face intersectors) for every call. `SolidClassifier` keeps those explorers
+/// alive, one per worker thread, and classifies point arrays in parallel.
+///
+/// With a `meshDeflection`, a closed triangulation is also indexed for a ray-parity fast
+/// path. Points the mesh can't decide — near the surface, or with the ray through a mesh
+/// edge — go to the exact classifier, so results match the exact classifier.
+///
+/// ## Example
+///
+/// ```swift
+/// let classifier = SolidClassifier(shape: part, meshDeflection: 0.05)!
+/// let states = classifier.classify(gridPoints)
+/// let inside = states.filter { $0 == .inside }.count
+/// ```
+public final class SolidClassifier: @unchecked Sendable {
+    internal let handle: OCCTSolidClassifierRef
+
+    /// Create a classifier for `shape` (normally a solid).
+    ///
+    /// - Parameters:
+    ///   - tolerance: Distance within which a point counts as ``PointClassification/onBoundary``
+    ///   - meshDeflection: Triangulate the shape with this deflection and enable the
+    ///     ray-parity fast path; nil uses only the exact classifier
+    public init?(shape: Shape, tolerance: Double = 1e-6, meshDeflection: Double? = nil) {
+        guard let h = OCCTSolidClassifierCreate(shape.handle, tolerance, meshDeflection ?? 0) else {
+            return nil
+        }
+        self.handle = h
+    }
+
+    deinit {
+        OCCTSolidClassifierRelease(handle)
+    }
+
+    /// Whether the ray-parity fast path is available (the shape produced a closed mesh).
+    public var hasMeshPath: Bool {
+        OCCTSolidClassifierHasMeshPath(handle)
+    }
+
+    /// Classify one point with the exact classifier.
+    public func classify(_ point: SIMD3<Double>) -> PointClassification {
+        let state = OCCTSolidClassifierClassify(handle, point.x, point.y, point.z)
+        return PointClassification(rawValue: state) ?? .unknown
+    }
+
+    /// Classify many points.
+    ///
+    /// - Parameters:
+    ///   - points: Points to classify
+    ///   - useMesh: Try the ray-parity fast path first when available
+    ///   - parallel: Split the points over OCCT's thread pool
+    /// - Returns: One state per point (empty on error)
+    public func classify(_ points: [SIMD3<Double>], useMesh: Bool = true,
+                         parallel: Bool = true) -> [PointClassification] {
+        classifyCounted(points, useMesh: useMesh, parallel: parallel)?.states ?? []
+    }
+
+    /// Like ``classify(_:useMesh:parallel:)``, also returning how many points the fast path decided.
+    public func classifyCounted(_ points: [SIMD3<Double>], useMesh: Bool = true,
+                                parallel: Bool = true) -> (states: [PointClassification], meshDecided: Int)? {
+        guard !points.isEmpty else { return ([], 0) }
+        let flat = points.flatMap { [$0.x, $0.y, $0.z] }
+        var raw = [Int32](repeating: 3, count: points.count)
+        let n = OCCTSolidClassifierClassifyPoints(handle, flat, Int32(points.count), &raw, useMesh, parallel)
+        guard n >= 0 else { return nil }
+        return (raw.map { PointClassification(rawValue: $0) ?? .unknown }, Int(n))
+    }
+}
@@ -0,0 +1,90 @@
+import Foundation
+import OCCTBridge
+
+// Fillet with a radius ladder: instead of failing wholesale when one edge chain can't take
+// the requested radius (and retrying smaller radii one call at a time), every independent
+// group of edges tries every radius concurrently and keeps the largest one that works.
+
+extension Shape {
+    /// Outcome for one edge passed to ``filletedSpeculatively(edgeIndices:radii:parallel:)``.
+    public struct FilletEdgeReport: Sendable {
+        public enum Status: Int32, Sendable {
+            /// Filleted at the first (preferred) radius
+            case filleted = 0
+            /// Filleted at a later radius of the ladder
+            case reduced = 1
+            /// No radius of the ladder worked for the edge's group
+            case failed = 2
+            /// Edge index out of range
+            case invalid = 3
+        }
+
+        /// Edge index as passed in
+        public let edgeIndex: Int
+        public let status: Status
+        /// Independent group the edge was solved in. Edges of one tangent chain, and chains
+        /// meeting at a vertex, share a group and always get the same radius.
+        public let group: Int?
+        /// Applied radius, nil if the edge was not filleted
+        public let radius: Double?
+    }
+
+    /// Result of a speculative fillet.
+    public struct SpeculativeFillet: Sendable {
+        /// The shape with every achievable group filleted, nil if no group could be filleted
+        public let shape: Shape?
+        /// One report per requested edge, in request order
+        public let edges: [FilletEdgeReport]
+
+        /// True when every edge was filleted at the preferred radius.
+        public var isComplete: Bool { edges.allSatisfy { $0.status == .filleted } }
+    }
+
+    /// Fillet edges, falling back along a radius ladder per independent edge group.
+    ///
+    /// The edges are split into groups that OCCT can fillet independently. Every
+    /// (group, radius) pair is tried on its own copy of the shape on OCCT's thread pool;
+    /// each group keeps the first radius of `radii` that yields a valid shape, and the
+    /// groups are then filleted together. Groups whose blends collide with earlier ones
+    /// are dropped and reported as ``FilletEdgeReport/Status-swift.enum/failed``.
+    ///
+    /// - Parameters:
+    ///   - edgeIndices: Edge indices (as in `subShape(type: .edge, index:)`)
+    ///   - radii: Radius ladder in order of preference, all > 0
+    ///   - parallel: Run the trials on OCCT's thread pool
+    public func filletedSpeculatively(edgeIndices: [Int], radii: [Double],
+                                      parallel: Bool = true) -> SpeculativeFillet {
+        guard !edgeIndices.isEmpty, !radii.isEmpty, radii.allSatisfy({ $0 > 0 }) else {
+            return SpeculativeFillet(shape: nil, edges: edgeIndices.map {
+                FilletEdgeReport(edgeIndex: $0, status: .failed, group: nil, radius: nil)
+            })
+        }
+        let indices = edgeIndices.map { Int32(clamping: $0) }
+        var raw = [OCCTFilletEdgeReport](repeating: OCCTFilletEdgeReport(), count: indices.count)
+        let result = OCCTShapeFilletEdgesSpeculative(handle, indices, Int32(indices.count),
+                                                     radii, Int32(radii.count), &raw, parallel)
+        let reports = zip(edgeIndices, raw).map { index, r in
+            FilletEdgeReport(edgeIndex: index,
+                             status: FilletEdgeReport.Status(rawValue: r.status) ?? .failed,
+                             group: r.group >= 0 ? Int(r.group) : nil,
+                             radius: r.rung >= 0 ? r.radius : nil)
+        }
+        return SpeculativeFillet(shape: result.map { Shape(handle: $0) }, edges: reports)
+    }
+
+    /// Fillet edges at `radius`, falling back to `radius × factor` for each factor in turn
+    /// where a group of edges can't take the full radius.
+    ///
+    /// - Parameters:
+    ///   - edges: Edges of this shape
+    ///   - radius: Preferred radius
+    ///   - fallbackFactors: Multipliers tried after the full radius, largest first
+    ///   - parallel: Run the trials on OCCT's thread pool
+    public func filletedSpeculatively(edges: [Edge], radius: Double,
+                                      fallbackFactors: [Double] = [0.75, 0.5, 0.25],
+                                      parallel: Bool = true) -> SpeculativeFillet {
+        filletedSpeculatively(edgeIndices: edges.map(\.index),
+                              radii: [radius] + fallbackFactors.map { radius * $0 },
+                              parallel: parallel)
+    }
+}
@@ -0,0 +1,123 @@
+import Foundation
+import simd
+import OCCTBridge
+
+// Whole-shape per-face / per-edge property queries, evaluated in one bridge call on
+// OCCT's thread pool instead of one call per face or edge.
+
+extension Shape {
+    /// Face properties to compute in ``faceProperties(_:areaTolerance:parallel:)``.
+    public struct FaceQuery: OptionSet, Sendable {
+        public let rawValue: UInt32
+        public init(rawValue: UInt32) { self.rawValue = rawValue }
+
+        public static let surfaceType = FaceQuery(rawValue: OCCTFaceQuerySurfaceType.rawValue)
+        public static let uvBounds    = FaceQuery(rawValue: OCCTFaceQueryUVBounds.rawValue)
+        public static let area        = FaceQuery(rawValue: OCCTFaceQueryArea.rawValue)
+        /// Point and normal at the centre of the face's UV box.
+        public static let normal      = FaceQuery(rawValue: OCCTFaceQueryNormal.rawValue)
+        /// Principal curvature range over a 5×5 UV grid.
+        public static let curvature   = FaceQuery(rawValue: OCCTFaceQueryCurvature.rawValue)
+        public static let axis        = FaceQuery(rawValue: OCCTFaceQueryAxis.rawValue)
+        public static let tolerance   = FaceQuery(rawValue: OCCTFaceQueryTolerance.rawValue)
+        public static let all         = FaceQuery(rawValue: OCCTFaceQueryAll.rawValue)
+    }
+
+    /// Properties of one face. Fields not requested (or not computable) are nil.
+    public struct FaceProperties: Sendable {
+        public let surfaceType: Face.SurfaceType?
+        public let uvBounds: (uMin: Double, uMax: Double, vMin: Double, vMax: Double)?
+        public let area: Double?
+        /// Surface point at the centre of the UV box
+        public let point: SIMD3<Double>?
+        /// Unit normal at ``point``, face orientation applied
+        public let normal: SIMD3<Double>?
+        /// Smallest minimum and largest maximum principal curvature over the samples
+        public let curvatureRange: ClosedRange<Double>?
+        public let axis: ShapeAxis?
+        public let tolerance: Double?
+    }
+
+    /// Compute properties of every face in one parallel pass.
+    ///
+    /// Result `i` describes face `i` in index order (`subShape(type: .face, index: i)`).
+    ///
+    /// - Parameters:
+    ///   - queries: Which properties to compute
+    ///   - areaTolerance: Relative tolerance for the area integration
+    ///   - parallel: Spread faces over OCCT's thread pool
+    public func faceProperties(_ queries: FaceQuery = .all, areaTolerance: Double = 1e-6,
+                               parallel: Bool = true) -> [FaceProperties] {
+        let count = Int(OCCTShapeQueryFaces(handle, queries.rawValue, areaTolerance, nil, parallel))
+        guard count > 0 else { return [] }
+        var raw = [OCCTFaceQueryResult](repeating: OCCTFaceQueryResult(), count: count)
+        guard OCCTShapeQueryFaces(handle, queries.rawValue, areaTolerance, &raw, parallel) == count else { return [] }
+        return raw.map { r in
+            let valid = FaceQuery(rawValue: r.valid)
+            return FaceProperties(
+                surfaceType: valid.contains(.surfaceType) ? Face.SurfaceType(rawValue: r.surfaceType) ?? .other : nil,
+                uvBounds: valid.contains(.uvBounds) ? (r.uMin, r.uMax, r.vMin, r.vMax) : nil,
+                area: valid.contains(.area) ? r.area : nil,
+                point: valid.contains(.normal) ? SIMD3(r.px, r.py, r.pz) : nil,
+                normal: valid.contains(.normal) ? SIMD3(r.nx, r.ny, r.nz) : nil,
+                curvatureRange: valid.contains(.curvature) ? r.minCurvature...r.maxCurvature : nil,
+                axis: valid.contains(.axis) ? ShapeAxis.Kind(rawValue: r.axisKind).map {
+                    ShapeAxis(origin: SIMD3(r.ox, r.oy, r.oz), direction: SIMD3(r.dx, r.dy, r.dz), kind: $0)
+                } : nil,
+                tolerance: valid.contains(.tolerance) ? r.tolerance : nil
+            )
+        }
+    }
+
+    /// Edge properties to compute in ``edgeProperties(_:parallel:)``.
+    public struct EdgeQuery: OptionSet, Sendable {
+        public let rawValue: UInt32
+        public init(rawValue: UInt32) { self.rawValue = rawValue }
+
+        public static let curveType = EdgeQuery(rawValue: OCCTEdgeQueryCurveType.rawValue)
+        public static let range     = EdgeQuery(rawValue: OCCTEdgeQueryRange.rawValue)
+        public static let length    = EdgeQuery(rawValue: OCCTEdgeQueryLength.rawValue)
+        /// Start, end, midpoint and unit tangent at the midpoint.
+        public static let points    = EdgeQuery(rawValue: OCCTEdgeQueryPoints.rawValue)
+        public static let tolerance = EdgeQuery(rawValue: OCCTEdgeQueryTolerance.rawValue)
+        public static let all       = EdgeQuery(rawValue: OCCTEdgeQueryAll.rawValue)
+    }
+
+    /// Properties of one edge. Fields not requested (or not computable) are nil.
+    public struct EdgeProperties: Sendable {
+        public let isDegenerated: Bool
+        public let curveType: Edge.CurveType?
+        public let range: ClosedRange<Double>?
+        public let length: Double?
+        public let start: SIMD3<Double>?
+        public let end: SIMD3<Double>?
+        public let midpoint: SIMD3<Double>?
+        public let midTangent: SIMD3<Double>?
+        public let tolerance: Double?
+    }
+
+    /// Compute properties of every edge in one parallel pass.
+    ///
+    /// Result `i` describes edge `i` in index order (`subShape(type: .edge, index: i)`).
+    public func edgeProperties(_ queries: EdgeQuery = .all, parallel: Bool = true) -> [EdgeProperties] {
+        let count = Int(OCCTShapeQueryEdges(handle, queries.rawValue, nil, parallel))
+        guard count > 0 else { return [] }
+        var raw = [OCCTEdgeQueryResult](repeating: OCCTEdgeQueryResult(), count: count)
+        guard OCCTShapeQueryEdges(handle, queries.rawValue, &raw, parallel) == count else { return [] }
+        return raw.map { r in
+            let valid = EdgeQuery(rawValue: r.valid)
+            let points = valid.contains(.points)
+            return EdgeProperties(
+                isDegenerated: r.isDegenerated,
+                curveType: valid.contains(.curveType) ? Edge.CurveType(rawValue: r.curveType) ?? .other : nil,
+                range: valid.contains(.range) && r.first <= r.last ? r.first...r.last : nil,
+                length: valid.contains(.length) ? r.length : nil,
+                start: points ? SIMD3(r.sx, r.sy, r.sz) : nil,
+                end: points ? SIMD3(r.ex, r.ey, r.ez) : nil,
+                midpoint: points ? SIMD3(r.mx, r.my, r.mz) : nil,
+                midTangent: points ? SIMD3(r.tx, r.ty, r.tz) : nil,
+                tolerance: valid.contains(.tolerance) ? r.tolerance : nil
+            )
+        }
+    }
+}
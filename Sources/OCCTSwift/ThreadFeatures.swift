@@ -448,6 +448,35 @@ private func orthonormalRadial(axis: SIMD3<Double>) -> SIMD3<Double> {
     return simd_normalize(simd_cross(a, up))
 }
 
+// MARK: - Thread-cutter cache
+
+/// The process-wide cache of helical thread cutters behind ``Shape/threadedHole(axisOrigin:axisDirection:spec:depth:starts:runout:)``
+/// and the other thread cuts.
+///
+/// A cutter depends on the thread spec, length and builder, not on where the thread is, so
+/// the same M6×1 on a hundred holes builds one cutter and places it a hundred times.
+/// Entries are kept in a canonical frame and handed out as located instances that share
+/// the cached geometry.
+public enum ThreadCutterCache {
+    /// Lookups that found a cutter / had to build one, and the current entry count.
+    public static var statistics: (hits: Int, misses: Int, entries: Int) {
+        var hits: Int64 = 0, misses: Int64 = 0
+        var entries: Int32 = 0
+        OCCTThreadCutterCacheGetStats(&hits, &misses, &entries)
+        return (Int(hits), Int(misses), Int(entries))
+    }
+
+    /// Drop every cached cutter and reset the counters.
+    public static func clear() {
+        OCCTThreadCutterCacheClear()
+    }
+
+    /// Maximum number of cached cutters (default 256); `0` disables caching.
+    public static func setCapacity(_ maxEntries: Int) {
+        OCCTThreadCutterCacheSetCapacity(Int32(clamping: maxEntries))
+    }
+}
+
 // MARK: - Shape.threadedHole / threadedShaft (V-form)
 
 extension Shape {
@@ -836,12 +865,14 @@ extension Shape {
         //  (B) Robust screw-motion ruled loft (v1.4.0): faceted but the boolean is well-behaved.
         // Build with (A); validate; fall back to (B) if (A)'s result is not a sound cut.
         let nAnalytic = Int32(min(400, max(64, Int((turns * 24).rounded()))))
+        // Cutters come from the process-wide ThreadCutterCache: the same thread on another hole,
+        // or another start of this one, is a located instance of an already-built cutter.
         func analyticCutter(_ s: Int) -> Shape? {
-            OCCTShapeBuildThreadCutter(axisOrigin.x, axisOrigin.y, axisOrigin.z,
-                                       axis.x, axis.y, axis.z, radial0.x, radial0.y, radial0.z,
-                                       spec.pitch, turns, apexSign, helixRadius,
-                                       spec.cutDepth, outerHalf, apexHalf, bleed,
-                                       phase(s), handed, nAnalytic).map { Shape(handle: $0) }
+            OCCTShapeBuildThreadCutterCached(axisOrigin.x, axisOrigin.y, axisOrigin.z,
+                                             axis.x, axis.y, axis.z, radial0.x, radial0.y, radial0.z,
+                                             spec.pitch, turns, apexSign, helixRadius,
+                                             spec.cutDepth, outerHalf, apexHalf, bleed,
+                                             phase(s), handed, nAnalytic, 0).map { Shape(handle: $0) }
         }
         // Faceted fallback density (~14 sections/turn): enough for a usable cut, not so many that
         // the long-thread boolean slows to a crawl.
@@ -852,20 +883,42 @@ extension Shape {
         // fallback). A denser loft (~24+/turn) conditions cleanly; the volume converges by 24.
         func nSmooth(_ mult: Int) -> Int { min(260, max(48, Int((turns * Double(mult)).rounded()))) }
         func screwLoftCutter(_ s: Int, ruled: Bool, nSections: Int) -> Shape? {
-            Shape.screwSweptThreadCutter(axisOrigin: axisOrigin, axis: axis,
-                                         radial0: radial0, tangential0: tangential0,
-                                         spec: spec, turns: turns, apexSign: apexSign,
-                                         helixRadius: helixRadius, phase: phase(s),
-                                         handed: handed, nSections: nSections, ruled: ruled)
+            let groove = Shape.screwGrooveHalves(spec)
+            var key = OCCTThreadCutterKey(builder: ruled ? 1 : 2, nSections: Int32(nSections),
+                                          pitch: spec.pitch, turns: turns, apexSign: apexSign,
+                                          helixRadius: helixRadius, cutDepth: spec.cutDepth,
+                                          outerHalf: groove.outer, apexHalf: groove.apex,
+                                          bleed: bleed, taper: spec.taperRatio / 2, handed: handed)
+            if let h = OCCTThreadCutterCacheLookup(&key, axisOrigin.x, axisOrigin.y, axisOrigin.z,
+                                                   axis.x, axis.y, axis.z,
+                                                   radial0.x, radial0.y, radial0.z, phase(s)) {
+                return Shape(handle: h)
+            }
+            // Build in the cache's canonical frame; the cache places it.
+            guard let canonical = Shape.screwSweptThreadCutter(
+                axisOrigin: .zero, axis: SIMD3(0, 0, 1),
+                radial0: SIMD3(1, 0, 0), tangential0: SIMD3(0, 1, 0),
+                spec: spec, turns: turns, apexSign: apexSign,
+                helixRadius: helixRadius, phase: 0,
+                handed: handed, nSections: nSections, ruled: ruled) else { return nil }
+            return OCCTThreadCutterCacheStore(&key, canonical.handle,
+                                              axisOrigin.x, axisOrigin.y, axisOrigin.z,
+                                              axis.x, axis.y, axis.z,
+                                              radial0.x, radial0.y, radial0.z, phase(s)).map { Shape(handle: $0) }
         }
 
-        // Fuse the per-start cutters and subtract from the blank.
+        // Fuse the per-start cutters and subtract from the blank. Cutters share cached
+        // geometry, so the booleans must not touch their tolerances in place.
+        let keepInputs = BooleanOptions(nonDestructive: true)
         func threadResult(_ cutterFor: (Int) -> Shape?) -> Shape? {
             var cutters: [Shape] = []
             for s in 0..<starts { guard let c = cutterFor(s) else { return nil }; cutters.append(c) }
             var combined = cutters[0]
-            for c in cutters.dropFirst() { guard let f = combined.union(c) else { return nil }; combined = f }
-            return self.subtracting(combined)
+            for c in cutters.dropFirst() {
+                guard let f = combined.union(c, options: keepInputs) else { return nil }
+                combined = f
+            }
+            return self.subtracting(combined, options: keepInputs)
         }
 
         // A sound thread cut stays within the blank (a cut only removes material) and removes
@@ -949,6 +1002,19 @@ extension Shape {
     /// and a faceted trapezoidal approximation for asymmetric/rounded forms (buttress, knuckle) and
     /// custom profiles — the *external* smooth build reproduces those exactly; the cut path trades a
     /// little fidelity for a robust boolean.
+    /// Half-widths of the screw cutter's groove: `apex` is half the root flat (groove bottom),
+    /// `outer` half the inter-crest mouth.
+    fileprivate static func screwGrooveHalves(_ spec: ThreadSpec) -> (apex: Double, outer: Double) {
+        // Flat widths (mm) from the profile: total axial width of segments at the crest / root.
+        func flatWidth(atDepth d0: Double) -> Double {
+            spec.profile.segments
+                .filter { $0.kind == .flat && abs($0.a.depth - d0) < 1e-6 }
+                .reduce(0) { $0 + ($1.b.axial - $1.a.axial) } * spec.pitch
+        }
+        let apexHalf = flatWidth(atDepth: 1) / 2
+        return (apexHalf, max(apexHalf + 1e-4, (spec.pitch - flatWidth(atDepth: 0)) / 2))
+    }
+
     fileprivate static func screwSweptThreadCutter(
         axisOrigin: SIMD3<Double>, axis: SIMD3<Double>,
         radial0: SIMD3<Double>, tangential0: SIMD3<Double>,
@@ -958,14 +1024,7 @@ extension Shape {
         let depth = spec.cutDepth
         let bleed = max(depth * 0.05, 1e-3)
         let pitch = spec.pitch
-        // Flat widths (mm) from the profile: total axial width of segments at the crest / root.
-        func flatWidth(atDepth d0: Double) -> Double {
-            spec.profile.segments
-                .filter { $0.kind == .flat && abs($0.a.depth - d0) < 1e-6 }
-                .reduce(0) { $0 + ($1.b.axial - $1.a.axial) } * pitch
-        }
-        let apexHalf = flatWidth(atDepth: 1) / 2                  // half the root flat (groove bottom)
-        let outerHalf = max(apexHalf + 1e-4, (pitch - flatWidth(atDepth: 0)) / 2)  // half the inter-crest mouth
+        let (apexHalf, outerHalf) = screwGrooveHalves(spec)
         // Tapered pipe forms (NPT/BSPT): the thread surface lies on a 1:16 cone, so the local
         // radius shrinks by taperRatio/2 per unit of axial length. Parallel forms: taper = 0.
         let taper = spec.taperRatio / 2
@@ -0,0 +1,138 @@
+import Foundation
+import simd
+import OCCTBridge
+
+/// A shape's face/wire/edge/vertex topology as flat integer tables.
+///
+/// Built in one bridge call, so graph and feature passes can walk the topology without
+/// crossing into C++ (or allocating a `Face`/`Edge` wrapper) per element. Indices are
+/// 0-based and agree with the index-based `Shape` API (`subShape(type:index:)`,
+/// `faces()` on a solid, …).
+///
+/// One-to-many relations are stored in CSR form: the wires of face `f` are
+/// `faceWires[faceWireOffsets[f] ..< faceWireOffsets[f + 1]]`, and likewise for the others.
+///
+/// ## Example
+///
+/// ```swift
+/// let topo = part.topologyTables()!
+/// for f in 0..<topo.faceCount {
+///     let loops = topo.wires(ofFace: f).count   // 1 + number of holes
+/// }
+/// ```
+public struct TopologyTables: Sendable {
+    /// How an edge is used inside a wire.
+    public enum Orientation: Int32, Sendable {
+        case forward = 0
+        case reversed = 1
+        case `internal` = 2
+        case external = 3
+    }
+
+    public let faceCount: Int
+    public let wireCount: Int
+    public let edgeCount: Int
+    public let vertexCount: Int
+
+    /// CSR offsets into ``faceWires`` (`faceCount + 1` entries).
+    public let faceWireOffsets: [Int32]
+    /// Wire indices per face; the outer wire comes first.
+    public let faceWires: [Int32]
+
+    /// CSR offsets into ``wireEdges`` (`wireCount + 1` entries).
+    public let wireEdgeOffsets: [Int32]
+    /// Edge indices per wire, in stored order.
+    public let wireEdges: [Int32]
+    /// Orientation of each ``wireEdges`` entry within its wire.
+    public let wireEdgeOrientations: [Orientation]
+
+    /// First and last vertex of each edge (`2 · edgeCount` entries, -1 where missing).
+    public let edgeVertices: [Int32]
+
+    /// CSR offsets into ``edgeFaces`` (`edgeCount + 1` entries).
+    public let edgeFaceOffsets: [Int32]
+    /// Face indices per edge.
+    public let edgeFaces: [Int32]
+
+    /// CSR offsets into ``vertexEdges`` (`vertexCount + 1` entries).
+    public let vertexEdgeOffsets: [Int32]
+    /// Edge indices per vertex.
+    public let vertexEdges: [Int32]
+
+    /// Vertex positions.
+    public let vertices: [SIMD3<Double>]
+
+    // MARK: - Queries
+
+    /// Wires of a face, outer wire first.
+    public func wires(ofFace face: Int) -> ArraySlice<Int32> {
+        faceWires[Int(faceWireOffsets[face])..<Int(faceWireOffsets[face + 1])]
+    }
+
+    /// Edges of a wire with their orientation, in stored order.
+    public func edges(ofWire wire: Int) -> [(edge: Int, orientation: Orientation)] {
+        (Int(wireEdgeOffsets[wire])..<Int(wireEdgeOffsets[wire + 1])).map {
+            (Int(wireEdges[$0]), wireEdgeOrientations[$0])
+        }
+    }
+
+    /// First and last vertex of an edge (nil where missing).
+    public func vertices(ofEdge edge: Int) -> (first: Int?, last: Int?) {
+        let a = edgeVertices[2 * edge], b = edgeVertices[2 * edge + 1]
+        return (a >= 0 ? Int(a) : nil, b >= 0 ? Int(b) : nil)
+    }
+
+    /// Faces bounded by an edge.
+    public func faces(ofEdge edge: Int) -> ArraySlice<Int32> {
+        edgeFaces[Int(edgeFaceOffsets[edge])..<Int(edgeFaceOffsets[edge + 1])]
+    }
+
+    /// Edges meeting at a vertex.
+    public func edges(ofVertex vertex: Int) -> ArraySlice<Int32> {
+        vertexEdges[Int(vertexEdgeOffsets[vertex])..<Int(vertexEdgeOffsets[vertex + 1])]
+    }
+}
+
+extension Shape {
+    /// Export the whole face/wire/edge/vertex topology as flat tables in one call.
+    ///
+    /// - Returns: nil if the export fails
+    public func topologyTables() -> TopologyTables? {
+        guard let topo = OCCTShapeExportTopology(handle) else { return nil }
+        defer { OCCTTopologyTablesRelease(topo) }
+
+        var nf: Int32 = 0, nw: Int32 = 0, ne: Int32 = 0, nv: Int32 = 0
+        OCCTTopologyTablesGetCounts(topo, &nf, &nw, &ne, &nv)
+
+        func table(_ which: OCCTTopologyTable) -> [Int32] {
+            let n = Int(OCCTTopologyTablesGet(topo, which, nil))
+            guard n > 0 else { return [] }
+            var out = [Int32](repeating: 0, count: n)
+            OCCTTopologyTablesGet(topo, which, &out)
+            return out
+        }
+
+        var coords = [Double](repeating: 0, count: 3 * Int(nv))
+        if nv > 0 { OCCTTopologyTablesGetVertexCoords(topo, &coords) }
+
+        return TopologyTables(
+            faceCount: Int(nf),
+            wireCount: Int(nw),
+            edgeCount: Int(ne),
+            vertexCount: Int(nv),
+            faceWireOffsets: table(OCCTTopologyTableFaceWireOffsets),
+            faceWires: table(OCCTTopologyTableFaceWires),
+            wireEdgeOffsets: table(OCCTTopologyTableWireEdgeOffsets),
+            wireEdges: table(OCCTTopologyTableWireEdges),
+            wireEdgeOrientations: table(OCCTTopologyTableWireEdgeOrientations).map {
+                TopologyTables.Orientation(rawValue: $0) ?? .forward
+            },
+            edgeVertices: table(OCCTTopologyTableEdgeVertices),
+            edgeFaceOffsets: table(OCCTTopologyTableEdgeFaceOffsets),
+            edgeFaces: table(OCCTTopologyTableEdgeFaces),
+            vertexEdgeOffsets: table(OCCTTopologyTableVertexEdgeOffsets),
+            vertexEdges: table(OCCTTopologyTableVertexEdges),
+            vertices: (0..<Int(nv)).map { SIMD3(coords[3 * $0], coords[3 * $0 + 1], coords[3 * $0 + 2]) }
+        )
+    }
+}
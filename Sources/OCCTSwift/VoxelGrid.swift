@@ -0,0 +1,97 @@
+import Foundation
+import simd
+import OCCTBridge
+
+/// A dense voxel occupancy grid and narrow-band signed distance field of a solid.
+///
+/// Built in one pass: face triangulations are rasterised slice by slice in parallel, the
+/// outside is flood-filled from the padded border, and only the shell of voxels touching
+/// the mesh is classified exactly (via ``SolidClassifier``). Occupancy is therefore exact
+/// at voxel centres; distances are to the triangulation.
+///
+/// Voxel `(i, j, k)` has centre `origin + (SIMD3(i, j, k) + 0.5) * voxelSize` and linear
+/// index `i + nx * (j + ny * k)`.
+///
+/// ## Example
+///
+/// ```swift
+/// let grid = VoxelGrid(shape: part, voxelSize: 0.5)!
+/// print(grid.occupiedCount, "of", grid.voxelCount)
+/// let sdf = grid.signedDistances()   // negative inside
+/// ```
+public final class VoxelGrid: @unchecked Sendable {
+    internal let handle: OCCTVoxelGridRef
+
+    /// Grid dimensions in voxels.
+    public let dimensions: SIMD3<Int32>
+    /// Minimum corner of the grid.
+    public let origin: SIMD3<Double>
+    /// Voxel edge length.
+    public let voxelSize: Double
+
+    /// Voxelize a solid.
+    ///
+    /// - Parameters:
+    ///   - voxelSize: Voxel edge length
+    ///   - padding: Empty voxels around the shape on every side (at least 1)
+    ///   - bandWidth: Half-width of the SDF narrow band, in voxels
+    ///   - deflection: Mesh deflection (nil = voxelSize / 4)
+    ///   - parallel: Use OCCT's thread pool
+    public init?(shape: Shape, voxelSize: Double, padding: Int = 1, bandWidth: Double = 3,
+                 deflection: Double? = nil, parallel: Bool = true) {
+        guard let h = OCCTVoxelGridCreate(shape.handle, voxelSize, Int32(padding), bandWidth,
+                                          deflection ?? 0, parallel) else { return nil }
+        self.handle = h
+        var nx: Int32 = 0, ny: Int32 = 0, nz: Int32 = 0
+        var o = [Double](repeating: 0, count: 3)
+        var size = 0.0
+        OCCTVoxelGridGetInfo(h, &nx, &ny, &nz, &o, &size)
+        self.dimensions = SIMD3(nx, ny, nz)
+        self.origin = SIMD3(o[0], o[1], o[2])
+        self.voxelSize = size
+    }
+
+    deinit {
+        OCCTVoxelGridRelease(handle)
+    }
+
+    /// Total number of voxels.
+    public var voxelCount: Int {
+        Int(dimensions.x) * Int(dimensions.y) * Int(dimensions.z)
+    }
+
+    /// Number of occupied voxels.
+    public var occupiedCount: Int {
+        Int(OCCTVoxelGridOccupiedCount(handle))
+    }
+
+    /// Approximate volume: occupied voxels × voxelSize³.
+    public var volume: Double {
+        Double(occupiedCount) * voxelSize * voxelSize * voxelSize
+    }
+
+    /// Whether voxel `(i, j, k)` is occupied (false out of range).
+    public func isOccupied(_ i: Int, _ j: Int, _ k: Int) -> Bool {
+        OCCTVoxelGridIsOccupied(handle, Int32(i), Int32(j), Int32(k))
+    }
+
+    /// Centre of voxel `(i, j, k)`.
+    public func center(_ i: Int, _ j: Int, _ k: Int) -> SIMD3<Double> {
+        origin + (SIMD3(Double(i), Double(j), Double(k)) + 0.5) * voxelSize
+    }
+
+    /// Bit-packed occupancy, LSB first: voxel `n` is bit `n & 7` of byte `n >> 3`.
+    public func occupancyBits() -> [UInt8] {
+        let n = Int(OCCTVoxelGridGetOccupancy(handle, nil))
+        var bits = [UInt8](repeating: 0, count: n)
+        OCCTVoxelGridGetOccupancy(handle, &bits)
+        return bits
+    }
+
+    /// Signed distance per voxel (negative inside), clamped to the narrow band.
+    public func signedDistances() -> [Float] {
+        var values = [Float](repeating: 0, count: voxelCount)
+        OCCTVoxelGridGetSDF(handle, &values)
+        return values
+    }
+}
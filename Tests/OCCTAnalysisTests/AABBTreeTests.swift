@@ -0,0 +1,120 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Dynamic AABB tree: insert/update/remove with fat margins, box / ray queries and
+// all-pairs self-overlap in CSR form.
+@Suite("Dynamic AABB tree")
+struct AABBTreeTests {
+
+    /// Deterministic pseudo-random unit-ish boxes in a 100³ cube.
+    private func randomBoxes(_ n: Int, seed: UInt64 = 42) -> [(min: SIMD3<Double>, max: SIMD3<Double>)] {
+        var state = seed
+        func next() -> Double {
+            state = state &* 6364136223846793005 &+ 1442695040888963407
+            return Double(state >> 11) / Double(1 << 53)
+        }
+        return (0..<n).map { _ in
+            let lo = SIMD3(next(), next(), next()) * 100
+            let size = SIMD3(next(), next(), next()) * 4 + 0.1
+            return (lo, lo + size)
+        }
+    }
+
+    private func overlaps(_ a: (min: SIMD3<Double>, max: SIMD3<Double>),
+                          _ b: (min: SIMD3<Double>, max: SIMD3<Double>)) -> Bool {
+        all(a.min .<= b.max) && all(b.min .<= a.max)
+    }
+
+    @Test("box query matches brute force")
+    func boxQuery() {
+        let boxes = randomBoxes(500)
+        let tree = AABBTree(boxes: boxes, margin: 0.5)!
+        #expect(tree.count == 500)
+        let q = (min: SIMD3<Double>(20, 20, 20), max: SIMD3<Double>(40, 40, 40))
+        let expected = Set(boxes.indices.filter { overlaps(boxes[$0], q) })
+        #expect(Set(tree.query(min: q.min, max: q.max)) == expected)
+        // Balanced: far below the 500 of a degenerate list.
+        #expect(tree.height < 30)
+    }
+
+    @Test("all pairs match brute force, serial and parallel")
+    func allPairs() {
+        let boxes = randomBoxes(400)
+        let tree = AABBTree(boxes: boxes, margin: 0.25)!
+        var expected: [(Int, Int)] = []
+        for a in 0..<boxes.count {
+            for b in (a + 1)..<boxes.count where overlaps(boxes[a], boxes[b]) { expected.append((a, b)) }
+        }
+        let par = tree.overlappingPairs(parallel: true)
+        let ser = tree.overlappingPairs(parallel: false)
+        #expect(par.count == expected.count)
+        #expect(zip(par, expected).allSatisfy { $0.0 == $1.0 && $0.1 == $1.1 })
+        #expect(zip(ser, par).allSatisfy { $0.0 == $1.0 && $0.1 == $1.1 })
+    }
+
+    @Test("update within the margin does not re-insert")
+    func fatMargin() {
+        let tree = AABBTree(margin: 1.0)!
+        let id = tree.insert(min: .zero, max: SIMD3(1, 1, 1))!
+        #expect(tree.update(id, min: SIMD3(0.5, 0, 0), max: SIMD3(1.5, 1, 1)) == .withinMargin)
+        #expect(tree.update(id, min: SIMD3(5, 0, 0), max: SIMD3(6, 1, 1)) == .reinserted)
+        // Queries use the tight box, not the fat one.
+        #expect(tree.query(min: SIMD3(3, 0, 0), max: SIMD3(4.5, 1, 1)).isEmpty)
+        #expect(tree.query(min: SIMD3(5.5, 0, 0), max: SIMD3(5.6, 1, 1)) == [id])
+        #expect(tree.update(99, min: .zero, max: SIMD3(1, 1, 1)) == .invalid)
+    }
+
+    @Test("removed ids are reused and vanish from queries")
+    func removeAndReuse() {
+        let tree = AABBTree(margin: 0.1)!
+        let a = tree.insert(min: .zero, max: SIMD3(1, 1, 1))!
+        let b = tree.insert(min: SIMD3(0.5, 0.5, 0.5), max: SIMD3(2, 2, 2))!
+        #expect(tree.overlappingPairs().count == 1)
+        #expect(tree.remove(a))
+        #expect(!tree.remove(a))
+        #expect(tree.count == 1)
+        #expect(tree.query(min: .zero, max: SIMD3(0.2, 0.2, 0.2)).isEmpty)
+        #expect(tree.overlappingPairs().isEmpty)
+        let c = tree.insert(min: SIMD3(10, 10, 10), max: SIMD3(11, 11, 11))!
+        #expect(c == a)
+        #expect(tree.box(b) != nil)
+    }
+
+    @Test("raycast returns hits sorted by entry distance")
+    func raycast() {
+        let boxes: [(min: SIMD3<Double>, max: SIMD3<Double>)] = [
+            (SIMD3(10, -1, -1), SIMD3(11, 1, 1)),
+            (SIMD3(2, -1, -1), SIMD3(3, 1, 1)),
+            (SIMD3(5, 5, 5), SIMD3(6, 6, 6)),
+        ]
+        let tree = AABBTree(boxes: boxes)!
+        let hits = tree.raycast(origin: .zero, direction: SIMD3(1, 0, 0))
+        #expect(hits.map(\.proxy) == [1, 0])
+        #expect(abs(hits[0].t - 2) < 1e-12)
+        #expect(tree.raycast(origin: .zero, direction: SIMD3(1, 0, 0), maxDistance: 5).map(\.proxy) == [1])
+    }
+
+    @Test("tree from shapes indexes shape boxes in order")
+    func fromShapes() {
+        let shapes = (0..<20).map { i in
+            Shape.box(origin: SIMD3(Double(i) * 5, 0, 0), width: 4, height: 4, depth: 4)!
+        }
+        let tree = AABBTree(shapes: shapes, margin: 0)!
+        #expect(tree.count == 20)
+        let hits = tree.query(min: SIMD3(5.5, 1, 1), max: SIMD3(6, 2, 2))
+        #expect(hits == [1])
+        // Boxes 4 wide on a 5 pitch never touch.
+        #expect(tree.overlappingPairs().isEmpty)
+    }
+
+    @Test("invalid input is rejected")
+    func invalidInput() {
+        #expect(AABBTree(margin: -1) == nil)
+        #expect(AABBTree(boxes: [(SIMD3(1, 0, 0), SIMD3(0, 1, 1))]) == nil)
+        let tree = AABBTree()!
+        #expect(tree.insert(min: SIMD3(1, 1, 1), max: .zero) == nil)
+        #expect(tree.height == -1)
+    }
+}
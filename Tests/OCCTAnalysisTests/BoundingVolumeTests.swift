@@ -0,0 +1,68 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Batch AABB / optimal AABB / OBB for many shapes in one parallel call.
+@Suite("Batch bounding volumes")
+struct BoundingVolumeTests {
+
+    /// A 10×4×2 box rotated 30° about Z.
+    private func rotatedBox() -> Shape {
+        let a = Double.pi / 6
+        return Shape.box(width: 10, height: 4, depth: 2)!
+            .located(matrix: [cos(a), -sin(a), 0, 0, sin(a), cos(a), 0, 0, 0, 0, 1, 0])!
+    }
+
+    @Test("matches the per-shape APIs")
+    func matchesSingle() {
+        let shapes = [Shape.box(width: 1, height: 2, depth: 3)!, Shape.sphere(radius: 2)!, rotatedBox()]
+        let batch = Shape.boundingVolumes(of: shapes, useTriangulation: false)
+        #expect(batch.count == 3)
+        for (shape, v) in zip(shapes, batch) {
+            let single = shape.bounds
+            #expect(simd_distance(v!.aabb!.min, single.min) < 1e-9)
+            #expect(simd_distance(v!.aabb!.max, single.max) < 1e-9)
+            let obb = shape.orientedBoundingBox()!
+            #expect(abs(v!.obb!.volume - obb.volume) < 1e-6 * obb.volume)
+            #expect(v!.optimalAABB != nil)
+        }
+    }
+
+    @Test("OBB modes fit a rotated box much tighter than its AABB")
+    func obbModes() {
+        let box = rotatedBox()
+        _ = box.mesh(linearDeflection: 0.05)
+        for mode in [BoundingVolumes.OBBMode.pca, .optimal, .hull] {
+            let v = Shape.boundingVolumes(of: [box], [.aabb, .obb], obbMode: mode)[0]!
+            let aabbVolume = simd_reduce_mul(v.aabb!.max - v.aabb!.min)
+            #expect(v.obb!.volume < 0.5 * aabbVolume)
+            #expect(abs(v.obb!.volume - 80) < 2)
+        }
+    }
+
+    @Test("hull mode encloses every mesh node")
+    func hullEncloses() {
+        let cyl = Shape.cylinder(radius: 3, height: 12)!
+        guard let mesh = cyl.mesh(linearDeflection: 0.05) else { #expect(Bool(false)); return }
+        let obb = Shape.boundingVolumes(of: [cyl], .obb, obbMode: .hull)[0]!.obb!
+        for p in mesh.vertices {
+            let d = SIMD3<Double>(Double(p.x), Double(p.y), Double(p.z)) - obb.center
+            #expect(abs(simd_dot(d, obb.xDirection)) <= obb.halfSizes.x + 1e-5)
+            #expect(abs(simd_dot(d, obb.yDirection)) <= obb.halfSizes.y + 1e-5)
+            #expect(abs(simd_dot(d, obb.zDirection)) <= obb.halfSizes.z + 1e-5)
+        }
+    }
+
+    @Test("serial and parallel agree; only requested volumes are filled")
+    func serialParallel() {
+        let shapes = (0..<24).map { Shape.box(width: 1 + Double($0), height: 2, depth: 3)! }
+        let a = Shape.boundingVolumes(of: shapes, .aabb, parallel: false)
+        let b = Shape.boundingVolumes(of: shapes, .aabb, parallel: true)
+        for (x, y) in zip(a, b) {
+            #expect(x!.aabb!.max == y!.aabb!.max)
+            #expect(x!.obb == nil && x!.optimalAABB == nil)
+        }
+        #expect(Shape.boundingVolumes(of: []).isEmpty)
+    }
+}
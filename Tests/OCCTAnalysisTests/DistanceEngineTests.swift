@@ -0,0 +1,83 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Reusable two-shape distance: cached meshes, BVH lower bound, exact face-pair extrema.
+@Suite("Distance engine")
+struct DistanceEngineTests {
+
+    private func translation(_ t: SIMD3<Double>) -> [Double] {
+        [1, 0, 0, t.x, 0, 1, 0, t.y, 0, 0, 1, t.z]
+    }
+
+    private func rotationZ(_ angle: Double, then t: SIMD3<Double>) -> [Double] {
+        [cos(angle), -sin(angle), 0, t.x, sin(angle), cos(angle), 0, t.y, 0, 0, 1, t.z]
+    }
+
+    @Test("translated boxes report the gap and its closest points")
+    func translatedBoxes() {
+        // Spans 0...10, so the copy moved by 13 in x leaves a gap from x = 10 to x = 13.
+        let a = Shape.box(origin: .zero, width: 10, height: 10, depth: 10)!
+        let engine = DistanceEngine(a, a)!
+        let r = engine.distance(placement: translation(SIMD3(13, 0, 0)))!
+        #expect(abs(r.distance - 3) < 1e-7)
+        #expect(abs(r.point1.x - 10) < 1e-7)
+        #expect(abs(r.point2.x - 13) < 1e-7)
+        // Overlapping placement → 0.
+        #expect(engine.distance(placement: translation(SIMD3(5, 5, 5)))!.distance < 1e-7)
+    }
+
+    @Test("matches a one-shot ShapeDistance for rotated placements")
+    func matchesOneShot() {
+        let a = Shape.cylinder(radius: 3, height: 8)!
+        let b = Shape.box(width: 4, height: 2, depth: 6)!
+        let engine = DistanceEngine(a, b)!
+        for k in 0..<6 {
+            let m = rotationZ(Double(k) * 0.5, then: SIMD3(8 + Double(k), 1, 2))
+            let moved = b.located(matrix: m)!
+            let reference = ShapeDistance(shape1: a, shape2: moved)!
+            #expect(abs(engine.distance(placement: m)!.distance - reference.value) < 1e-6)
+        }
+    }
+
+    @Test("threshold queries agree with the exact distance")
+    func threshold() {
+        let ball = Shape.sphere(radius: 5)!
+        let engine = DistanceEngine(ball, ball)!
+        // Centres 12 apart → gap 2.
+        let m = translation(SIMD3(12, 0, 0))
+        #expect(engine.isCloser(than: 2.5, placement: m) == true)
+        #expect(engine.isCloser(than: 1.5, placement: m) == false)
+        #expect(engine.isCloser(than: 50, placement: m) == true)
+        #expect(engine.isCloser(than: 0.1, placement: translation(SIMD3(40, 0, 0))) == false)
+        #expect(engine.isCloser(than: 0, placement: m) == nil)
+        #expect(engine.stats.decidedByMesh >= 2)
+    }
+
+    @Test("non-rigid placements are rejected")
+    func nonRigid() {
+        let a = Shape.box(width: 1, height: 1, depth: 1)!
+        let engine = DistanceEngine(a, a)!
+        #expect(engine.distance(placement: [2, 0, 0, 5, 0, 2, 0, 0, 0, 0, 2, 0]) == nil)
+        #expect(engine.distance(placement: [1, 0, 0]) == nil)
+        // Unit-determinant shear and a mirror: neither preserves distances as a rotation.
+        #expect(engine.distance(placement: [1, 0.5, 0, 5, 0, 1, 0, 0, 0, 0, 1, 0]) == nil)
+        #expect(engine.distance(placement: [-1, 0, 0, 5, 0, 1, 0, 0, 0, 0, 1, 0]) == nil)
+        #expect(engine.distance(placement: [1, 0, 0, 5, 0, 1, 0, 0, 0, 0, 1, 0]) != nil)
+    }
+
+    @Test("batch distances match single queries, serial and parallel")
+    func batch() {
+        let a = Shape.box(width: 10, height: 10, depth: 10)!
+        let engine = DistanceEngine(a, a)!
+        let placements = (0..<40).map { rotationZ(Double($0) * 0.1, then: SIMD3(15 + Double($0 % 5), 0, 0)) }
+        let serial = engine.distances(placements: placements, parallel: false)
+        let parallel = engine.distances(placements: placements, parallel: true)
+        for (i, m) in placements.enumerated() {
+            let single = engine.distance(placement: m)!.distance
+            #expect(abs(serial[i]! - single) < 1e-9)
+            #expect(abs(parallel[i]! - single) < 1e-9)
+        }
+    }
+}
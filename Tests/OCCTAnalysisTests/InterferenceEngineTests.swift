@@ -0,0 +1,99 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// All-pairs interference / clearance engine: AABB broad phase, mesh mid phase,
+// exact refinement, containment.
+@Suite("Interference engine")
+struct InterferenceEngineTests {
+
+    /// 10 mm cubes: 0 overlaps 1, 2 sits 0.3 mm from 1, 3 is far away, 4 is inside 3.
+    private func parts() -> [Shape] {
+        [
+            Shape.box(origin: SIMD3(0, 0, 0), width: 10, height: 10, depth: 10)!,
+            Shape.box(origin: SIMD3(5, 0, 0), width: 10, height: 10, depth: 10)!,
+            Shape.box(origin: SIMD3(15.3, 0, 0), width: 10, height: 10, depth: 10)!,
+            Shape.box(origin: SIMD3(100, 0, 0), width: 10, height: 10, depth: 10)!,
+            Shape.box(origin: SIMD3(103, 3, 3), width: 2, height: 2, depth: 2)!,
+        ]
+    }
+
+    @Test("overlapping boxes are reported as intersecting")
+    func intersecting() {
+        let engine = InterferenceEngine(shapes: parts())!
+        let hits = engine.run(clearance: 0)!
+        let clash = hits.first { $0.shape1 == 0 && $0.shape2 == 1 }
+        #expect(clash?.kind == .intersecting)
+        #expect(clash?.distance == 0)
+        #expect((clash?.facePairCount ?? 0) > 0)
+        #expect(!hits.contains { $0.shape1 == 1 && $0.shape2 == 2 })
+    }
+
+    @Test("a gap below the clearance is reported with its distance")
+    func clearanceReported() {
+        let engine = InterferenceEngine(shapes: parts())!
+        let hits = engine.run(clearance: 0.5)!
+        guard let near = hits.first(where: { $0.shape1 == 1 && $0.shape2 == 2 }) else {
+            #expect(Bool(false)); return
+        }
+        #expect(near.kind == .clearance)
+        #expect(near.isExact)
+        #expect(abs(near.distance - 0.3) < 1e-6)
+        #expect(abs(simd_distance(near.point1, near.point2) - 0.3) < 1e-6)
+    }
+
+    @Test("a gap above the clearance is not reported")
+    func clearanceNotReported() {
+        let engine = InterferenceEngine(shapes: parts())!
+        let hits = engine.run(clearance: 0.2)!
+        #expect(!hits.contains { $0.shape1 == 1 && $0.shape2 == 2 })
+        #expect(!hits.contains { $0.shape2 == 3 && $0.shape1 < 3 })
+    }
+
+    @Test("a box nested inside another is contained")
+    func contained() {
+        let engine = InterferenceEngine(shapes: parts())!
+        let hits = engine.run(clearance: 0)!
+        let nested = hits.first { $0.shape1 == 3 && $0.shape2 == 4 }
+        #expect(nested?.kind == .contained)
+        #expect(nested?.distance == 0)
+    }
+
+    @Test("mesh and exact modes agree on which pairs interfere")
+    func meshMatchesExact() {
+        let engine = InterferenceEngine(shapes: parts(), deflection: 0.05)!
+        let exact = engine.run(clearance: 0.5, exact: true)!
+        let mesh = engine.run(clearance: 0.5, exact: false, parallel: false)!
+        #expect(exact.map { [$0.shape1, $0.shape2] } == mesh.map { [$0.shape1, $0.shape2] })
+        #expect(zip(exact, mesh).allSatisfy { $0.kind == $1.kind })
+        #expect(mesh.allSatisfy { !$0.isExact || $0.kind == .contained })
+    }
+
+    @Test("mesh mode drops a gap inside the deflection margin but above the clearance")
+    func meshRespectsClearance() {
+        // 0.28 + 0.05 deflection still reaches the 0.3 gap in the proximity pass.
+        let engine = InterferenceEngine(shapes: parts(), deflection: 0.05)!
+        let mesh = engine.run(clearance: 0.28, exact: false)!
+        #expect(!mesh.contains { $0.shape1 == 1 && $0.shape2 == 2 })
+    }
+
+    @Test("stats count the broad-phase candidates and reported pairs")
+    func stats() {
+        let engine = InterferenceEngine(shapes: parts())!
+        let hits = engine.run(clearance: 0.5, useOBB: false)!
+        let s = engine.stats
+        #expect(s.reportedPairs == hits.count)
+        #expect(s.broadPhasePairs >= hits.count)
+        #expect(s.obbRejected == 0)
+    }
+
+    @Test("empty input and negative clearance")
+    func edgeCases() {
+        let empty = InterferenceEngine(shapes: [])!
+        #expect(empty.run(clearance: 1)?.isEmpty == true)
+        #expect(InterferenceEngine(shapes: parts(), deflection: 0) == nil)
+        let engine = InterferenceEngine(shapes: parts())!
+        #expect(engine.run(clearance: -1) == nil)
+    }
+}
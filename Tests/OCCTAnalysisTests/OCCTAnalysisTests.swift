@@ -5635,3 +5635,56 @@ struct ShapeMeasurementsTests {
         #expect(capCount == 2, "cylinder has 2 circular caps, found \(capCount)")
     }
 }
+
+@Suite("Multi-level section")
+struct MultiLevelSectionTests {
+
+    private func boxWithBoss() -> Shape {
+        // Box spans Z -5…5, boss Z 0…20
+        Shape.box(width: 60, height: 60, depth: 10)!.union(Shape.cylinder(radius: 15, height: 20)!)!
+    }
+
+    @Test func matchesSingleLevelSections() {
+        let part = boxWithBoss()
+        let heights: [Double] = [30, -10, 0, 6, 12.5]
+        let levels = part.sectionWires(atZ: heights)
+
+        #expect(levels.map(\.offset) == heights)
+        #expect(levels.map(\.wires.count) == heights.map { part.sectionWiresAtZ($0).count })
+        #expect(levels[0].wires.isEmpty && levels[1].wires.isEmpty)
+        #expect(levels[3].wires.count == 1)
+        #expect(levels.allSatisfy { $0.faces == nil })
+    }
+
+    @Test func facesKeepHoles() {
+        let tube = Shape.cylinder(radius: 10, height: 20)!.subtracting(Shape.cylinder(radius: 6, height: 20)!)!
+        let levels = tube.sectionWires(atZ: [5, 15], faces: true)
+
+        for level in levels {
+            #expect(level.wires.count == 2)
+            let area = level.faces?.surfaceArea ?? 0
+            #expect(abs(area - .pi * (100 - 36)) < 1e-3)
+        }
+    }
+
+    @Test func arbitraryNormal() {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        let levels = box.sectionWires(origin: .zero, normal: SIMD3(2, 0, 0), offsets: [-6, 0, 4])
+
+        #expect(levels.map(\.wires.count) == [0, 1, 1])
+        #expect(abs((levels[1].wires.first?.length ?? 0) - 40) < 1e-6)
+    }
+
+    @Test func serialMatchesParallel() {
+        let part = boxWithBoss()
+        let heights = stride(from: -6.0, through: 22.0, by: 0.5).map { $0 }
+        let parallel = part.sectionWires(atZ: heights)
+        let serial = part.sectionWires(atZ: heights, parallel: false)
+
+        #expect(parallel.map(\.wires.count) == serial.map(\.wires.count))
+        let length = { (l: Shape.SectionLevel) in l.wires.reduce(0) { $0 + ($1.length ?? 0) } }
+        for (a, b) in zip(parallel, serial) {
+            #expect(abs(length(a) - length(b)) < 1e-6)
+        }
+    }
+}
@@ -0,0 +1,90 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Point-cloud processing on top of the KD-tree: parallel kNN+PCA normals, curvature,
+// statistical outlier removal and voxel downsampling.
+@Suite("Point-cloud processing")
+struct PointCloudProcessingTests {
+
+    /// A 20×20 grid on the z = 0 plane with 1 mm spacing.
+    private func planeGrid() -> [SIMD3<Double>] {
+        var pts: [SIMD3<Double>] = []
+        for i in 0..<20 { for j in 0..<20 { pts.append(SIMD3(Double(i), Double(j), 0)) } }
+        return pts
+    }
+
+    @Test("normals of a planar grid point along ±Z with near-zero curvature")
+    func planarNormals() {
+        let tree = KDTree(points: planeGrid())!
+        guard let est = tree.estimateNormals(k: 8) else { #expect(Bool(false)); return }
+        #expect(est.validCount == tree.count)
+        for (n, c) in zip(est.normals, est.curvature) {
+            #expect(abs(abs(n.z) - 1) < 1e-4)
+            #expect(c >= 0 && c < 1e-4)
+        }
+    }
+
+    @Test("viewpoint orients every normal towards it")
+    func viewpointOrientation() {
+        let tree = KDTree(points: planeGrid())!
+        guard let up = tree.estimateNormals(k: 8, viewpoint: SIMD3(10, 10, 100)),
+              let down = tree.estimateNormals(k: 8, viewpoint: SIMD3(10, 10, -100)) else {
+            #expect(Bool(false)); return
+        }
+        #expect(up.normals.allSatisfy { $0.z > 0.99 })
+        #expect(down.normals.allSatisfy { $0.z < -0.99 })
+    }
+
+    @Test("sphere samples get radial normals and positive curvature")
+    func sphereNormals() {
+        var pts: [SIMD3<Double>] = []
+        let r = 10.0
+        for i in 1..<30 {
+            let theta = Double.pi * Double(i) / 30
+            for j in 0..<60 {
+                let phi = 2 * Double.pi * Double(j) / 60
+                pts.append(SIMD3(r * sin(theta) * cos(phi), r * sin(theta) * sin(phi), r * cos(theta)))
+            }
+        }
+        let tree = KDTree(points: pts)!
+        guard let est = tree.estimateNormals(k: 12, viewpoint: .zero) else { #expect(Bool(false)); return }
+        for (p, n) in zip(pts, est.normals) {
+            // Oriented towards the centre → anti-parallel to the radial direction.
+            let radial = simd_normalize(SIMD3<Float>(Float(p.x), Float(p.y), Float(p.z)))
+            #expect(simd_dot(radial, n) < -0.95)
+        }
+        #expect(est.curvature.allSatisfy { $0 > 0 })
+    }
+
+    @Test("k below 3 is rejected")
+    func invalidK() {
+        let tree = KDTree(points: planeGrid())!
+        #expect(tree.estimateNormals(k: 2) == nil)
+    }
+
+    @Test("statistical outlier removal flags far-away points")
+    func outliers() {
+        var pts = planeGrid()
+        pts.append(SIMD3(10, 10, 50))
+        pts.append(SIMD3(-40, 5, 0))
+        let tree = KDTree(points: pts)!
+        guard let mask = tree.statisticalInliers(k: 8, stdRatio: 1.0) else { #expect(Bool(false)); return }
+        #expect(mask.count == pts.count)
+        #expect(mask[pts.count - 1] == false)
+        #expect(mask[pts.count - 2] == false)
+        #expect(mask.prefix(400).filter { $0 }.count == 400)
+    }
+
+    @Test("voxel downsampling keeps one centroid per occupied voxel")
+    func voxelDownsample() {
+        let pts = planeGrid()
+        guard let coarse = KDTree.voxelDownsample(pts, voxelSize: 2.0) else { #expect(Bool(false)); return }
+        // 20×20 grid binned into 2×2 cells → 10×10 voxels, each centroid at +0.5.
+        #expect(coarse.count == 100)
+        #expect(coarse.first == SIMD3<Float>(0.5, 0.5, 0))
+        #expect(KDTree.voxelDownsample(pts, voxelSize: 0) == nil)
+        #expect(KDTree.voxelDownsample([], voxelSize: 1) == nil)
+    }
+}
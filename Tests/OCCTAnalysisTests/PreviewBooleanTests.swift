@@ -0,0 +1,98 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Approximate mesh booleans for drag previews: cached meshes, box cull, parity classification.
+@Suite("Preview boolean")
+struct PreviewBooleanTests {
+
+    private func translation(_ t: SIMD3<Double>) -> [Double] {
+        [1, 0, 0, t.x, 0, 1, 0, t.y, 0, 0, 1, t.z]
+    }
+
+    /// Triangles of `mesh` from the object and from the tool.
+    private func split(_ mesh: Mesh, objectFaces: Int) -> (object: [Triangle], tool: [Triangle]) {
+        let tris = mesh.trianglesWithFaces()
+        return (tris.filter { Int($0.faceIndex) < objectFaces }, tris.filter { Int($0.faceIndex) >= objectFaces })
+    }
+
+    @Test("disjoint tool: cut keeps the object, fuse keeps both, common is empty")
+    func disjointTool() {
+        let part = Shape.box(width: 20, height: 20, depth: 20)!
+        let tool = Shape.box(width: 10, height: 10, depth: 10)!
+        let preview = PreviewBoolean(part, tool)!
+        let far = translation(SIMD3(100, 0, 0))
+
+        let whole = preview.compute(.union, placement: far)!
+        let (obj, tl) = split(whole, objectFaces: preview.objectFaceCount)
+        #expect(!obj.isEmpty && !tl.isEmpty)
+        #expect(preview.compute(.subtraction, placement: far)!.triangleCount == obj.count)
+        #expect(preview.compute(.intersection, placement: far)!.triangleCount == 0)
+        #expect(preview.stats.trianglesCulled > 0)
+    }
+
+    @Test("tool inside the part: cut adds the inverted tool")
+    func enclosedTool() {
+        let part = Shape.box(width: 20, height: 20, depth: 20)!
+        let tool = Shape.box(width: 4, height: 4, depth: 4)!
+        let preview = PreviewBoolean(part, tool)!
+        let centre = SIMD3<Double>(3, 2, 1)
+        let place = translation(centre)
+
+        let (fuseObj, fuseTool) = split(preview.compute(.union, placement: place)!, objectFaces: preview.objectFaceCount)
+        let (cutObj, cutTool) = split(preview.compute(.subtraction, placement: place)!, objectFaces: preview.objectFaceCount)
+        let (comObj, comTool) = split(preview.compute(.intersection, placement: place)!, objectFaces: preview.objectFaceCount)
+
+        #expect(fuseTool.isEmpty && comObj.isEmpty)
+        #expect(cutObj.count == fuseObj.count)
+        #expect(cutTool.count == comTool.count && !cutTool.isEmpty)
+
+        // Cut faces of the tool point into the tool (they bound the cavity).
+        let mesh = preview.compute(.subtraction, placement: place)!
+        let vertices = mesh.vertices
+        for t in mesh.trianglesWithFaces() where Int(t.faceIndex) >= preview.objectFaceCount {
+            let c = (vertices[Int(t.v1)] + vertices[Int(t.v2)] + vertices[Int(t.v3)]) / 3
+            #expect(simd_dot(t.normal, c - SIMD3<Float>(centre)) < 0)
+        }
+    }
+
+    @Test("crossing placement refines the seam")
+    func crossingTool() {
+        let part = Shape.box(width: 20, height: 20, depth: 20)!
+        let tool = Shape.cylinder(radius: 3, height: 30)!
+        let preview = PreviewBoolean(part, tool)!
+        let place = translation(SIMD3(2, 1, -15))
+
+        let coarse = preview.compute(.subtraction, placement: place, refinement: 0)!
+        let fine = preview.compute(.subtraction, placement: place, refinement: 3)!
+        let (obj, tl) = split(fine, objectFaces: preview.objectFaceCount)
+        #expect(!obj.isEmpty && !tl.isEmpty)
+        #expect(fine.triangleCount > coarse.triangleCount)
+        #expect(preview.stats.trianglesSplit > 0)
+    }
+
+    @Test("serial and parallel results are identical")
+    func serialMatchesParallel() {
+        let part = Shape.sphere(radius: 10)!
+        let tool = Shape.box(width: 8, height: 8, depth: 30)!
+        let preview = PreviewBoolean(part, tool, deflection: 0.2)!
+        let place = translation(SIMD3(4, 0, 0))
+
+        let a = preview.compute(.subtraction, placement: place, parallel: true)!
+        let b = preview.compute(.subtraction, placement: place, parallel: false)!
+        #expect(a.triangleCount == b.triangleCount)
+        #expect(a.vertices == b.vertices)
+    }
+
+    @Test("non-rigid placements and open shells are rejected")
+    func rejectsBadInput() {
+        let part = Shape.box(width: 20, height: 20, depth: 20)!
+        let preview = PreviewBoolean(part, part)!
+        #expect(preview.compute(.union, placement: [2, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0]) == nil)
+        #expect(preview.compute(.union, placement: [1, 0, 0]) == nil)
+
+        let face = Shape.face(from: Wire.rectangle(width: 5, height: 5)!)!
+        #expect(PreviewBoolean(part, face) == nil)
+    }
+}
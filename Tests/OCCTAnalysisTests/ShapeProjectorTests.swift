@@ -0,0 +1,73 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Batched closest-point projection: BVH candidate faces, exact per-face extrema.
+@Suite("Shape projector")
+struct ShapeProjectorTests {
+
+    // The boxes below span 0...10 on every axis.
+    @Test("points outside a box project onto the nearest face")
+    func boxFaces() {
+        let box = Shape.box(origin: .zero, width: 10, height: 10, depth: 10)!
+        let projector = ShapeProjector(shape: box)!
+        #expect(projector.faceCount == 6)
+        let hits = projector.project([SIMD3(5, 5, 13), SIMD3(-2, 4, 6), SIMD3(5, 5, 9)])
+        #expect(abs(hits[0]!.distance - 3) < 1e-7)
+        #expect(simd_distance(hits[0]!.point, SIMD3(5, 5, 10)) < 1e-7)
+        #expect(abs(hits[1]!.distance - 2) < 1e-7)
+        #expect(simd_distance(hits[1]!.point, SIMD3(0, 4, 6)) < 1e-7)
+        // Inside points project too: the top face is 1 away.
+        #expect(abs(hits[2]!.distance - 1) < 1e-7)
+        #expect(hits[0]!.faceIndex != hits[1]!.faceIndex)
+        #expect(hits[0]!.faceIndex == hits[2]!.faceIndex)
+    }
+
+    @Test("a point beyond a corner lands on the boundary")
+    func corner() {
+        let box = Shape.box(origin: .zero, width: 10, height: 10, depth: 10)!
+        let projector = ShapeProjector(shape: box)!
+        let hit = projector.project(SIMD3(13, 14, 5))!
+        #expect(abs(hit.distance - 5) < 1e-7)
+        #expect(simd_distance(hit.point, SIMD3(10, 10, 5)) < 1e-7)
+        #expect(hit.onBoundary)
+    }
+
+    @Test("sphere distances are radial")
+    func sphere() {
+        let ball = Shape.sphere(radius: 5)!
+        let projector = ShapeProjector(shape: ball)!
+        let pts: [SIMD3<Double>] = [SIMD3(0, 0, 9), SIMD3(3, 4, 12), SIMD3(1, 1, 1), SIMD3(-6, 2, -3)]
+        for (p, hit) in zip(pts, projector.project(pts)) {
+            #expect(abs(hit!.distance - abs(simd_length(p) - 5)) < 1e-6)
+            #expect(abs(simd_length(hit!.point) - 5) < 1e-6)
+        }
+    }
+
+    @Test("maxDistance filters far points")
+    func maxDistance() {
+        let box = Shape.box(origin: .zero, width: 10, height: 10, depth: 10)!
+        let projector = ShapeProjector(shape: box)!
+        let hits = projector.project([SIMD3(5, 5, 11), SIMD3(5, 5, 30)], maxDistance: 5)
+        #expect(hits[0] != nil)
+        #expect(hits[1] == nil)
+    }
+
+    @Test("serial and parallel projection agree")
+    func serialMatchesParallel() {
+        let cyl = Shape.cylinder(radius: 4, height: 10)!
+        let projector = ShapeProjector(shape: cyl)!
+        var pts: [SIMD3<Double>] = []
+        for i in 0..<200 {
+            let t = Double(i)
+            pts.append(SIMD3(8 * sin(t), 8 * cos(1.3 * t), 12 * sin(0.7 * t)))
+        }
+        let a = projector.project(pts, parallel: false)
+        let b = projector.project(pts, parallel: true)
+        for (x, y) in zip(a, b) {
+            #expect(x?.faceIndex == y?.faceIndex)
+            #expect(abs(x!.distance - y!.distance) < 1e-12)
+        }
+    }
+}
@@ -0,0 +1,77 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Cached solid classifier: pooled explorers, parallel batches, ray-parity fast path.
+@Suite("Solid classifier")
+struct SolidClassifierTests {
+
+    /// Points on a 12×12×12 lattice over [-2, 12]³ (some inside a 10 mm box spanning
+    /// [0, 10]³, some outside, some exactly on its faces).
+    private func lattice() -> [SIMD3<Double>] {
+        var pts: [SIMD3<Double>] = []
+        for i in 0..<12 { for j in 0..<12 { for k in 0..<12 {
+            pts.append(SIMD3(-2 + Double(i) * 14 / 11, -2 + Double(j), -2 + Double(k) * 1.3))
+        } } }
+        return pts
+    }
+
+    @Test("single-point results match Shape.classify")
+    func singlePoint() {
+        let box = Shape.box(origin: .zero, width: 10, height: 10, depth: 10)!
+        let classifier = SolidClassifier(shape: box)!
+        #expect(classifier.classify(SIMD3(5, 5, 5)) == .inside)
+        #expect(classifier.classify(SIMD3(15, 5, 5)) == .outside)
+        #expect(classifier.classify(SIMD3(10, 5, 5)) == .onBoundary)
+        #expect(classifier.classify(SIMD3(100, 100, 100)) == .outside)
+    }
+
+    @Test("batch results match per-point classification, serial and parallel")
+    func batchMatchesExact() {
+        let sphere = Shape.sphere(radius: 6)!.translated(by: SIMD3(5, 5, 5))!
+        let pts = lattice()
+        let expected = pts.map { sphere.classify(point: $0) }
+        let classifier = SolidClassifier(shape: sphere)!
+        #expect(classifier.classify(pts, parallel: false) == expected)
+        #expect(classifier.classify(pts, parallel: true) == expected)
+    }
+
+    @Test("mesh fast path agrees with the exact classifier")
+    func meshPath() {
+        let box = Shape.box(origin: .zero, width: 10, height: 10, depth: 10)!
+        let pts = lattice()
+        let exact = SolidClassifier(shape: box)!.classify(pts, useMesh: false)
+        let classifier = SolidClassifier(shape: box, meshDeflection: 0.1)!
+        #expect(classifier.hasMeshPath)
+        guard let fast = classifier.classifyCounted(pts) else { #expect(Bool(false)); return }
+        #expect(fast.states == exact)
+        #expect(fast.meshDecided > pts.count / 2)
+    }
+
+    @Test("curved solid: mesh path falls back near the surface")
+    func meshPathCurved() {
+        let cyl = Shape.cylinder(radius: 5, height: 10)!
+        var pts: [SIMD3<Double>] = []
+        for i in 0..<40 {
+            let a = Double(i) * .pi / 20
+            for r in [4.9, 4.999, 5.0, 5.001, 5.1] { pts.append(SIMD3(r * cos(a), r * sin(a), 3.3)) }
+        }
+        let exact = pts.map { cyl.classify(point: $0) }
+        let classifier = SolidClassifier(shape: cyl, meshDeflection: 0.05)!
+        #expect(classifier.classify(pts) == exact)
+    }
+
+    @Test("open shells get no mesh path")
+    func openShell() {
+        let face = Shape.box(width: 10, height: 10, depth: 10)!.faces().first!
+        let classifier = SolidClassifier(shape: Shape.fromFace(face)!, meshDeflection: 0.1)
+        #expect(classifier?.hasMeshPath != true)
+    }
+
+    @Test("empty batch")
+    func emptyBatch() {
+        let classifier = SolidClassifier(shape: Shape.box(width: 1, height: 1, depth: 1)!)!
+        #expect(classifier.classify([]).isEmpty)
+    }
+}
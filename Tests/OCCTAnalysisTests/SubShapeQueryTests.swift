@@ -0,0 +1,79 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Per-face / per-edge query kernels run over a whole shape in one parallel call.
+@Suite("Parallel sub-shape queries")
+struct SubShapeQueryTests {
+
+    @Test("box faces are planes with the right areas and unit normals")
+    func boxFaces() {
+        let box = Shape.box(width: 10, height: 20, depth: 30)!
+        let props = box.faceProperties()
+        #expect(props.count == 6)
+        #expect(props.allSatisfy { $0.surfaceType == .plane })
+        #expect(props.allSatisfy { $0.axis == nil })
+        let areas = props.compactMap { $0.area }.sorted()
+        #expect(areas.count == 6)
+        for (a, e) in zip(areas, [200.0, 200, 300, 300, 600, 600]) { #expect(abs(a - e) < 1e-6) }
+        for p in props {
+            #expect(abs(simd_length(p.normal!) - 1) < 1e-9)
+            #expect(p.curvatureRange == 0...0)
+            #expect(p.tolerance! > 0)
+        }
+    }
+
+    @Test("matches the per-face API")
+    func matchesPerFace() {
+        let cyl = Shape.cylinder(radius: 4, height: 10)!
+        let props = cyl.faceProperties()
+        let faces = cyl.faces()
+        #expect(props.count == faces.count)
+        for (p, f) in zip(props, faces) {
+            #expect(p.surfaceType == f.surfaceType)
+            #expect(abs(p.area! - f.area()) < 1e-6)
+            #expect(p.axis?.kind == f.primaryAxis?.kind)
+        }
+        let lateral = props.first { $0.surfaceType == .cylinder }!
+        #expect(lateral.axis?.kind == .cylinder)
+        // One principal curvature is 0 (along the axis), the other ±1/r.
+        #expect(abs(abs(lateral.curvatureRange!.lowerBound) + abs(lateral.curvatureRange!.upperBound) - 0.25) < 1e-9)
+    }
+
+    @Test("only requested kernels are filled")
+    func selectedKernels() {
+        let box = Shape.box(width: 1, height: 1, depth: 1)!
+        let props = box.faceProperties([.area])
+        #expect(props.allSatisfy { $0.area != nil && $0.surfaceType == nil && $0.normal == nil })
+        let edges = box.edgeProperties([.length])
+        #expect(edges.allSatisfy { $0.length != nil && $0.curveType == nil && $0.start == nil })
+    }
+
+    @Test("edge kernels on a box")
+    func boxEdges() {
+        let box = Shape.box(width: 10, height: 20, depth: 30)!
+        let props = box.edgeProperties()
+        #expect(props.count == 12)
+        #expect(props.allSatisfy { $0.curveType == .line && !$0.isDegenerated })
+        for p in props {
+            #expect(abs(simd_distance(p.start!, p.end!) - p.length!) < 1e-9)
+            #expect(abs(simd_length(p.midTangent!) - 1) < 1e-9)
+        }
+    }
+
+    @Test("serial and parallel passes agree")
+    func serialMatchesParallel() {
+        let shape = Shape.box(width: 10, height: 10, depth: 10)!.filleted(radius: 2)!
+        let a = shape.faceProperties(parallel: false)
+        let b = shape.faceProperties(parallel: true)
+        #expect(a.count == b.count)
+        for (x, y) in zip(a, b) {
+            #expect(x.area == y.area)
+            #expect(x.normal == y.normal)
+            #expect(x.curvatureRange == y.curvatureRange)
+        }
+        #expect(shape.edgeProperties(parallel: false).map { $0.length } ==
+                shape.edgeProperties(parallel: true).map { $0.length })
+    }
+}
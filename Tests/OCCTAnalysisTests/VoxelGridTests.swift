@@ -0,0 +1,110 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Voxelization / narrow-band SDF: occupancy checked against the exact classifier.
+@Suite("Voxel grid")
+struct VoxelGridTests {
+
+    @Test("occupancy matches the exact classifier at every voxel centre")
+    func matchesClassifier() {
+        let shape = Shape.cylinder(radius: 4, height: 6)!
+        guard let grid = VoxelGrid(shape: shape, voxelSize: 0.5) else { #expect(Bool(false)); return }
+        let d = grid.dimensions
+        var mismatches = 0
+        for k in 0..<Int(d.z) { for j in 0..<Int(d.y) { for i in 0..<Int(d.x) {
+            let state = shape.classify(point: grid.center(i, j, k))
+            let inside = state == .inside || state == .onBoundary
+            if inside != grid.isOccupied(i, j, k) { mismatches += 1 }
+        } } }
+        #expect(mismatches == 0)
+    }
+
+    @Test("voxel volume approaches the solid's volume")
+    func volume() {
+        let sphere = Shape.sphere(radius: 5)!
+        guard let grid = VoxelGrid(shape: sphere, voxelSize: 0.25) else { #expect(Bool(false)); return }
+        let exact = 4.0 / 3.0 * Double.pi * 125
+        #expect(abs(grid.volume - exact) / exact < 0.02)
+    }
+
+    @Test("SDF is negative inside, positive outside and clamped to the band")
+    func signedDistance() {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        guard let grid = VoxelGrid(shape: box, voxelSize: 1, padding: 3, bandWidth: 2) else {
+            #expect(Bool(false)); return
+        }
+        let sdf = grid.signedDistances()
+        #expect(sdf.count == grid.voxelCount)
+        let d = grid.dimensions
+        func value(_ i: Int, _ j: Int, _ k: Int) -> Float {
+            sdf[i + Int(d.x) * (j + Int(d.y) * k)]
+        }
+        for k in 0..<Int(d.z) { for j in 0..<Int(d.y) { for i in 0..<Int(d.x) {
+            #expect((value(i, j, k) < 0) == grid.isOccupied(i, j, k))
+            #expect(abs(value(i, j, k)) <= 2.0001)
+        } } }
+        // The box spans -5...5, so a centre at x = 4.5 is 0.5 inside the +X face.
+        guard let i = (0..<Int(d.x)).first(where: { abs(grid.center($0, 0, 0).x - 4.5) < 1e-9 }) else {
+            #expect(Bool(false), "no voxel centred at x = 4.5"); return
+        }
+        let j = Int(d.y) / 2, k = Int(d.z) / 2
+        #expect(abs(value(i, j, k) + 0.5) < 1e-4)
+    }
+
+    @Test("an enclosed cavity is empty with a positive distance")
+    func hollowSolid() {
+        let outer = Shape.box(origin: .zero, width: 10, height: 10, depth: 10)!
+        let inner = Shape.box(origin: SIMD3(3, 3, 3), width: 4, height: 4, depth: 4)!
+        let hollow = outer.subtracting(inner)!
+        guard let grid = VoxelGrid(shape: hollow, voxelSize: 0.5) else { #expect(Bool(false)); return }
+        let d = grid.dimensions
+        let sdf = grid.signedDistances()
+        var cavity = 0, wall = 0
+        for k in 0..<Int(d.z) { for j in 0..<Int(d.y) { for i in 0..<Int(d.x) {
+            let c = grid.center(i, j, k)
+            let value = sdf[i + Int(d.x) * (j + Int(d.y) * k)]
+            if simd_reduce_max(simd_abs(c - SIMD3(5, 5, 5))) < 1.5 {
+                // Well inside the cavity.
+                #expect(!grid.isOccupied(i, j, k))
+                #expect(value > 0)
+                cavity += 1
+            } else if simd_reduce_min(c) > 0.5 && simd_reduce_max(c) < 2.5 {
+                // In the wall between the outer faces and the cavity.
+                #expect(grid.isOccupied(i, j, k))
+                wall += 1
+            }
+        } } }
+        #expect(cavity > 0)
+        #expect(wall > 0)
+    }
+
+    @Test("bit-packed occupancy agrees with isOccupied and the count")
+    func packedBits() {
+        let grid = VoxelGrid(shape: Shape.box(width: 3, height: 2, depth: 1)!, voxelSize: 0.25)!
+        let bits = grid.occupancyBits()
+        #expect(bits.count == (grid.voxelCount + 7) / 8)
+        #expect(bits.reduce(0) { $0 + $1.nonzeroBitCount } == grid.occupiedCount)
+        let d = grid.dimensions
+        let i = Int(d.x) / 2, j = Int(d.y) / 2, k = Int(d.z) / 2
+        let n = i + Int(d.x) * (j + Int(d.y) * k)
+        #expect((bits[n >> 3] >> (n & 7)) & 1 == 1)
+        #expect(grid.isOccupied(i, j, k))
+        #expect(!grid.isOccupied(0, 0, 0))
+    }
+
+    @Test("serial and parallel builds are identical")
+    func serialMatchesParallel() {
+        let shape = Shape.torus(majorRadius: 5, minorRadius: 1.5)!
+        let a = VoxelGrid(shape: shape, voxelSize: 0.4, parallel: false)!
+        let b = VoxelGrid(shape: shape, voxelSize: 0.4, parallel: true)!
+        #expect(a.occupancyBits() == b.occupancyBits())
+        #expect(a.signedDistances() == b.signedDistances())
+    }
+
+    @Test("invalid voxel size is rejected")
+    func invalid() {
+        #expect(VoxelGrid(shape: Shape.box(width: 1, height: 1, depth: 1)!, voxelSize: 0) == nil)
+    }
+}
@@ -783,6 +783,34 @@ struct PatternTests {
         #expect(pattern!.isValid)
     }
 
+    @Test("Instanced patterns share the seed's geometry")
+    func instancedPatternSharesGeometry() {
+        let tooth = Shape.box(width: 2, height: 2, depth: 5)!.translated(by: SIMD3(20, 0, 0))!
+        guard let instanced = tooth.circularPattern(axisPoint: .zero, axisDirection: SIMD3(0, 0, 1),
+                                                    count: 100, mode: .instanced),
+              let copied = tooth.circularPattern(axisPoint: .zero, axisDirection: SIMD3(0, 0, 1), count: 100) else {
+            #expect(Bool(false)); return
+        }
+        #expect(instanced.subShapeCount(ofType: .solid) == 100)
+        #expect(abs(instanced.volume! - copied.volume!) < 1e-6)
+        let first = instanced.subShape(type: .solid, index: 0)!
+        #expect(first.isPartner(with: instanced.subShape(type: .solid, index: 57)!))
+        #expect(!copied.subShape(type: .solid, index: 0)!.isPartner(with: copied.subShape(type: .solid, index: 57)!))
+    }
+
+    @Test("Fused pattern merges overlapping instances and skips disjoint ones")
+    func fusedPattern() {
+        let box = Shape.box(origin: .zero, width: 10, height: 10, depth: 10)!
+        // Spacing 5 < width 10: neighbours overlap into one 25 × 10 × 10 block.
+        let overlapping = box.linearPattern(direction: SIMD3(1, 0, 0), spacing: 5, count: 4, mode: .fused)
+        #expect(overlapping?.subShapeCount(ofType: .solid) == 1)
+        #expect(abs((overlapping?.volume ?? 0) - 2500) < 1e-6)
+
+        let disjoint = box.linearPattern(direction: SIMD3(1, 0, 0), spacing: 20, count: 4, mode: .fused)
+        #expect(disjoint?.subShapeCount(ofType: .solid) == 4)
+        #expect(abs((disjoint?.volume ?? 0) - 4000) < 1e-6)
+    }
+
     // Issue #169: feature-level circular pattern (bolt circle).
     @Test("Circular pattern cut drills a bolt circle")
     func circularPatternCutBoltCircle() {
@@ -1076,6 +1104,80 @@ struct AAGTests {
         // At minimum, the AAG should have neighbor relationships
         #expect(hasAnyNeighbors || aag.nodes.count > 6)
     }
+
+    @Test("Box AAG edges are convex right angles")
+    func boxConvexity() {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        let aag = box.buildAAG()
+        for edge in aag.edges {
+            #expect(edge.convexity == .convex)
+            #expect(edge.sharedEdgeCount == 1)
+            #expect(abs(edge.dihedralAngle - Double.pi / 2) < 1e-6)
+        }
+    }
+
+    @Test("Pocket floor meets its walls at concave right angles")
+    func pocketConcavity() {
+        // Block spans 0...20; the pocket opens through the top face and floors at z = 10.
+        let box = Shape.box(origin: .zero, width: 20, height: 20, depth: 20)!
+        let pocket = Shape.box(origin: SIMD3(5, 5, 10), width: 10, height: 10, depth: 15)!
+        guard let result = box.subtracting(pocket) else {
+            Issue.record("Boolean subtraction failed")
+            return
+        }
+        let aag = result.buildAAG()
+        let concave = aag.edges.filter { $0.convexity == .concave }
+        // Four floor/wall edges plus four wall/wall corners.
+        #expect(concave.count == 8)
+        for edge in concave {
+            #expect(abs(edge.dihedralAngle - 3 * Double.pi / 2) < 1e-6)
+        }
+    }
+
+    @Test("Repeated faces map to one node, indexed like face(at:)")
+    func repeatedFaces() {
+        let box = Shape.box(width: 10, height: 20, depth: 30)!
+        let compound = Shape.builderMakeCompound()!
+        compound.builderAdd(box)
+        compound.builderAdd(box)
+        let aag = compound.buildAAG()
+        #expect(aag.nodes.count == 6)
+        #expect(aag.edges.count == 12)
+        for (i, node) in aag.nodes.enumerated() {
+            #expect(node.bounds.min == compound.face(at: i)!.bounds.min)
+        }
+    }
+
+    @Test("Cylinder seam does not make the lateral face its own neighbor")
+    func cylinderSeam() {
+        let cyl = Shape.cylinder(radius: 5, height: 10)!
+        let aag = cyl.buildAAG()
+        #expect(aag.nodes.count == 3)
+        #expect(aag.edges.count == 2)
+        for i in 0..<aag.nodes.count {
+            #expect(!aag.neighbors(of: i).contains(i))
+        }
+        #expect(aag.edges.allSatisfy { $0.convexity == .convex })
+    }
+
+    @Test("Serial and parallel AAG builds agree")
+    func serialMatchesParallel() {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        guard let filleted = box.filleted(radius: 1) else {
+            Issue.record("Fillet failed")
+            return
+        }
+        let serial = AAG(shape: filleted, parallel: false)
+        let parallel = AAG(shape: filleted, parallel: true)
+        #expect(serial.edges.count == parallel.edges.count)
+        for (a, b) in zip(serial.edges, parallel.edges) {
+            #expect(a.face1Index == b.face1Index && a.face2Index == b.face2Index)
+            #expect(a.convexity == b.convexity)
+            #expect(a.dihedralAngle == b.dihedralAngle)
+        }
+        // Fillet faces are tangent to the faces they blend.
+        #expect(serial.edges.contains { $0.convexity == .smooth })
+    }
 }
 
 // MARK: - Missing Core Shape Operations
@@ -1668,6 +1770,180 @@ struct MultiFuseTests {
     }
 }
 
+@Suite("Multi-Tool Boolean Cut / Common")
+struct MultiToolBooleanTests {
+    /// A 4×4 grid of r = 1 through-holes in a 40×40×10 plate centred at the origin.
+    private func holes() -> [Shape] {
+        (0..<16).compactMap { i in
+            Shape.cylinder(at: SIMD2(Double(i % 4) * 8 - 12, Double(i / 4) * 8 - 12), bottomZ: -10, radius: 1, height: 20)
+        }
+    }
+
+    @Test("one multi-tool cut matches sequential cuts")
+    func cutMatchesSequential() {
+        let plate = Shape.box(width: 40, height: 40, depth: 10)!
+        let tools = holes()
+        guard let multi = plate.subtracting(all: tools),
+              let sequential = tools.reduce(Optional(plate), { $0?.subtracting($1) }) else {
+            #expect(Bool(false)); return
+        }
+        let expected = 16000 - 16 * Double.pi * 10
+        #expect(abs(multi.volume! - expected) < 1e-3)
+        #expect(abs(multi.volume! - sequential.volume!) < 1e-6)
+        #expect(multi.subShapeCount(ofType: .face) == sequential.subShapeCount(ofType: .face))
+    }
+
+    @Test("multi-tool common keeps the part inside any tool")
+    func commonInsideTools() {
+        let plate = Shape.box(width: 40, height: 40, depth: 10)!
+        guard let plugs = plate.intersection(any: holes()) else { #expect(Bool(false)); return }
+        #expect(abs(plugs.volume! - 16 * Double.pi * 10) < 1e-3)
+    }
+
+    @Test("no tools returns nil")
+    func emptyTools() {
+        let plate = Shape.box(width: 40, height: 40, depth: 10)!
+        #expect(plate.subtracting(all: []) == nil)
+        #expect(plate.intersection(any: []) == nil)
+    }
+}
+
+@Suite("Boolean Options")
+struct BooleanOptionsTests {
+    private let box = Shape.box(width: 10, height: 10, depth: 10)!
+    private let cyl = Shape.cylinder(at: SIMD2(0, 0), bottomZ: -10, radius: 2, height: 20)!
+
+    @Test("every option combination gives the default result")
+    func optionsAgree() {
+        let reference = box.subtracting(cyl)!.volume!
+        for parallel in [false, true] {
+            for obb in [false, true] {
+                for nonDestructive in [false, true] {
+                    let opts = BooleanOptions(parallel: parallel, useOBB: obb, nonDestructive: nonDestructive)
+                    guard let r = box.subtracting(cyl, options: opts) else { #expect(Bool(false)); continue }
+                    #expect(abs(r.volume! - reference) < 1e-6)
+                }
+            }
+        }
+        #expect(abs(box.union(cyl, options: .fast)!.volume! - box.union(cyl)!.volume!) < 1e-6)
+        #expect(abs(box.intersection(cyl, options: .fast)!.volume! - 40 * Double.pi) < 1e-3)
+    }
+
+    @Test("splitter and general fuse accept options")
+    func splitterAndGeneralFuse() {
+        // A z = 0 face through the centred box.
+        let plane = Shape.face(from: Wire.rectangle(width: 30, height: 30)!)!
+        let pieces = box.split(by: [plane], options: .fast)
+        #expect(pieces?.subShapeCount(ofType: .solid) == 2)
+
+        let other = box.translated(by: SIMD3(5, 0, 0))!
+        let fused = Shape.fuseAll([box, other], options: .fast)
+        // General fuse keeps the overlap as its own solid: left, middle, right.
+        #expect(fused?.subShapeCount(ofType: .solid) == 3)
+    }
+
+    @Test("options with history")
+    func optionsWithHistory() {
+        guard let (result, history) = Shape.booleanWithFullHistory(.cut, objects: [box], tools: [cyl],
+                                                                    options: .fast) else {
+            #expect(Bool(false)); return
+        }
+        #expect(result.subShapeCount(ofType: .face) == 7)
+        // The top and bottom faces get a hole, so they are modified.
+        let modified = (0..<6).filter { !history.record(of: box.subShape(type: .face, index: $0)!).modified.isEmpty }
+        #expect(modified.count == 2)
+    }
+
+    @Test("full history matches the one-shot history")
+    func fullHistoryMatchesOneShot() {
+        guard let (result, history) = Shape.booleanWithFullHistory(.cut, objects: [box], tools: [cyl]),
+              let (reference, refHistory) = box.subtractedWithFullHistory(cyl) else {
+            #expect(Bool(false)); return
+        }
+        #expect(abs(result.volume! - reference.volume!) < 1e-6)
+        for i in 0..<6 {
+            let face = box.subShape(type: .face, index: i)!
+            let a = history.record(of: face), b = refHistory.record(of: face)
+            #expect(a.modified.count == b.modified.count)
+            #expect(a.isDeleted == b.isDeleted)
+        }
+        // The cylinder's lateral face survives inside the hole as a modified face.
+        let lateral = (0..<cyl.subShapeCount(ofType: .face)).filter {
+            !history.record(of: cyl.subShape(type: .face, index: $0)!).modified.isEmpty
+        }
+        #expect(lateral.count == 1)
+    }
+
+    @Test("no objects returns nil")
+    func noObjects() {
+        #expect(Shape.boolean(.fuse, objects: [], tools: [box]) == nil)
+    }
+}
+
+@Suite("Boolean Session")
+struct BooleanSessionTests {
+    private let box = Shape.box(width: 10, height: 10, depth: 10)!
+    private let cyl = Shape.cylinder(at: SIMD2(0, 0), bottomZ: -10, radius: 2, height: 20)!
+
+    @Test("session results match one-shot booleans")
+    func matchesOneShot() {
+        guard let session = BooleanSession(box, cyl) else { #expect(Bool(false)); return }
+        #expect(abs(session.result(.fuse)!.volume! - box.union(cyl)!.volume!) < 1e-6)
+        #expect(abs(session.result(.cut)!.volume! - box.subtracting(cyl)!.volume!) < 1e-6)
+        #expect(abs(session.result(.common)!.volume! - box.intersection(cyl)!.volume!) < 1e-6)
+        // The parts of the cylinder sticking out above and below the box.
+        #expect(abs(session.result(.cutReversed)!.volume! - cyl.subtracting(box)!.volume!) < 1e-6)
+        #expect(session.result(.section)!.subShapeCount(ofType: .edge) > 0)
+        #expect(session.result(.split)!.subShapeCount(ofType: .solid) == 2)
+    }
+
+    @Test("results can be rebuilt and requested in any order")
+    func repeatable() {
+        let session = BooleanSession(objects: [box], tools: [cyl], options: .fast)!
+        let first = session.result(.common)!.volume!
+        _ = session.result(.fuse)
+        #expect(abs(session.result(.common)!.volume! - first) < 1e-9)
+    }
+
+    @Test("history outlives the session")
+    func historyOutlivesSession() {
+        var history: ShapeHistoryRef?
+        do {
+            let session = BooleanSession(box, cyl)!
+            guard let (result, h) = session.resultWithHistory(.cut) else { #expect(Bool(false)); return }
+            #expect(result.subShapeCount(ofType: .face) == 7)
+            history = h
+        }
+        let modified = (0..<6).filter { !history!.record(of: box.subShape(type: .face, index: $0)!).modified.isEmpty }
+        #expect(modified.count == 2)
+    }
+
+    @Test("full history matches the one-shot history")
+    func fullHistoryMatchesOneShot() {
+        guard let (result, history) = Shape.booleanWithFullHistory(.cut, objects: [box], tools: [cyl]),
+              let (reference, refHistory) = box.subtractedWithFullHistory(cyl) else {
+            #expect(Bool(false)); return
+        }
+        #expect(abs(result.volume! - reference.volume!) < 1e-6)
+        for i in 0..<6 {
+            let face = box.subShape(type: .face, index: i)!
+            let a = history.record(of: face), b = refHistory.record(of: face)
+            #expect(a.modified.count == b.modified.count)
+            #expect(a.isDeleted == b.isDeleted)
+        }
+        // The cylinder's lateral face survives inside the hole as a modified face.
+        let lateral = (0..<cyl.subShapeCount(ofType: .face)).filter {
+            !history.record(of: cyl.subShape(type: .face, index: $0)!).modified.isEmpty
+        }
+        #expect(lateral.count == 1)
+    }
+
+    @Test("no objects returns nil")
+    func noObjects() {
+        #expect(BooleanSession(objects: [], tools: [box]) == nil)
+    }
+}
+
 // MARK: - v0.35.0 — OCCT Test Suite Audit Round 4
 
 @Suite("Multi-Offset Wire")
@@ -6001,6 +6277,73 @@ struct FeatureReconstructorInputBodyTests {
     }
 }
 
+@Suite("FeatureScheduler")
+struct FeatureSchedulerTests {
+    private let plate = Shape.box(origin: .zero, width: 60, height: 20, depth: 5)!
+
+    private func holes(movingFirstBy dx: Double = 0) -> [FeatureSpec] {
+        (0..<6).map { i in
+            .hole(.init(axisPoint: SIMD3(Double(i) * 10 + 5 + (i == 0 ? dx : 0), 10, 10),
+                        axisDirection: SIMD3(0, 0, -1), diameter: 3, depth: 20, id: "h\(i)"))
+        }
+    }
+
+    @Test("batched holes match the sequential build")
+    func matchesSequential() {
+        let specs = holes()
+        let sequential = FeatureReconstructor.build(from: specs, inputBody: plate)
+        let batched = FeatureScheduler().build(from: specs, inputBody: plate)
+        guard let a = sequential.shape?.volume, let b = batched.shape?.volume else { #expect(Bool(false)); return }
+        #expect(abs(a - b) < 1e-6)
+        #expect(batched.fulfilled == sequential.fulfilled)
+        #expect(batched.histories.count == 6)
+    }
+
+    @Test("batched extrudes match the sequential build")
+    func additiveBatch() {
+        let square = [SIMD2<Double>(0, 0), SIMD2(10, 0), SIMD2(10, 10), SIMD2(0, 10)]
+        let specs: [FeatureSpec] = (0..<4).map { i in
+            .extrude(.init(profilePoints2D: square, planeOrigin: SIMD3(Double(i) * 5, 0, 0),
+                           planeNormal: SIMD3(0, 0, 1), length: 5, id: "e\(i)"))
+        }
+        let sequential = FeatureReconstructor.build(from: specs)
+        let batched = FeatureScheduler().build(from: specs)
+        guard let a = sequential.shape?.volume, let b = batched.shape?.volume else { #expect(Bool(false)); return }
+        #expect(abs(a - b) < 1e-6)
+        #expect(Set(batched.fulfilled) == Set(sequential.fulfilled))
+    }
+
+    @Test("editing one hole rebuilds only its tool and the stages after it")
+    func incrementalEdit() {
+        let scheduler = FeatureScheduler()
+        _ = scheduler.build(from: holes(), inputBody: plate)
+        #expect(scheduler.lastStatistics.toolsBuilt == 6)
+
+        _ = scheduler.build(from: holes(), inputBody: plate)
+        #expect(scheduler.lastStatistics.stagesBuilt == 0)
+        #expect(scheduler.lastStatistics.toolsBuilt == 0)
+
+        let edited = scheduler.build(from: holes(movingFirstBy: 1), inputBody: plate)
+        let stats = scheduler.lastStatistics
+        #expect(stats.toolsBuilt == 1)
+        #expect(stats.toolsReused == 5)
+        // The (empty) additive stage is reused; subtractive and everything after it is rebuilt.
+        #expect(stats.stagesReused == 1)
+        let reference = FeatureReconstructor.build(from: holes(movingFirstBy: 1), inputBody: plate)
+        #expect(abs(edited.shape!.volume! - reference.shape!.volume!) < 1e-6)
+    }
+
+    @Test("a new input body invalidates every stage")
+    func newInputBody() {
+        let scheduler = FeatureScheduler()
+        _ = scheduler.build(from: holes(), inputBody: plate)
+        let other = Shape.box(origin: .zero, width: 60, height: 20, depth: 8)!
+        _ = scheduler.build(from: holes(), inputBody: other)
+        #expect(scheduler.lastStatistics.stagesReused == 0)
+        #expect(scheduler.lastStatistics.toolsReused == 6)
+    }
+}
+
 // MARK: - #88: FeatureReconstructor.buildJSON boolean decoding
 
 @Suite("FeatureReconstructor JSON boolean (#88)")
@@ -6288,3 +6631,167 @@ struct FeatureSpecCodableTests {
         }
     }
 }
+
+// MARK: - Speculative Fillet
+
+@Suite("Speculative Fillet")
+struct SpeculativeFilletTests {
+
+    /// A 40×40×4 plate, one short (4) edge and one long (40) edge that don't touch it.
+    private func plate() -> (shape: Shape, short: Int, long: Int) {
+        let plate = Shape.box(origin: .zero, width: 40, height: 40, depth: 4)!
+        let props = plate.edgeProperties([.length, .points])
+        let short = props.firstIndex { abs(($0.length ?? 0) - 4) < 1e-6 }!
+        let ends = [props[short].start!, props[short].end!]
+        let long = props.indices.first { i in
+            abs((props[i].length ?? 0) - 40) < 1e-6 &&
+            ends.allSatisfy { simd_distance($0, props[i].start!) > 1 && simd_distance($0, props[i].end!) > 1 }
+        }!
+        return (plate, short, long)
+    }
+
+    @Test("Each group falls back on its own")
+    func independentGroups() {
+        let (plate, short, long) = plate()
+        let result = plate.filletedSpeculatively(edgeIndices: [short, long], radii: [10, 1])
+
+        #expect(result.shape?.isValid == true)
+        #expect(result.edges.map(\.status) == [.filleted, .reduced])
+        #expect(result.edges.map(\.radius) == [10, 1])
+        #expect(result.edges[0].group != result.edges[1].group)
+        #expect(!result.isComplete)
+    }
+
+    @Test("Edges meeting at a vertex share a group and a radius")
+    func connectedEdgesShareGroup() {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        let all = Array(0..<box.subShapeCount(ofType: .edge))
+        let result = box.filletedSpeculatively(edgeIndices: all, radii: [20, 6, 1])
+
+        #expect(result.shape?.isValid == true)
+        #expect(Set(result.edges.compactMap(\.group)).count == 1)
+        #expect(result.edges.allSatisfy { $0.status == .reduced && $0.radius == 1 })
+        #expect((result.shape?.volume ?? 1000) < 1000)
+    }
+
+    @Test("Invalid indices are reported without failing the rest")
+    func invalidIndex() {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        let result = box.filletedSpeculatively(edgeIndices: [0, 999], radii: [1])
+
+        #expect(result.shape != nil)
+        #expect(result.edges.map(\.status) == [.filleted, .invalid])
+        #expect(result.edges[1].group == nil)
+    }
+
+    @Test("Nothing achievable returns no shape but a full report")
+    func nothingAchievable() {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        let result = box.filletedSpeculatively(edgeIndices: [0], radii: [50, 20])
+
+        #expect(result.shape == nil)
+        #expect(result.edges.map(\.status) == [.failed])
+    }
+
+    @Test("Serial and parallel trials agree")
+    func serialMatchesParallel() {
+        let (plate, short, long) = plate()
+        let parallel = plate.filletedSpeculatively(edgeIndices: [short, long], radii: [10, 5, 1])
+        let serial = plate.filletedSpeculatively(edgeIndices: [short, long], radii: [10, 5, 1], parallel: false)
+
+        #expect(parallel.edges.map(\.radius) == serial.edges.map(\.radius))
+        #expect(abs((parallel.shape?.volume ?? 0) - (serial.shape?.volume ?? -1)) < 1e-6)
+    }
+
+    @Test("Edge overload builds the ladder from fallback factors")
+    func edgeOverload() {
+        let (plate, _, long) = plate()
+        let edge = plate.edge(at: long)!
+        let result = plate.filletedSpeculatively(edges: [edge], radius: 8, fallbackFactors: [0.75, 0.25])
+
+        #expect(result.edges.first?.status == .reduced)
+        #expect(result.edges.first?.radius == 2)
+    }
+}
+
+// Resampled loft/sweep: uniform arc-length sections skinned into one B-spline surface.
+@Suite("Resampled Loft and Sweep")
+struct ResampledLoftTests {
+
+    private func circles(_ count: Int, radius: Double = 5, height: Double = 20,
+                         flipEvery: Int = 0) -> [Wire] {
+        (0..<count).map { i in
+            let z = height * Double(i) / Double(count - 1)
+            let flip = flipEvery > 0 && i % flipEvery == 1
+            return Wire.circle(origin: SIMD3(0, 0, z), normal: SIMD3(0, 0, flip ? -1 : 1), radius: radius)!
+        }
+    }
+
+    @Test("Circle stack lofts into a cylinder")
+    func cylinder() {
+        let solid = Shape.loftResampled(profiles: circles(21))!
+        #expect(solid.shapeType == .solid)
+        #expect(solid.isValid)
+        #expect(abs(solid.volume! - .pi * 25 * 20) / (.pi * 25 * 20) < 0.01)
+    }
+
+    @Test("Reversed sections are aligned before skinning")
+    func reversedSections() {
+        let solid = Shape.loftResampled(profiles: circles(21, flipEvery: 2))!
+        #expect(solid.isValid)
+        #expect(abs(solid.volume! - .pi * 25 * 20) / (.pi * 25 * 20) < 0.01)
+    }
+
+    @Test("Open sections give a face")
+    func openSections() {
+        let lines = (0..<5).map { i in
+            Wire.line(from: SIMD3(0, 0, Double(i) * 5), to: SIMD3(10, Double(i), Double(i) * 5))!
+        }
+        #expect(Shape.loftResampled(profiles: lines)?.shapeType == .face)
+    }
+
+    @Test("Sections sharing a point still skin")
+    func sharedPoint() {
+        // Every section starts at the origin, so the first column of poles coincides.
+        let fan = (0..<4).map { i in
+            Wire.polygon3D([.zero, SIMD3(10, 0, Double(i) * 3), SIMD3(20, 5, Double(i) * 3)], closed: false)!
+        }
+        #expect(Shape.loftResampled(profiles: fan)?.shapeType == .face)
+    }
+
+    @Test("Mixed open and closed sections are rejected")
+    func mixedSections() {
+        let line = Wire.line(from: SIMD3(0, 0, 10), to: SIMD3(10, 0, 10))!
+        #expect(Shape.loftResampled(profiles: [circles(2)[0], line]) == nil)
+        #expect(Shape.loftResampled(profiles: [circles(2)[0]]) == nil)
+    }
+
+    @Test("Serial and parallel lofts agree")
+    func serialMatchesParallel() {
+        let profiles = circles(40, flipEvery: 3)
+        let a = Shape.loftResampled(profiles: profiles, parallel: true)!
+        let b = Shape.loftResampled(profiles: profiles, parallel: false)!
+        #expect(abs(a.volume! - b.volume!) < 1e-9)
+    }
+
+    @Test("Straight sweep matches the extruded volume")
+    func straightSweep() {
+        let profile = Wire.circle(origin: .zero, normal: SIMD3(1, 0, 0), radius: 2)!
+        let spine = Wire.line(from: .zero, to: SIMD3(30, 0, 0))!
+        let solid = Shape.sweepResampled(profile: profile, along: spine, stations: 20)!
+        #expect(solid.isValid)
+        #expect(abs(solid.volume! - .pi * 4 * 30) / (.pi * 4 * 30) < 0.01)
+    }
+
+    @Test("Curved sweep produces a valid solid")
+    func curvedSweep() {
+        // The profile must be normal to the spine where it starts, so pin the start tangent.
+        let tangent = SIMD3<Double>(1, 1, 0)
+        let spine = Wire.interpolate(through: [SIMD3(0, 0, 0), SIMD3(10, 5, 2), SIMD3(20, 0, 6), SIMD3(30, -5, 4)],
+                                     startTangent: tangent, endTangent: SIMD3(1, -0.5, 0))!
+        let profile = Wire.circle(origin: .zero, normal: tangent, radius: 1)!
+        let solid = Shape.sweepResampled(profile: profile, along: spine, stations: 200)
+        #expect(solid?.shapeType == .solid)
+        #expect(solid?.isValid == true)
+    }
+}
@@ -0,0 +1,433 @@
+// StressBenchmarkTests.swift
+// Timing comparisons between the batched/cached engines and the one-shot APIs they replace.
+// Off by default (they take seconds to minutes); run with OCCTSWIFT_BENCH=1. Each benchmark
+// also asserts that both paths agree, so a speedup never hides a wrong answer.
+
+import Foundation
+import Testing
+import OCCTSwift
+
+/// True when benchmarks were requested via the environment.
+let benchmarksEnabled = ProcessInfo.processInfo.environment["OCCTSWIFT_BENCH"] == "1"
+
+/// Wall-clock seconds for `body`, printed under `label`.
+@discardableResult
+func benchmark<T>(_ label: String, _ body: () -> T) -> (seconds: Double, value: T) {
+    let start = DispatchTime.now().uptimeNanoseconds
+    let value = body()
+    let seconds = Double(DispatchTime.now().uptimeNanoseconds - start) / 1e9
+    print(String(format: "[bench] %@: %.3f s", label, seconds))
+    return (seconds, value)
+}
+
+// MARK: - Broad phase: dynamic AABB tree vs Bnd_BoundSortBox
+
+@Suite("Benchmark: AABBTree vs BoundSortBox", .enabled(if: benchmarksEnabled))
+struct BenchmarkAABBTreeTests {
+
+    @Test func hundredThousandBoxes() {
+        let n = 100_000
+        var state: UInt64 = 7
+        func next() -> Double {
+            state = state &* 6364136223846793005 &+ 1442695040888963407
+            return Double(state >> 11) / Double(1 << 53)
+        }
+        let boxes: [(min: SIMD3<Double>, max: SIMD3<Double>)] = (0..<n).map { _ in
+            let lo = SIMD3(next(), next(), next()) * 1000
+            return (lo, lo + SIMD3(next(), next(), next()) * 5 + 0.5)
+        }
+        let queries = boxes.prefix(10_000)
+
+        let bsb = benchmark("BoundSortBox build (100k)") {
+            BoundSortBox(boxes: boxes.map { [$0.min.x, $0.min.y, $0.min.z, $0.max.x, $0.max.y, $0.max.z] })
+        }.value
+        let bsbHits = benchmark("BoundSortBox 10k box queries") {
+            queries.map { q in
+                bsb.compare(xmin: q.min.x, ymin: q.min.y, zmin: q.min.z,
+                            xmax: q.max.x, ymax: q.max.y, zmax: q.max.z).count
+            }
+        }.value
+
+        let tree = benchmark("AABBTree build (100k)") { AABBTree(boxes: boxes, margin: 0.5)! }.value
+        let treeHits = benchmark("AABBTree 10k box queries") {
+            queries.map { tree.query(min: $0.min, max: $0.max).count }
+        }.value
+        // BoundSortBox.compare returns at most 1000 hits; only uncapped queries are comparable.
+        let uncapped = bsbHits.indices.filter { bsbHits[$0] < 1000 }
+        #expect(!uncapped.isEmpty)
+        #expect(uncapped.map { bsbHits[$0] } == uncapped.map { treeHits[$0] })
+
+        benchmark("AABBTree all pairs (parallel)") { tree.overlappingPairs(parallel: true).count }
+        benchmark("AABBTree all pairs (serial)") { tree.overlappingPairs(parallel: false).count }
+        benchmark("AABBTree 10k small moves") {
+            for i in 0..<10_000 {
+                let b = boxes[i]
+                tree.update(i, min: b.min + 0.1, max: b.max + 0.1)
+            }
+        }
+    }
+}
+
+// MARK: - Repeated shape-shape distance: DistanceEngine vs one-shot ShapeDistance
+
+@Suite("Benchmark: DistanceEngine vs ShapeDistance", .enabled(if: benchmarksEnabled))
+struct BenchmarkDistanceEngineTests {
+
+    @Test func thousandPlacements() {
+        let a = Shape.cylinder(radius: 10, height: 40)!
+            .subtracting(Shape.box(origin: SIMD3(-2, -20, 10), width: 4, height: 40, depth: 20)!)!
+        let b = Shape.sphere(radius: 6)!.union(Shape.box(width: 8, height: 8, depth: 20)!)!
+        let placements: [[Double]] = (0..<1000).map { i in
+            let t = Double(i) * 0.01
+            let c = cos(3 * t), s = sin(3 * t)
+            return [c, -s, 0, 25 + 8 * sin(t), s, c, 0, 6 * cos(2 * t), 0, 0, 1, 20 * sin(5 * t)]
+        }
+
+        let oneShot = benchmark("ShapeDistance one-shot (1000)") {
+            placements.map { ShapeDistance(shape1: a, shape2: b.located(matrix: $0)!)!.value }
+        }.value
+        let engine = benchmark("DistanceEngine build") { DistanceEngine(a, b)! }.value
+        let serial = benchmark("DistanceEngine serial (1000)") {
+            placements.map { engine.distance(placement: $0)!.distance }
+        }.value
+        let batch = benchmark("DistanceEngine batch, parallel (1000)") {
+            engine.distances(placements: placements, parallel: true)
+        }.value
+        for i in 0..<placements.count {
+            #expect(abs(serial[i] - oneShot[i]) < 1e-6)
+            #expect(abs(batch[i]! - oneShot[i]) < 1e-6)
+        }
+        benchmark("DistanceEngine isCloser(than: 2) (1000)") {
+            placements.filter { engine.isCloser(than: 2, placement: $0) == true }.count
+        }
+        print("[bench] DistanceEngine stats:", engine.stats)
+    }
+}
+
+// MARK: - Drilling N holes: sequential cuts vs one multi-tool cut
+
+@Suite("Benchmark: sequential cuts vs multi-tool cut", .enabled(if: benchmarksEnabled))
+struct BenchmarkMultiToolCutTests {
+
+    /// A square plate with an n-hole grid of r = 1 through-holes on a 4 mm pitch.
+    private func plateAndHoles(_ n: Int) -> (Shape, [Shape]) {
+        let side = Int(Double(n).squareRoot().rounded(.up))
+        let size = Double(side) * 4
+        let plate = Shape.box(origin: .zero, width: size, height: size, depth: 5)!
+        let holes = (0..<n).map { i in
+            Shape.cylinder(at: SIMD2(Double(i % side) * 4 + 2, Double(i / side) * 4 + 2),
+                           bottomZ: -1, radius: 1, height: 7)!
+        }
+        return (plate, holes)
+    }
+
+    @Test(arguments: [10, 100, 1000])
+    func drillHoles(n: Int) {
+        let (plate, holes) = plateAndHoles(n)
+        // The sequential path re-runs a full boolean on an ever larger plate: expect the
+        // 1000-hole case to take minutes.
+        let sequential = benchmark("\(n) sequential cuts") {
+            holes.reduce(Optional(plate)) { $0?.subtracting($1, timeout: 0) }
+        }.value
+        let multi = benchmark("one multi-tool cut, \(n) tools") {
+            plate.subtracting(all: holes, timeout: 0)
+        }.value
+        guard let sequential, let multi else { #expect(Bool(false)); return }
+        #expect(abs(multi.volume! - sequential.volume!) < 1e-6 * plate.volume!)
+        #expect(multi.subShapeCount(ofType: .face) == sequential.subShapeCount(ofType: .face))
+    }
+}
+
+// MARK: - Boolean options matrix
+
+@Suite("Benchmark: boolean options matrix", .enabled(if: benchmarksEnabled))
+struct BenchmarkBooleanOptionsTests {
+
+    private static let matrix: [(String, BooleanOptions)] = [
+        ("default", BooleanOptions(timeout: 0)),
+        ("parallel", BooleanOptions(parallel: true, timeout: 0)),
+        ("OBB", BooleanOptions(useOBB: true, timeout: 0)),
+        ("parallel+OBB", BooleanOptions(parallel: true, useOBB: true, timeout: 0)),
+        ("parallel+OBB+nonDestructive", BooleanOptions(parallel: true, useOBB: true, nonDestructive: true, timeout: 0)),
+        ("parallel+OBB, no inverted check", BooleanOptions(parallel: true, useOBB: true, checkInverted: false, timeout: 0)),
+    ]
+
+    /// Typical operands: a drilled plate, a lattice of overlapping spheres, and a row of
+    /// blocks that only touch along coincident faces (where gluing applies).
+    private static func operands() -> [(String, Shape.BooleanAlgorithm, [Shape], [Shape], Bool)] {
+        let plate = Shape.box(origin: .zero, width: 60, height: 60, depth: 5)!
+        let holes = (0..<225).map { i in
+            Shape.cylinder(at: SIMD2(Double(i % 15) * 4 + 2, Double(i / 15) * 4 + 2), bottomZ: -1, radius: 1, height: 7)!
+        }
+        let spheres = (0..<64).map { i in
+            Shape.sphere(radius: 3)!.translated(by: SIMD3(Double(i % 4) * 4, Double(i / 4 % 4) * 4, Double(i / 16) * 4))!
+        }
+        let blocks = (0..<50).map { i in
+            Shape.box(origin: SIMD3(Double(i) * 10, 0, 0), width: 10, height: 10, depth: 10 + Double(i % 3))!
+        }
+        return [
+            ("plate − 225 holes", .cut, [plate], holes, false),
+            ("64-sphere lattice, general fuse", .generalFuse, spheres, [], false),
+            ("50 touching blocks, fuse", .fuse, [blocks[0]], Array(blocks.dropFirst()), true),
+        ]
+    }
+
+    @Test func optionsMatrix() {
+        for (name, algorithm, objects, tools, touching) in Self.operands() {
+            var reference: Double?
+            var rows = Self.matrix
+            if touching { rows.append(("parallel+OBB+glue shift", BooleanOptions(parallel: true, useOBB: true, glue: .shift, timeout: 0))) }
+            for (label, options) in rows {
+                let result = benchmark("\(name) [\(label)]") {
+                    Shape.boolean(algorithm, objects: objects, tools: tools, options: options)
+                }.value
+                guard let volume = result?.volume else { #expect(Bool(false), "\(name) [\(label)] failed"); continue }
+                if let reference {
+                    #expect(abs(volume - reference) < 1e-6 * reference)
+                } else {
+                    reference = volume
+                }
+            }
+        }
+    }
+}
+
+// MARK: - Boolean session
+
+@Suite("Benchmark: boolean session", .enabled(if: benchmarksEnabled))
+struct BenchmarkBooleanSessionTests {
+
+    /// Cut, common and section of a drilled plate: three one-shot booleans intersect the
+    /// operands three times, a session once.
+    @Test func threeOperations() {
+        let plate = Shape.box(origin: .zero, width: 40, height: 40, depth: 5)!
+        let holes = (0..<100).map { i in
+            Shape.cylinder(at: SIMD2(Double(i % 10) * 4 + 2, Double(i / 10) * 4 + 2), bottomZ: -1, radius: 1, height: 7)!
+        }
+        let options = BooleanOptions(parallel: true, useOBB: true, timeout: 0)
+        let oneShot = benchmark("one-shot cut + common + section") {
+            [Shape.BooleanAlgorithm.cut, .common, .section].map {
+                Shape.boolean($0, objects: [plate], tools: holes, options: options)
+            }
+        }.value
+        let session = benchmark("session cut + common + section") { () -> [Shape?] in
+            guard let s = BooleanSession(objects: [plate], tools: holes, options: options) else { return [] }
+            return [s.result(.cut), s.result(.common), s.result(.section)]
+        }.value
+        guard session.count == 3, let cut = session[0], let common = session[1],
+              let oneCut = oneShot[0], let oneCommon = oneShot[1] else { #expect(Bool(false)); return }
+        #expect(abs(cut.volume! - oneCut.volume!) < 1e-6 * plate.volume!)
+        #expect(abs(common.volume! - oneCommon.volume!) < 1e-6 * plate.volume!)
+    }
+}
+
+// MARK: - Instanced patterns
+
+@Suite("Benchmark: pattern modes", .enabled(if: benchmarksEnabled))
+struct BenchmarkPatternModeTests {
+
+    /// A 1,000-tooth ring: deep copies against located instances.
+    @Test func thousandTeeth() {
+        let tooth = Shape.box(width: 0.2, height: 0.5, depth: 5)!.translated(by: SIMD3(50, 0, 0))!
+        let copied = benchmark("1000 teeth [copy]") {
+            tooth.circularPattern(axisPoint: .zero, axisDirection: SIMD3(0, 0, 1), count: 1000)
+        }.value
+        let instanced = benchmark("1000 teeth [instanced]") {
+            tooth.circularPattern(axisPoint: .zero, axisDirection: SIMD3(0, 0, 1), count: 1000, mode: .instanced)
+        }.value
+        guard let copied, let instanced else { #expect(Bool(false)); return }
+        #expect(abs(instanced.volume! - copied.volume!) < 1e-6 * copied.volume!)
+    }
+}
+
+// MARK: - Feature scheduler
+
+@Suite("Benchmark: feature scheduler", .enabled(if: benchmarksEnabled))
+struct BenchmarkFeatureSchedulerTests {
+
+    /// 40 holes through a plate: sequential replay, batched first build, and a rebuild
+    /// after moving one hole.
+    @Test func fortyHoles() {
+        let plate = Shape.box(origin: .zero, width: 80, height: 40, depth: 5)!
+        func holes(shift: Double) -> [FeatureSpec] {
+            (0..<40).map { i in
+                .hole(.init(axisPoint: SIMD3(Double(i % 10) * 8 + 4 + (i == 0 ? shift : 0), Double(i / 10) * 10 + 5, 10),
+                            axisDirection: SIMD3(0, 0, -1), diameter: 3, depth: 20, id: "h\(i)"))
+            }
+        }
+        let sequential = benchmark("40 holes [sequential]") {
+            FeatureReconstructor.build(from: holes(shift: 0), inputBody: plate)
+        }.value
+        let scheduler = FeatureScheduler()
+        let batched = benchmark("40 holes [scheduler, first build]") {
+            scheduler.build(from: holes(shift: 0), inputBody: plate)
+        }.value
+        _ = benchmark("40 holes [scheduler, one hole moved]") {
+            scheduler.build(from: holes(shift: 0.5), inputBody: plate)
+        }
+        guard let a = sequential.shape?.volume, let b = batched.shape?.volume else { #expect(Bool(false)); return }
+        #expect(abs(a - b) < 1e-6 * a)
+    }
+}
+
+// MARK: - Thread cutter cache
+
+@Suite("Benchmark: thread cutter cache", .enabled(if: benchmarksEnabled))
+struct BenchmarkThreadCutterCacheTests {
+
+    /// Twelve M6×1 holes: with the cache, only the first builds a cutter.
+    @Test func twelveM6Holes() {
+        guard var block = Shape.box(origin: .zero, width: 120, height: 20, depth: 15) else { return }
+        let centres = (0..<12).map { SIMD3(Double($0) * 10 + 5, 10, 0) }
+        for c in centres {
+            block = block.subtracting(Shape.cylinder(at: c, direction: SIMD3(0, 0, 1), radius: 3, height: 15)!)!
+        }
+        let spec = ThreadSpec.parse("M6x1")!
+        func threadAll() -> Shape? {
+            var part: Shape? = block
+            for c in centres { part = part?.threadedHole(axisOrigin: c, axisDirection: SIMD3(0, 0, 1), spec: spec, depth: 10) }
+            return part
+        }
+        ThreadCutterCache.setCapacity(0)
+        let uncached = benchmark("12 × M6x1 [no cache]") { threadAll() }.value
+        ThreadCutterCache.setCapacity(256)
+        ThreadCutterCache.clear()
+        let cached = benchmark("12 × M6x1 [cache]") { threadAll() }.value
+        print("thread cutter cache: \(ThreadCutterCache.statistics)")
+        if let a = uncached?.volume, let b = cached?.volume {
+            #expect(abs(a - b) < 1e-6 * a)
+        }
+    }
+}
+
+// MARK: - Speculative fillet
+
+@Suite("Benchmark: speculative fillet", .enabled(if: benchmarksEnabled))
+struct BenchmarkSpeculativeFilletTests {
+
+    /// A plate with 16 bosses: the plate corners take a large radius, the boss rims only a
+    /// small one. Retrying the whole set serially settles on the smallest radius everywhere.
+    @Test func plateWithBosses() {
+        guard var plate = Shape.box(origin: .zero, width: 100, height: 100, depth: 5) else { return }
+        for i in 0..<4 {
+            for j in 0..<4 {
+                let boss = Shape.cylinder(at: SIMD3(Double(i) * 25 + 12.5, Double(j) * 25 + 12.5, 5),
+                                          direction: SIMD3(0, 0, 1), radius: 3, height: 2)!
+                plate = plate.union(boss)!
+            }
+        }
+        let props = plate.edgeProperties([.length, .points])
+        let edges = props.indices.filter { i in
+            let p = props[i]
+            let corner = abs((p.length ?? 0) - 5) < 1e-6
+            let rim = (p.midpoint?.z ?? 0) > 6.5 && abs((p.length ?? 0) - 6 * .pi) < 1e-3
+            return corner || rim
+        }
+        let ladder: [Double] = [10, 6, 3, 1.5]
+
+        let serial = benchmark("\(edges.count) edges [serial ladder, whole set]") { () -> Shape? in
+            for r in ladder {
+                if let s = plate.filleted(edges: edges.compactMap { plate.edge(at: $0) }, radius: r) { return s }
+            }
+            return nil
+        }.value
+        let speculative = benchmark("\(edges.count) edges [speculative]") {
+            plate.filletedSpeculatively(edgeIndices: edges, radii: ladder)
+        }.value
+        print("speculative fillet: \(speculative.edges.filter { $0.status == .filleted }.count) at full radius, "
+              + "\(speculative.edges.filter { $0.status == .reduced }.count) reduced")
+        #expect(serial != nil)
+        #expect(speculative.shape?.isValid == true)
+    }
+}
+
+// MARK: - Multi-level section
+
+@Suite("Benchmark: multi-level section", .enabled(if: benchmarksEnabled))
+struct BenchmarkMultiLevelSectionTests {
+
+    /// 1,000 Z levels through a plate with 16 bosses of staggered heights.
+    @Test func thousandLevels() {
+        guard var part = Shape.box(origin: .zero, width: 100, height: 100, depth: 5) else { return }
+        for i in 0..<16 {
+            let boss = Shape.cylinder(at: SIMD3(Double(i % 4) * 25 + 12.5, Double(i / 4) * 25 + 12.5, 5),
+                                      direction: SIMD3(0, 0, 1), radius: 5, height: Double(i + 1) * 2)!
+            part = part.union(boss)!
+        }
+        let heights = (0..<1000).map { 0.02 + Double($0) * 0.037 }
+
+        let perLevel = benchmark("1000 levels [sectionWiresAtZ per level]") {
+            heights.map { part.sectionWiresAtZ($0).count }
+        }.value
+        let multi = benchmark("1000 levels [sectionWires(atZ:)]") {
+            part.sectionWires(atZ: heights).map(\.wires.count)
+        }.value
+        _ = benchmark("1000 levels [sectionWires(atZ:), faces]") {
+            part.sectionWires(atZ: heights, faces: true)
+        }
+        #expect(perLevel == multi)
+    }
+}
+
+// MARK: - Preview boolean
+
+@Suite("Benchmark: preview boolean", .enabled(if: benchmarksEnabled))
+struct BenchmarkPreviewBooleanTests {
+
+    /// A cutter dragged across a finely meshed sphere: preview per move, exact once.
+    @Test func dragCutter() {
+        guard let part = Shape.sphere(radius: 50),
+              let cutter = Shape.cylinder(radius: 8, height: 120) else { return }
+        guard let preview = PreviewBoolean(part, cutter, deflection: 0.02) else { #expect(Bool(false)); return }
+        let poses = (0..<30).map { i -> [Double] in
+            [1, 0, 0, -30 + Double(i) * 2, 0, 1, 0, 5, 0, 0, 1, -60]
+        }
+        let first = preview.compute(.subtraction, placement: poses[0])!
+        print("preview boolean: \(first.triangleCount) triangles in result")
+        _ = benchmark("30 drag moves [preview, refinement 2]") {
+            poses.map { preview.compute(.subtraction, placement: $0)?.triangleCount ?? 0 }
+        }
+        _ = benchmark("1 move [exact subtracting]") {
+            part.subtracting(cutter.located(matrix: poses.last!)!)
+        }
+        print("preview boolean: \(preview.stats)")
+    }
+}
+
+// MARK: - Resampled loft
+
+@Suite("Benchmark: resampled loft", .enabled(if: benchmarksEnabled))
+struct BenchmarkResampledLoftTests {
+
+    /// Twisted, tapering elliptical sections standing in for a turbine blade.
+    private func bladeSections(_ count: Int) -> [Wire] {
+        (0..<count).compactMap { i in
+            let t = Double(i) / Double(count - 1)
+            let a = 20 * (1 - 0.5 * t), b = 3.0, twist = t * .pi / 3
+            let points = (0..<24).map { k -> SIMD3<Double> in
+                let s = Double(k) / 24 * 2 * .pi
+                let x = a * cos(s), y = b * sin(s)
+                return SIMD3(x * cos(twist) - y * sin(twist), x * sin(twist) + y * cos(twist), 200 * t)
+            }
+            return Wire.interpolate(through: points, closed: true)
+        }
+    }
+
+    @Test(arguments: [50, 200, 500])
+    func blade(sections: Int) {
+        let profiles = bladeSections(sections)
+        guard profiles.count == sections else { #expect(Bool(false)); return }
+
+        let thru = benchmark("\(sections) sections [loft(profiles:)]") {
+            Shape.loft(profiles: profiles)
+        }.value
+        _ = benchmark("\(sections) sections [loftResampled, serial]") {
+            Shape.loftResampled(profiles: profiles, parallel: false)
+        }
+        let resampled = benchmark("\(sections) sections [loftResampled, parallel]") {
+            Shape.loftResampled(profiles: profiles)
+        }.value
+        print("resampled loft: \(sections) sections, volume \(thru?.volume ?? .nan) vs \(resampled?.volume ?? .nan)")
+        #expect(resampled?.isValid == true)
+    }
+}
@@ -0,0 +1,60 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// The process-wide thread-cutter cache: one cutter per (spec, length, builder), placed by
+// location. The cache is shared with every other thread test running in parallel, so these
+// use a spec no other test cuts and only check counter deltas.
+@Suite("Thread cutter cache")
+struct ThreadCutterCacheTests {
+    private let spec = ThreadSpec(form: .iso68, nominalDiameter: 11, pitch: 1.3)
+
+    private func boredBlock(at centres: [SIMD2<Double>]) -> Shape? {
+        guard var block = Shape.box(origin: .zero, width: 60, height: 30, depth: 20) else { return nil }
+        for c in centres {
+            guard let drill = Shape.cylinder(at: SIMD3(c.x, c.y, 0), direction: SIMD3(0, 0, 1),
+                                             radius: 5.5, height: 20),
+                  let cut = block.subtracting(drill) else { return nil }
+            block = cut
+        }
+        return block
+    }
+
+    @Test("the same thread on a second hole reuses the first hole's cutter")
+    func reuseAcrossHoles() {
+        guard let block = boredBlock(at: [SIMD2(15, 15), SIMD2(45, 15)]) else {
+            Issue.record("setup nil"); return
+        }
+        let first = block.threadedHole(axisOrigin: SIMD3(15, 15, 0), axisDirection: SIMD3(0, 0, 1),
+                                       spec: spec, depth: 12)
+        let before = ThreadCutterCache.statistics
+        let second = first?.threadedHole(axisOrigin: SIMD3(45, 15, 0), axisDirection: SIMD3(0, 0, 1),
+                                         spec: spec, depth: 12)
+        let after = ThreadCutterCache.statistics
+        #expect(second != nil)
+        #expect(after.hits > before.hits)
+        #expect(after.entries > 0)
+        // Both holes removed the same material.
+        if let b = block.volume, let f = first?.volume, let s = second?.volume {
+            #expect(abs((b - f) - (f - s)) < 1e-3 * (b - f))
+        }
+    }
+
+    @Test("cached cutters cut the same volume as freshly built ones")
+    func cachedMatchesFresh() {
+        guard let block = boredBlock(at: [SIMD2(15, 15)]) else { Issue.record("setup nil"); return }
+        let spec = ThreadSpec(form: .iso68, nominalDiameter: 11, pitch: 1.3, leftHanded: true)
+        let fresh = block.threadedHole(axisOrigin: SIMD3(15, 15, 0), axisDirection: SIMD3(0, 0, 1),
+                                       spec: spec, depth: 10)
+        let before = ThreadCutterCache.statistics
+        let cached = block.threadedHole(axisOrigin: SIMD3(15, 15, 0), axisDirection: SIMD3(0, 0, 1),
+                                        spec: spec, depth: 10)
+        let after = ThreadCutterCache.statistics
+        #expect(after.hits > before.hits)
+        guard let a = fresh?.volume, let b = cached?.volume else {
+            Issue.record("threaded hole nil"); return
+        }
+        #expect(abs(a - b) < 1e-6 * a)
+    }
+}
@@ -0,0 +1,152 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Geometric hashing of analytic surfaces and curves into same-domain candidate groups,
+// and the UnifySameDomain / Deduplicate passes it drives.
+@Suite("Geometric hashing")
+struct GeometricHashTests {
+
+    /// Two 10 mm cubes fused side by side: top, bottom, front and back each split in two.
+    private func fusedPair() -> Shape? {
+        guard let a = Shape.box(width: 10, height: 10, depth: 10),
+              let b = Shape.box(width: 10, height: 10, depth: 10)?.translated(by: SIMD3(10, 0, 0)) else { return nil }
+        return a.union(b)
+    }
+
+    @Test("a box has six distinct face groups and twelve edge groups")
+    func boxGroups() {
+        let box = Shape.box(width: 10, height: 20, depth: 30)!
+        guard let faces = box.faceGeometryGroups(), let edges = box.edgeGeometryGroups() else {
+            #expect(Bool(false)); return
+        }
+        #expect(faces.groupIDs.count == 6)
+        #expect(faces.groupCount == 6)
+        #expect(faces.candidates.isEmpty)
+        #expect(edges.groupIDs.count == 12)
+        #expect(edges.groupCount == 12)
+    }
+
+    @Test("coplanar faces of a fused pair share a group")
+    func coplanarFaces() {
+        guard let fused = fusedPair(), let groups = fused.faceGeometryGroups() else { #expect(Bool(false)); return }
+        let candidates = groups.candidates
+        #expect(candidates.count == 4)
+        #expect(candidates.allSatisfy { $0.count == 2 })
+    }
+
+    @Test("split faces of a cylinder share a group")
+    func cylinderFaces() {
+        guard let cyl = Shape.cylinder(radius: 5, height: 20),
+              let cut = Shape.box(width: 1, height: 40, depth: 40),
+              let split = cyl.subtracting(cut),
+              let groups = split.faceGeometryGroups() else { #expect(Bool(false)); return }
+        // The lateral halves, the two top and the two bottom half-discs pair up.
+        #expect(groups.candidates.count == 3)
+        #expect(groups.candidates.allSatisfy { $0.count == 2 })
+    }
+
+    @Test("serial and parallel grouping agree")
+    func serialMatchesParallel() {
+        guard let fused = fusedPair(),
+              let a = fused.faceGeometryGroups(parallel: false),
+              let b = fused.faceGeometryGroups(parallel: true),
+              let c = fused.edgeGeometryGroups(parallel: false),
+              let d = fused.edgeGeometryGroups(parallel: true) else { #expect(Bool(false)); return }
+        #expect(a.groupIDs == b.groupIDs)
+        #expect(c.groupIDs == d.groupIDs)
+    }
+
+    @Test("hashed unify skips clean parts and merges the rest")
+    func unifyHashed() {
+        guard let box = Shape.box(width: 10, height: 10, depth: 10)?.translated(by: SIMD3(0, 50, 0)),
+              let fused = fusedPair() else { #expect(Bool(false)); return }
+
+        guard let clean = box.unifiedHashed() else { #expect(Bool(false)); return }
+        #expect(clean.unifiedParts == 0)
+        #expect(clean.shape.subShapeCount(ofType: .face) == 6)
+
+        guard let assembly = Shape.compound([box, fused]),
+              let merged = assembly.unifiedHashed() else { #expect(Bool(false)); return }
+        #expect(merged.unifiedParts == 1)
+        #expect(merged.shape.subShapeCount(ofType: .face) == 12)
+        #expect(merged.shape.subShapeCount(ofType: .face) == assembly.unified()?.subShapeCount(ofType: .face))
+    }
+
+    @Test("hashed unify merges at the given tolerances")
+    func unifyHashedTolerance() {
+        // The second box is tilted 1e-4 rad about the x axis: its faces are coplanar with the
+        // first box's only within 1e-3.
+        guard let a = Shape.box(width: 10, height: 10, depth: 10),
+              let b = Shape.box(width: 10, height: 10, depth: 10)?
+                  .rotated(axis: SIMD3(1, 0, 0), angle: 1e-4)?.translated(by: SIMD3(10, 0, 0)),
+              let fused = a.union(b) else { #expect(Bool(false)); return }
+
+        let plain = UnifySameDomainBuilder(shape: fused, concatBSplines: true)
+        plain.setLinearTolerance(1e-3)
+        plain.setAngularTolerance(1e-3)
+        plain.build()
+        guard let reference = plain.shape,
+              let hashed = fused.unifiedHashed(linearTolerance: 1e-3, angularTolerance: 1e-3) else {
+            #expect(Bool(false)); return
+        }
+        #expect(hashed.unifiedParts == 1)
+        #expect(hashed.shape.subShapeCount(ofType: .face) == reference.subShapeCount(ofType: .face))
+        #expect(hashed.shape.subShapeCount(ofType: .edge) == reference.subShapeCount(ofType: .edge))
+        // At the default tolerances the tilted faces stay apart.
+        #expect(reference.subShapeCount(ofType: .face) < fused.unifiedHashed()!.shape.subShapeCount(ofType: .face))
+    }
+
+    @Test("graph grouping and hashed deduplicate")
+    func graphDeduplicate() {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        guard let graph = TopologyGraph(shape: box),
+              let faces = graph.faceGeometryGroups() else { #expect(Bool(false)); return }
+        #expect(faces.groupCount == 6)
+        #expect(graph.edgeGeometryGroups()?.groupCount == 12)
+
+        let (result, skipped) = graph.deduplicate(linearTolerance: 1e-6)
+        #expect(skipped)
+        #expect(result.canonicalSurfaces == 6)
+        #expect(result.canonicalCurves == 12)
+        #expect(result.surfaceRewrites == 0)
+    }
+
+    /// A square face on the plane through the origin with normal `n`.
+    private func plane(normal n: SIMD3<Double>) -> Shape? {
+        let u = simd_normalize(simd_cross(n, SIMD3(0, 0, 1)))
+        let v = simd_cross(n, u)
+        let square = [u + v, -u + v, -u - v, u - v].map { $0 * 5 }
+        guard let wire = Wire.polygon3D(square) else { return nil }
+        return Shape.face(from: wire)
+    }
+
+    @Test("coincident planes at the direction sign threshold are not skipped")
+    func signThreshold() {
+        // x just above 0.3 keeps the normal; just below, y = -0.6 decides and flips it.
+        func normal(_ x: Double) -> SIMD3<Double> {
+            let y = -0.6
+            return SIMD3(x, y, (1 - x * x - y * y).squareRoot())
+        }
+        guard let a = plane(normal: normal(0.3 + 1e-8)), let b = plane(normal: normal(0.3 - 1e-8)),
+              let shape = Shape.compound([a, b]),
+              let graph = TopologyGraph(shape: shape) else { #expect(Bool(false)); return }
+        let (_, skipped) = graph.deduplicate(linearTolerance: 1e-6, angularTolerance: 1e-6)
+        #expect(!skipped)
+    }
+
+    @Test("coincident planes straddling a cell boundary are not skipped")
+    func cellStraddle() {
+        func square(z: Double) -> Shape? {
+            guard let wire = Wire.polygon3D([SIMD3(0, 0, z), SIMD3(5, 0, z),
+                                             SIMD3(5, 5, z), SIMD3(0, 5, z)]) else { return nil }
+            return Shape.face(from: wire)
+        }
+        guard let a = square(z: 10.0000004999), let b = square(z: 10.0000005001),
+              let shape = Shape.compound([a, b]),
+              let graph = TopologyGraph(shape: shape) else { #expect(Bool(false)); return }
+        let (_, skipped) = graph.deduplicate(linearTolerance: 1e-6, angularTolerance: 1e-6)
+        #expect(!skipped)
+    }
+}
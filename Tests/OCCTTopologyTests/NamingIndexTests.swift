@@ -0,0 +1,87 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Persistent naming: stable sub-shape IDs carried through operation histories.
+@Suite("Naming index")
+struct NamingIndexTests {
+
+    /// Index of the face of `shape` lying in the plane z = `z`, per `bounds`.
+    private func faceIndices(_ shape: Shape, atZ z: Double) -> [Int] {
+        shape.subShapes(ofType: .face).enumerated().compactMap { i, f in
+            let b = f.bounds
+            return abs(b.min.z - z) < 1e-6 && abs(b.max.z - z) < 1e-6 ? i : nil
+        }
+    }
+
+    @Test("a fresh index names every face, edge and vertex once")
+    func fresh() {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        let naming = NamingIndex(shape: box)!
+        #expect(naming.idCount == 26)
+        let faceIDs = naming.ids(of: .face)
+        #expect(faceIDs.count == 6)
+        #expect(Set(faceIDs.compactMap { $0 }).count == 6)
+        for (i, id) in faceIDs.enumerated() {
+            #expect(naming.resolve(id!) == [i])
+            #expect(naming.kind(of: id!) == .face)
+            #expect(naming.parent(of: id!) == nil)
+        }
+        #expect(naming.resolve(NamingIndex.ID(rawValue: 999)) == nil)
+    }
+
+    @Test("a boolean split maps one face ID to both halves")
+    func split() {
+        // Spans 0...10, so the slot (z 5...15, through in y) splits the top face in two.
+        let box = Shape.box(origin: .zero, width: 10, height: 10, depth: 10)!
+        let naming = NamingIndex(shape: box)!
+        guard let topIndex = faceIndices(box, atZ: 10).first,
+              let bottomIndex = faceIndices(box, atZ: 0).first else { #expect(Bool(false)); return }
+        let top = naming.id(of: .face, index: topIndex)!
+        let bottom = naming.id(of: .face, index: bottomIndex)!
+
+        let slot = Shape.box(origin: SIMD3(4, -1, 5), width: 2, height: 12, depth: 10)!
+        guard let (cut, history) = box.subtractedWithFullHistory(slot) else { #expect(Bool(false)); return }
+        #expect(naming.apply(history, result: cut))
+
+        let tops = naming.resolve(top)!
+        #expect(tops.count == 2)
+        #expect(Set(tops) == Set(faceIndices(cut, atZ: 10)))
+        #expect(naming.resolve(bottom) == faceIndices(cut, atZ: 0))
+        // Slot walls and floor are new.
+        #expect(naming.idCount > 26)
+        #expect(naming.ids(of: .face).allSatisfy { $0 != nil })
+    }
+
+    @Test("a filleted edge is deleted and its fillet face points back to it")
+    func fillet() {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        let naming = NamingIndex(shape: box)!
+        let edge = naming.id(of: .edge, index: 0)!
+        let other = naming.id(of: .edge, index: 5)!
+        guard let (filleted, history) = box.filletedWithFullHistory(radius: 1, edges: [0]) else {
+            #expect(Bool(false)); return
+        }
+        #expect(naming.apply(history, result: filleted))
+        #expect(naming.resolve(edge) == [])
+        #expect(naming.resolve(other)?.count == 1)
+        let generated = naming.ids(of: .face).compactMap { $0 }.filter { naming.parent(of: $0) == edge }
+        #expect(generated.count == 1)
+    }
+
+    @Test("batch resolution matches single lookups")
+    func batch() {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        let naming = NamingIndex(shape: box)!
+        guard let (filleted, history) = box.filletedWithFullHistory(radius: 1, edges: [0, 1]) else {
+            #expect(Bool(false)); return
+        }
+        naming.apply(history, result: filleted)
+        let ids = (1...naming.idCount).map { NamingIndex.ID(rawValue: Int64($0)) }
+        let first = naming.resolveFirst(ids)
+        for (id, f) in zip(ids, first) {
+            #expect(naming.resolve(id)?.first == f)
+        }
+    }
+}
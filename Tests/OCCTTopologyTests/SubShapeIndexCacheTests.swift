@@ -0,0 +1,83 @@
+import Testing
+import Foundation
+@testable import OCCTSwift
+
+// Memoized sub-shape index maps on OCCTShape: same indices as before, built once,
+// dropped on in-place mutation.
+@Suite("Sub-shape index cache")
+struct SubShapeIndexCacheTests {
+
+    @Test("cached lookups return the same sub-shapes as a fresh walk")
+    func sameOrdering() {
+        let box = Shape.box(width: 10, height: 20, depth: 30)!
+        let faces = box.subShapes(ofType: .face)
+        #expect(faces.count == 6)
+        // Second pass hits the cache; areas identify the same faces in the same order.
+        let again = (0..<6).compactMap { box.subShape(type: .face, index: $0) }
+        #expect(faces.map { $0.area } == again.map { $0.area })
+        #expect(box.subShapeCount(ofType: .edge) == 12)
+        #expect(box.subShapeCount(ofType: .vertex) == 8)
+    }
+
+    @Test("index-based calls populate the cache and dropping frees it")
+    func accounting() {
+        let cyl = Shape.cylinder(radius: 5, height: 10)!
+        #expect(cyl.indexCacheBytes == 0)
+        _ = cyl.subShape(type: .edge, index: 0)
+        let bytes = cyl.indexCacheBytes
+        #expect(bytes > 0)
+        #expect(Shape.indexCacheTotalBytes >= bytes)
+        // Same type again: no new map.
+        _ = cyl.subShape(type: .edge, index: 1)
+        #expect(cyl.indexCacheBytes == bytes)
+        cyl.dropIndexCache()
+        #expect(cyl.indexCacheBytes == 0)
+    }
+
+    @Test("setOrientation invalidates the cache")
+    func invalidation() {
+        let box = Shape.box(width: 1, height: 1, depth: 1)!
+        let before = box.subShape(type: .face, index: 0)!.orientation
+        #expect(box.indexCacheBytes > 0)
+        box.setOrientation(.reversed)
+        #expect(box.indexCacheBytes == 0)
+        let after = box.subShape(type: .face, index: 0)!.orientation
+        #expect(after != before)
+    }
+
+    @Test("builderAdd and builderRemove invalidate the cache")
+    func builderMutation() {
+        let compound = Shape.builderMakeCompound()!
+        let box1 = Shape.box(width: 5, height: 5, depth: 5)!
+        let box2 = Shape.box(width: 3, height: 3, depth: 3)!
+        compound.builderAdd(box1)
+        #expect(compound.subShapeCount(ofType: .face) == 6)
+        compound.builderAdd(box2)
+        #expect(compound.subShapeCount(ofType: .face) == 12)
+        #expect(compound.subShape(type: .face, index: 11) != nil)
+        compound.builderRemove(box1)
+        #expect(compound.subShapeCount(ofType: .face) == 6)
+        #expect(compound.subShape(type: .face, index: 6) == nil)
+    }
+
+    @Test("orientClosedSolid invalidates the cache")
+    func orientClosedSolidMutation() {
+        let box = Shape.box(width: 2, height: 2, depth: 2)!
+        let shell = box.subShapes(ofType: .shell)[0]
+        shell.setOrientation(.reversed)
+        let solid = Shape.builderMakeSolid()!
+        solid.builderAdd(shell)
+        _ = solid.subShape(type: .face, index: 0)
+        #expect(solid.indexCacheBytes > 0)
+        #expect(solid.orientClosedSolid())
+        #expect(solid.indexCacheBytes == 0)
+        #expect((solid.volume ?? -1) > 0)
+    }
+
+    @Test("out-of-range index is handled")
+    func outOfRange() {
+        let box = Shape.box(width: 1, height: 1, depth: 1)!
+        #expect(box.subShape(type: .face, index: 6) == nil)
+        #expect(box.subShape(type: .face, index: -1) == nil)
+    }
+}
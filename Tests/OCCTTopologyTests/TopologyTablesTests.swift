@@ -0,0 +1,70 @@
+import Testing
+import Foundation
+import simd
+@testable import OCCTSwift
+
+// Whole-shape topology tables exported in one bridge call.
+@Suite("Bulk topology export")
+struct TopologyTablesTests {
+
+    @Test("box tables have the expected counts and CSR shape")
+    func boxTables() {
+        let box = Shape.box(width: 10, height: 20, depth: 30)!
+        guard let topo = box.topologyTables() else { #expect(Bool(false)); return }
+        #expect(topo.faceCount == 6)
+        #expect(topo.wireCount == 6)
+        #expect(topo.edgeCount == 12)
+        #expect(topo.vertexCount == 8)
+        #expect(topo.faceWireOffsets.count == 7)
+        for f in 0..<6 { #expect(topo.wires(ofFace: f).count == 1) }
+        for w in 0..<6 { #expect(topo.edges(ofWire: w).count == 4) }
+        for e in 0..<12 {
+            #expect(topo.faces(ofEdge: e).count == 2)
+            let (a, b) = topo.vertices(ofEdge: e)
+            #expect(a != nil && b != nil && a != b)
+        }
+        for v in 0..<8 { #expect(topo.edges(ofVertex: v).count == 3) }
+    }
+
+    @Test("indices agree with the index-based Shape API")
+    func matchesIndexAPI() {
+        let box = Shape.box(width: 10, height: 20, depth: 30)!
+        guard let topo = box.topologyTables() else { #expect(Bool(false)); return }
+        #expect(topo.vertices == box.vertices())
+        // Box edges have lengths 10, 20 and 30, four of each.
+        var lengths: [Int: Int] = [:]
+        for e in 0..<topo.edgeCount {
+            let (a, b) = topo.vertices(ofEdge: e)
+            lengths[Int(simd_distance(topo.vertices[a!], topo.vertices[b!]).rounded()), default: 0] += 1
+        }
+        #expect(lengths == [10: 4, 20: 4, 30: 4])
+    }
+
+    @Test("a face with a hole lists its outer wire first")
+    func holeOuterWireFirst() {
+        let plate = Shape.box(width: 40, height: 40, depth: 5)!
+        // The plate is centred (z -2.5...2.5); the cylinder runs right through its middle.
+        let hole = Shape.cylinder(at: SIMD2(0, 0), bottomZ: -5, radius: 5, height: 10)!
+        guard let holed = plate.subtracting(hole),
+              let topo = holed.topologyTables() else { #expect(Bool(false)); return }
+        let holedFaces = (0..<topo.faceCount).filter { topo.wires(ofFace: $0).count == 2 }
+        #expect(holedFaces.count == 2)
+        for f in holedFaces {
+            // The outer loop of a 40×40 plate face has four straight edges.
+            let outer = Int(topo.wires(ofFace: f).first!)
+            #expect(topo.edges(ofWire: outer).count == 4)
+        }
+    }
+
+    @Test("cylinder seam appears twice in its wire with opposite orientations")
+    func seamOrientation() {
+        let cyl = Shape.cylinder(radius: 5, height: 10)!
+        guard let topo = cyl.topologyTables() else { #expect(Bool(false)); return }
+        let seam = (0..<topo.edgeCount).first { topo.faces(ofEdge: $0).count == 1 }
+        #expect(seam != nil)
+        guard let seam else { return }
+        let uses = (0..<topo.wireCount).flatMap { topo.edges(ofWire: $0) }.filter { $0.edge == seam }
+        #expect(uses.count == 2)
+        #expect(Set(uses.map { $0.orientation }) == [.forward, .reversed])
+    }
+}
@@ -0,0 +1,49 @@
+import Testing
+import Foundation
+@testable import OCCTSwift
+
+// Pooled OCCTShape/OCCTFace/OCCTEdge/OCCTWire wrappers. Counters exist only in builds
+// with OCCT_WRAPPER_POOL_STATS (`OCCTSWIFT_POOL_STATS=1 swift test`); otherwise the
+// counter test is reported as skipped.
+@Suite("Wrapper pooling")
+struct WrapperPoolTests {
+
+    @Test("repeated topology walks recycle wrapper blocks",
+          .enabled(if: Shape.wrapperPoolStats != nil, "built without OCCT_WRAPPER_POOL_STATS"))
+    func recycling() throws {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        // Warm the calling thread's free list.
+        for _ in 0..<10 { _ = box.faces() }
+        let before = try #require(Shape.wrapperPoolStats)
+        for _ in 0..<100 {
+            #expect(box.faces().count == 6)
+        }
+        let after = try #require(Shape.wrapperPoolStats)
+        // Counters are process-wide, so other suites can only add to them.
+        #expect(after.allocations - before.allocations >= 600)
+        #expect(after.releases - before.releases >= 600)
+        #expect(after.poolHits - before.poolHits >= 500)
+    }
+
+    @Test("trimming leaves later allocations working")
+    func trim() {
+        let box = Shape.box(width: 1, height: 2, depth: 3)!
+        _ = box.faces()
+        Shape.trimWrapperPool()
+        #expect(box.faces().count == 6)
+        #expect(box.subShapes(ofType: .edge).count == 12)
+    }
+
+    @Test("wrappers released on another thread are reused safely")
+    func crossThread() async {
+        let box = Shape.box(width: 10, height: 10, depth: 10)!
+        let faces = box.faces()
+        await Task.detached { _ = faces.count }.value
+        await withTaskGroup(of: Int.self) { group in
+            for _ in 0..<8 {
+                group.addTask { (0..<50).reduce(0) { acc, _ in acc + box.subShapes(ofType: .edge).count } }
+            }
+            for await n in group { #expect(n == 600) }
+        }
+    }
+}